@@ -0,0 +1,1288 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "xsimd/xsimd.hpp"
+#include "xsimd/stl/algorithms.hpp"
+#include "xsimd/stl/convolve.hpp"
+#include "xsimd/stl/expression.hpp"
+#include "xsimd/stl/stencil.hpp"
+
+namespace xsimd
+{
+    namespace bench
+    {
+        using duration_type = std::chrono::duration<double, std::milli>;
+
+        template <class T>
+        using bench_vector = std::vector<T, xsimd::aligned_allocator<T>>;
+
+        // Returns the best time out of `number` runs of f.
+        template <class F>
+        duration_type best_of(F&& f, std::size_t number)
+        {
+            duration_type t_res = duration_type::max();
+            for (std::size_t count = 0; count < number; ++count)
+            {
+                auto start = std::chrono::steady_clock::now();
+                f();
+                auto end = std::chrono::steady_clock::now();
+                duration_type tmp = end - start;
+                t_res = tmp < t_res ? tmp : t_res;
+            }
+            return t_res;
+        }
+
+        template <class T>
+        bench_vector<T> make_input(std::size_t size)
+        {
+            bench_vector<T> res(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                res[i] = T(0.5) + std::sqrt(T(i)) * T(9.) / T(size);
+            }
+            return res;
+        }
+
+        struct axpy
+        {
+            template <class T>
+            T operator()(T const& x, T const& y) const
+            {
+                return T(2.5) * x + y;
+            }
+        };
+
+        struct plus
+        {
+            template <class T>
+            T operator()(T const& x, T const& y) const
+            {
+                return x + y;
+            }
+        };
+
+        struct multiplies
+        {
+            template <class T>
+            T operator()(T const& x, T const& y) const
+            {
+                return x * y;
+            }
+        };
+
+        struct exp_fn
+        {
+            template <class T>
+            T operator()(T const& x) const
+            {
+                using std::exp;
+                using xsimd::exp;
+                return exp(x);
+            }
+        };
+
+        struct less_than
+        {
+            float threshold;
+
+            template <class T>
+            auto operator()(T const& x) const -> decltype(x < T(threshold))
+            {
+                return x < T(threshold);
+            }
+        };
+
+        struct sin_fn
+        {
+            template <class T>
+            T operator()(T const& x) const
+            {
+                using std::sin;
+                using xsimd::sin;
+                return sin(x);
+            }
+        };
+
+        struct scale_offset
+        {
+            float scale;
+            float offset;
+
+            template <class T>
+            T operator()(T const& x) const
+            {
+                return x * T(scale) + T(offset);
+            }
+        };
+
+        std::vector<std::size_t> thread_counts()
+        {
+            std::size_t hw = std::max(std::thread::hardware_concurrency(), 1u);
+            std::vector<std::size_t> res;
+            for (std::size_t n = 1; n < hw; n *= 2)
+            {
+                res.push_back(n);
+            }
+            res.push_back(hw);
+            return res;
+        }
+    }
+}
+
+void benchmark_parallel()
+{
+    using namespace xsimd::bench;
+    std::size_t size = 1 << 24;
+    std::size_t iter = 20;
+    auto x = make_input<float>(size);
+    auto y = make_input<float>(size);
+    bench_vector<float> res(size);
+
+    std::cout << "============================" << std::endl;
+    std::cout << "parallel transform / reduce, " << size << " floats" << std::endl;
+    std::cout << "threads | axpy       | exp        | reduce" << std::endl;
+
+    duration_type t_axpy = best_of([&]() { xsimd::transform(x.begin(), x.end(), y.begin(), res.begin(), axpy{}); }, iter);
+    duration_type t_exp = best_of([&]() { xsimd::transform(x.begin(), x.end(), res.begin(), exp_fn{}); }, iter);
+    float sum = 0;
+    duration_type t_reduce = best_of([&]() { sum += xsimd::reduce(x.begin(), x.end(), 0.f); }, iter);
+    std::cout << "seq     | " << t_axpy.count() << "ms | " << t_exp.count() << "ms | " << t_reduce.count() << "ms" << std::endl;
+
+    for (std::size_t threads : thread_counts())
+    {
+        xsimd::parallel_policy policy(threads);
+        t_axpy = best_of([&]() { xsimd::transform(policy, x.begin(), x.end(), y.begin(), res.begin(), axpy{}); }, iter);
+        t_exp = best_of([&]() { xsimd::transform(policy, x.begin(), x.end(), res.begin(), exp_fn{}); }, iter);
+        t_reduce = best_of([&]() { sum += xsimd::reduce(policy, x.begin(), x.end(), 0.f); }, iter);
+        std::cout << threads << (threads < 10 ? "       | " : "      | ")
+                  << t_axpy.count() << "ms | " << t_exp.count() << "ms | " << t_reduce.count() << "ms" << std::endl;
+    }
+    std::cout << "(checksum " << sum << ")" << std::endl;
+    std::cout << "============================" << std::endl;
+}
+
+template <std::size_t K>
+xsimd::bench::duration_type benchmark_reduce_accumulators(xsimd::bench::bench_vector<float> const& x, std::size_t repeat, float& sum)
+{
+    return xsimd::bench::best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            sum += xsimd::reduce<xsimd::default_arch, K>(x.begin(), x.end(), 0.f);
+        }
+    }, 20);
+}
+
+void benchmark_reduce()
+{
+    using namespace xsimd::bench;
+    // L1-resident input, reduced many times
+    std::size_t size = 4096;
+    std::size_t repeat = 1000;
+    auto x = make_input<float>(size);
+    float sum = 0;
+
+    duration_type t_std = best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            sum += std::accumulate(x.begin(), x.end(), 0.f);
+        }
+    }, 20);
+
+    auto print = [&](std::string const& name, duration_type t)
+    {
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    std::cout << "============================" << std::endl;
+    std::cout << "reduce, " << size << " floats, " << repeat << " times" << std::endl;
+    print("std::accumulate  ", t_std);
+    print("1 accumulator    ", benchmark_reduce_accumulators<1>(x, repeat, sum));
+    print("2 accumulators   ", benchmark_reduce_accumulators<2>(x, repeat, sum));
+    print("4 accumulators   ", benchmark_reduce_accumulators<4>(x, repeat, sum));
+    print("8 accumulators   ", benchmark_reduce_accumulators<8>(x, repeat, sum));
+    print("default (" + std::to_string(xsimd::detail::reduce_accumulators<xsimd::default_arch>::value) + ")      ",
+          best_of([&]()
+          {
+              for (std::size_t r = 0; r < repeat; ++r)
+              {
+                  sum += xsimd::reduce(x.begin(), x.end(), 0.f);
+              }
+          }, 20));
+    std::cout << "(checksum " << sum << ")" << std::endl;
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_accurate()
+{
+    using namespace xsimd::bench;
+    std::size_t size = 1 << 20;
+    std::size_t repeat = 10;
+    auto x = make_input<double>(size);
+    auto y = make_input<double>(size);
+    double sum = 0;
+
+    auto run = [&](std::string const& name, std::function<double()> const& f)
+    {
+        double res = 0;
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                res = f();
+                sum += res;
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout.precision(17);
+        std::cout << name << ": " << res;
+        std::cout.precision(6);
+        std::cout << " in " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    std::cout << "============================" << std::endl;
+    std::cout << "accurate sum / dot, " << size << " doubles, " << repeat << " times" << std::endl;
+    run("std::accumulate (long double)      ", [&]() { return static_cast<double>(std::accumulate(x.begin(), x.end(), 0.L)); });
+    run("xsimd::reduce                      ", [&]() { return xsimd::reduce(x.begin(), x.end(), 0.); });
+    run("xsimd::accurate_sum (kahan)        ", [&]() { return xsimd::accurate_sum(x.begin(), x.end(), xsimd::summation::kahan); });
+    run("xsimd::accurate_sum (neumaier)     ", [&]() { return xsimd::accurate_sum(x.begin(), x.end(), xsimd::summation::neumaier); });
+    run("xsimd::accurate_sum (sum2)         ", [&]() { return xsimd::accurate_sum(x.begin(), x.end(), xsimd::summation::ogita_rump_oishi); });
+    run("std::inner_product (long double)   ", [&]() { return static_cast<double>(std::inner_product(x.begin(), x.end(), y.begin(), 0.L)); });
+    run("xsimd::inner_product               ", [&]() { return xsimd::inner_product(x.begin(), x.end(), y.begin(), 0.); });
+    run("xsimd::accurate_dot (kahan)        ", [&]() { return xsimd::accurate_dot(x.begin(), x.end(), y.begin(), xsimd::summation::kahan); });
+    run("xsimd::accurate_dot (neumaier)     ", [&]() { return xsimd::accurate_dot(x.begin(), x.end(), y.begin(), xsimd::summation::neumaier); });
+    run("xsimd::accurate_dot (dot2)         ", [&]() { return xsimd::accurate_dot(x.begin(), x.end(), y.begin(), xsimd::summation::ogita_rump_oishi); });
+    std::cout << "(checksum " << sum << ")" << std::endl;
+    std::cout << "============================" << std::endl;
+}
+
+template <class T, class F>
+void benchmark_unary_math(std::string const& label, xsimd::bench::bench_vector<T> const& in, xsimd::bench::bench_vector<T>& out, std::size_t repeat, F f)
+{
+    using namespace xsimd::bench;
+    using batch_type = xsimd::batch<T>;
+    duration_type t = best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            for (std::size_t i = 0; i < in.size(); i += batch_type::size)
+            {
+                f(batch_type::load_aligned(&in[i])).store_aligned(&out[i]);
+            }
+        }
+    }, 10);
+    double ns_per_elt = t.count() * 1e6 / double(in.size() * repeat);
+    std::cout << label << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+}
+
+template <class T>
+void benchmark_fast_math_type(std::string const& name, std::size_t size, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    using batch_type = xsimd::batch<T>;
+    bench_vector<T> x(size), positive(size), out(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        x[i] = T(-10) + T(20) * T(i) / T(size);
+        positive[i] = T(1e-3) + T(1e3) * T(i) / T(size);
+    }
+    std::cout << name << std::endl;
+    benchmark_unary_math("xsimd::exp       ", x, out, repeat, [](batch_type const& v) { return xsimd::exp(v); });
+    benchmark_unary_math("xsimd::fast::exp ", x, out, repeat, [](batch_type const& v) { return xsimd::fast::exp(v); });
+    benchmark_unary_math("xsimd::log       ", positive, out, repeat, [](batch_type const& v) { return xsimd::log(v); });
+    benchmark_unary_math("xsimd::fast::log ", positive, out, repeat, [](batch_type const& v) { return xsimd::fast::log(v); });
+    benchmark_unary_math("xsimd::sin       ", x, out, repeat, [](batch_type const& v) { return xsimd::sin(v); });
+    benchmark_unary_math("xsimd::fast::sin ", x, out, repeat, [](batch_type const& v) { return xsimd::fast::sin(v); });
+    benchmark_unary_math("xsimd::cos       ", x, out, repeat, [](batch_type const& v) { return xsimd::cos(v); });
+    benchmark_unary_math("xsimd::fast::cos ", x, out, repeat, [](batch_type const& v) { return xsimd::fast::cos(v); });
+}
+
+void benchmark_fast_math()
+{
+    std::size_t size = 1 << 14;
+    std::size_t repeat = 200;
+    std::cout << "============================" << std::endl;
+    std::cout << "accurate and fast math functions on " << size << " values" << std::endl;
+    benchmark_fast_math_type<float>("float", size, repeat);
+    benchmark_fast_math_type<double>("double", size, repeat);
+    std::cout << "============================" << std::endl;
+}
+
+template <class T>
+void benchmark_find_type(std::string const& name, std::size_t size, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    bench_vector<T> x(size, T(1));
+    // the searched element sits at the end: both scans go through the whole range
+    x.back() = T(2);
+    std::size_t res = 0;
+
+    auto run = [&](std::string const& algo, duration_type t)
+    {
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << " " << algo << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    run("std::find    ", best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            res += static_cast<std::size_t>(std::find(x.begin(), x.end(), T(2)) - x.begin());
+        }
+    }, 20));
+    run("xsimd::find  ", best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            res += static_cast<std::size_t>(xsimd::find(x.begin(), x.end(), T(2)) - x.begin());
+        }
+    }, 20));
+    run("std::count   ", best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            res += static_cast<std::size_t>(std::count(x.begin(), x.end(), T(1)));
+        }
+    }, 20));
+    run("xsimd::count ", best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            res += static_cast<std::size_t>(xsimd::count(x.begin(), x.end(), T(1)));
+        }
+    }, 20));
+    std::cout << "(checksum " << res << ")" << std::endl;
+}
+
+void benchmark_find()
+{
+    std::size_t size = 16384;
+    std::size_t repeat = 200;
+    std::cout << "============================" << std::endl;
+    std::cout << "find / count, " << size << " elements, " << repeat << " times" << std::endl;
+    benchmark_find_type<float>("float  ", size, repeat);
+    benchmark_find_type<int32_t>("int32  ", size, repeat);
+    benchmark_find_type<uint8_t>("uint8  ", size, repeat);
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_inner_product()
+{
+    using namespace xsimd::bench;
+    // L1-resident inputs, reduced many times
+    std::size_t size = 2048;
+    std::size_t repeat = 1000;
+    auto x = make_input<float>(size);
+    auto y = make_input<float>(size);
+    bench_vector<float> tmp(size);
+    float sum = 0;
+
+    auto run = [&](std::string const& name, std::function<float()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                sum += f();
+            }
+        }, 20);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    std::cout << "============================" << std::endl;
+    std::cout << "inner product, " << size << " floats, " << repeat << " times" << std::endl;
+    run("std::inner_product         ", [&]() { return std::inner_product(x.begin(), x.end(), y.begin(), 0.f); });
+    run("xsimd::transform + reduce  ", [&]()
+    {
+        xsimd::transform(x.begin(), x.end(), y.begin(), tmp.begin(), multiplies{});
+        return xsimd::reduce(tmp.begin(), tmp.end(), 0.f);
+    });
+    run("xsimd::inner_product       ", [&]() { return xsimd::inner_product(x.begin(), x.end(), y.begin(), 0.f); });
+    std::cout << "(checksum " << sum << ")" << std::endl;
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_minmax()
+{
+    using namespace xsimd::bench;
+    std::size_t size = 16384;
+    std::size_t repeat = 200;
+    auto x = make_input<float>(size);
+    std::reverse(x.begin(), x.begin() + size / 2);
+    std::size_t res = 0;
+
+    auto run = [&](std::string const& name, duration_type t)
+    {
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+    auto bench = [&](std::string const& name, std::function<std::size_t()> const& f)
+    {
+        run(name, best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                res += f();
+            }
+        }, 20));
+    };
+
+    std::cout << "============================" << std::endl;
+    std::cout << "min_element / minmax_element, " << size << " floats, " << repeat << " times" << std::endl;
+    bench("std::min_element              ", [&]() { return static_cast<std::size_t>(std::min_element(x.begin(), x.end()) - x.begin()); });
+    bench("xsimd::min_element            ", [&]() { return static_cast<std::size_t>(xsimd::min_element(x.begin(), x.end()) - x.begin()); });
+    bench("xsimd::min_element (fast)     ", [&]() { return static_cast<std::size_t>(xsimd::min_element(x.begin(), x.end(), xsimd::nan_policy::fast) - x.begin()); });
+    bench("std::minmax_element           ", [&]() { return static_cast<std::size_t>(std::minmax_element(x.begin(), x.end()).second - x.begin()); });
+    bench("xsimd::minmax_element         ", [&]() { return static_cast<std::size_t>(xsimd::minmax_element(x.begin(), x.end()).second - x.begin()); });
+    std::cout << "(checksum " << res << ")" << std::endl;
+    std::cout << "============================" << std::endl;
+}
+
+template <class T>
+void benchmark_pi_trigo_type(std::string const& name, std::size_t size, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    using batch_type = xsimd::batch<T>;
+    bench_vector<T> cycles(size), out(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        cycles[i] = T(-1000) + T(2000) * T(i) / T(size);
+    }
+    std::cout << name << std::endl;
+    benchmark_unary_math("xsimd::sin(pi * x)", cycles, out, repeat, [](batch_type const& v) { return xsimd::sin(v * xsimd::constants::pi<batch_type>()); });
+    benchmark_unary_math("xsimd::sinpi(x)   ", cycles, out, repeat, [](batch_type const& v) { return xsimd::sinpi(v); });
+    benchmark_unary_math("xsimd::cos(pi * x)", cycles, out, repeat, [](batch_type const& v) { return xsimd::cos(v * xsimd::constants::pi<batch_type>()); });
+    benchmark_unary_math("xsimd::cospi(x)   ", cycles, out, repeat, [](batch_type const& v) { return xsimd::cospi(v); });
+    benchmark_unary_math("xsimd::tan(pi * x)", cycles, out, repeat, [](batch_type const& v) { return xsimd::tan(v * xsimd::constants::pi<batch_type>()); });
+    benchmark_unary_math("xsimd::tanpi(x)   ", cycles, out, repeat, [](batch_type const& v) { return xsimd::tanpi(v); });
+}
+
+void benchmark_pi_trigo()
+{
+    std::size_t size = 1 << 14;
+    std::size_t repeat = 200;
+    std::cout << "============================" << std::endl;
+    std::cout << "trigonometric functions of pi * x on " << size << " values in [-1000, 1000]" << std::endl;
+    benchmark_pi_trigo_type<float>("float", size, repeat);
+    benchmark_pi_trigo_type<double>("double", size, repeat);
+    std::cout << "============================" << std::endl;
+}
+
+template <class T>
+void benchmark_polyval_degree(std::string const& name, std::size_t degree, std::size_t size, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    bench_vector<T> x(size), out(size);
+    std::vector<T> coeffs(degree + 1);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        x[i] = T(-1) + T(2) * T(i) / T(size);
+    }
+    for (std::size_t k = 0; k <= degree; ++k)
+    {
+        coeffs[k] = T(1) / T(k + 1);
+    }
+
+    auto run = [&](std::string const& label, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << label << name << ", degree " << degree << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    run("scalar Horner  ", [&]()
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            T acc = coeffs[degree];
+            for (std::size_t k = degree; k-- > 0;)
+            {
+                acc = acc * x[i] + coeffs[k];
+            }
+            out[i] = acc;
+        }
+    });
+    run("xsimd Horner   ", [&]() { xsimd::polyval(coeffs, x.begin(), x.end(), out.begin(), xsimd::polynomial_scheme::horner); });
+    run("xsimd Estrin   ", [&]() { xsimd::polyval(coeffs, x.begin(), x.end(), out.begin(), xsimd::polynomial_scheme::estrin); });
+    run("xsimd::polyval ", [&]() { xsimd::polyval(coeffs, x.begin(), x.end(), out.begin()); });
+    run("xsimd::chebval ", [&]() { xsimd::chebval(coeffs, x.begin(), x.end(), out.begin()); });
+}
+
+void benchmark_polyval()
+{
+    std::size_t size = 1 << 14;
+    std::size_t repeat = 200;
+    std::cout << "============================" << std::endl;
+    std::cout << "polynomial evaluation at " << size << " points" << std::endl;
+    for (std::size_t degree : { 3, 5, 8, 12, 20 })
+    {
+        benchmark_polyval_degree<float>("float", degree, size, repeat);
+        benchmark_polyval_degree<double>("double", degree, size, repeat);
+    }
+    std::cout << "============================" << std::endl;
+}
+
+template <class T>
+void benchmark_scan_type(std::string const& name, std::size_t size, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    bench_vector<T> in(size), out(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        in[i] = static_cast<T>((i * 7919) % 100);
+    }
+
+    auto run = [&](std::string const& label, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << label << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    run("std::partial_sum          ", [&]() { std::partial_sum(in.begin(), in.end(), out.begin()); });
+    run("xsimd::inclusive_scan     ", [&]() { xsimd::inclusive_scan(in.begin(), in.end(), out.begin()); });
+    run("xsimd::exclusive_scan     ", [&]() { xsimd::exclusive_scan(in.begin(), in.end(), out.begin(), T(0)); });
+    run("parallel inclusive_scan   ", [&]() { xsimd::inclusive_scan(xsimd::par, in.begin(), in.end(), out.begin()); });
+}
+
+void benchmark_scan()
+{
+    std::cout << "============================" << std::endl;
+    std::cout << "running sums, in cache then in memory" << std::endl;
+    benchmark_scan_type<float>(" float, 2^14", 1 << 14, 1000);
+    benchmark_scan_type<int32_t>(" int32_t, 2^14", 1 << 14, 1000);
+    benchmark_scan_type<uint8_t>(" uint8_t, 2^14", 1 << 14, 1000);
+    benchmark_scan_type<float>(" float, 2^24", 1 << 24, 2);
+    benchmark_scan_type<double>(" double, 2^24", 1 << 24, 2);
+    std::cout << "============================" << std::endl;
+}
+
+template <class T>
+void benchmark_sort_type(std::string const& name, std::size_t size, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    bench_vector<T> input(size);
+    unsigned seed = 42u;
+    for (auto& v : input)
+    {
+        seed = seed * 1103515245u + 12345u;
+        v = static_cast<T>(seed >> 4);
+    }
+    bench_vector<T> x(size);
+    std::size_t res = 0;
+
+    auto run = [&](std::string const& algo, duration_type t)
+    {
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << " " << algo << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    // the copy of the input is part of the timing of both sorts
+    run("std::sort   ", best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            std::copy(input.begin(), input.end(), x.begin());
+            std::sort(x.begin(), x.end());
+            res += static_cast<std::size_t>(x[size / 2]);
+        }
+    }, 5));
+    run("xsimd::sort ", best_of([&]()
+    {
+        for (std::size_t r = 0; r < repeat; ++r)
+        {
+            std::copy(input.begin(), input.end(), x.begin());
+            xsimd::sort(x.begin(), x.end());
+            res += static_cast<std::size_t>(x[size / 2]);
+        }
+    }, 5));
+    std::cout << "(checksum " << res << ")" << std::endl;
+}
+
+void benchmark_sort()
+{
+    std::cout << "============================" << std::endl;
+    for (std::size_t size : { std::size_t(256), std::size_t(1) << 20 })
+    {
+        std::size_t repeat = (std::size_t(1) << 22) / size;
+        std::cout << "sort, " << size << " random elements, " << repeat << " times" << std::endl;
+        benchmark_sort_type<float>("float  ", size, repeat);
+        benchmark_sort_type<int32_t>("int32  ", size, repeat);
+        benchmark_sort_type<double>("double ", size, repeat);
+        benchmark_sort_type<int64_t>("int64  ", size, repeat);
+    }
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_bytes()
+{
+    using namespace xsimd::bench;
+    std::size_t size = 1 << 16;
+    std::size_t repeat = 200;
+    // text without the searched bytes but the last one
+    bench_vector<char> text(size + 1);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        text[i] = static_cast<char>('a' + (i * 7) % 23);
+    }
+    text[size - 2] = '#';
+    text[size - 1] = '!';
+    text[size] = '\0';
+    std::string const needle(text.data() + size - 6, text.data() + size);
+    std::size_t res = 0;
+
+    auto run = [&](std::string const& name, std::function<std::size_t()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                res += f();
+            }
+        }, 20);
+        double gb_per_s = double(size * repeat) / (t.count() * 1e6);
+        std::cout << name << ": " << t.count() << "ms (" << gb_per_s << "GB/s)" << std::endl;
+    };
+
+    char const* first = text.data();
+    char const* last = text.data() + size;
+    std::cout << "============================" << std::endl;
+    std::cout << "byte search, " << size << " bytes, " << repeat << " times" << std::endl;
+    run("memchr                 ", [&]() { return static_cast<std::size_t>(static_cast<char const*>(std::memchr(first, '!', size)) - first); });
+    run("xsimd::find_byte       ", [&]() { return static_cast<std::size_t>(xsimd::find_byte(first, last, '!') - first); });
+    run("strcspn (3 bytes)      ", [&]() { return std::strcspn(first, "!\r\n"); });
+    run("xsimd::find_any_of     ", [&]() { return static_cast<std::size_t>(xsimd::find_any_of(first, last, '!', '\r', '\n') - first); });
+    run("std::strlen            ", [&]() { return std::strlen(first); });
+    run("xsimd::strlen          ", [&]() { return xsimd::strlen(first); });
+    run("strstr                 ", [&]() { return static_cast<std::size_t>(std::strstr(first, needle.c_str()) - first); });
+    run("std::search            ", [&]() { return static_cast<std::size_t>(std::search(first, last, needle.begin(), needle.end()) - first); });
+    run("xsimd::search          ", [&]() { return static_cast<std::size_t>(xsimd::search(first, last, needle.begin(), needle.end()) - first); });
+    std::cout << "(checksum " << res << ")" << std::endl;
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_convolve_taps(std::size_t size, std::size_t num_taps, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    bench_vector<float> signal(size + num_taps - 1), out(size + num_taps - 1);
+    std::vector<float> taps(num_taps);
+    for (std::size_t i = 0; i < signal.size(); ++i)
+    {
+        signal[i] = float((i * 7919) % 100) * 0.01f;
+    }
+    for (std::size_t k = 0; k < num_taps; ++k)
+    {
+        taps[k] = 1.f / float(k + 1);
+    }
+    std::vector<float> reversed(taps.rbegin(), taps.rend());
+
+    auto run = [&](std::string const& name, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << num_taps << " taps: " << t.count() << "ms (" << ns_per_elt << "ns / output)" << std::endl;
+    };
+
+    run("scalar loop                   ", [&]()
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            float acc = 0.f;
+            for (std::size_t k = 0; k < num_taps; ++k)
+            {
+                acc += reversed[k] * signal[i + k];
+            }
+            out[i] = acc;
+        }
+    });
+    run("xsimd::reduce per output      ", [&]()
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            out[i] = xsimd::transform_reduce(signal.begin() + i, signal.begin() + i + num_taps, reversed.begin(), 0.f);
+        }
+    });
+    run("xsimd::convolve               ", [&]()
+    {
+        xsimd::convolve(signal.begin(), signal.end(), taps.begin(), taps.end(), out.begin());
+    });
+    xsimd::fir_filter<float> filter(taps.begin(), taps.end());
+    run("xsimd::fir_filter, 256 blocks ", [&]()
+    {
+        for (std::size_t i = 0; i + 256 <= size; i += 256)
+        {
+            filter.process(signal.begin() + i, signal.begin() + i + 256, out.begin() + i);
+        }
+    });
+}
+
+void benchmark_convolve()
+{
+    std::size_t size = 1 << 14;
+    std::cout << "============================" << std::endl;
+    std::cout << "FIR filter of " << size << " floats" << std::endl;
+    benchmark_convolve_taps(size, 4, 100);
+    benchmark_convolve_taps(size, 8, 100);
+    benchmark_convolve_taps(size, 16, 50);
+    benchmark_convolve_taps(size, 64, 20);
+    benchmark_convolve_taps(size, 128, 10);
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_copy_if()
+{
+    using namespace xsimd::bench;
+    std::size_t size = 1 << 20;
+    std::size_t repeat = 10;
+    bench_vector<float> x(size), res(size), res_false(size), work(size);
+    uint32_t state = 12345;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        state = state * 1664525u + 1013904223u;
+        x[i] = float(state >> 8) / float(1 << 24);
+    }
+
+    auto run = [&](std::string const& name, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    std::cout << "============================" << std::endl;
+    std::cout << "stream compaction of " << size << " floats, " << repeat << " times" << std::endl;
+    for (float selectivity : { 0.01f, 0.1f, 0.5f, 0.9f, 0.99f })
+    {
+        less_than pred { selectivity };
+        std::cout << "selecting " << selectivity * 100.f << "%" << std::endl;
+        run("std::copy_if           ", [&]() { std::copy_if(x.begin(), x.end(), res.begin(), pred); });
+        run("xsimd::copy_if         ", [&]() { xsimd::copy_if(x.begin(), x.end(), res.begin(), pred); });
+        run("std::partition_copy    ", [&]() { std::partition_copy(x.begin(), x.end(), res.begin(), res_false.begin(), pred); });
+        run("xsimd::partition_copy  ", [&]() { xsimd::partition_copy(x.begin(), x.end(), res.begin(), res_false.begin(), pred); });
+        // the copy is part of both measures
+        run("copy + std::remove_if  ", [&]()
+        {
+            std::copy(x.begin(), x.end(), work.begin());
+            std::remove_if(work.begin(), work.end(), pred);
+        });
+        run("copy + xsimd::remove_if", [&]()
+        {
+            std::copy(x.begin(), x.end(), work.begin());
+            xsimd::remove_if(work.begin(), work.end(), pred);
+        });
+    }
+    std::cout << "============================" << std::endl;
+}
+
+template <class In, class Out>
+void benchmark_convert_pair(std::string const& name, std::size_t size, std::size_t repeat, bool saturate)
+{
+    using namespace xsimd::bench;
+    bench_vector<In> in(size);
+    bench_vector<Out> out(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        in[i] = static_cast<In>((i * 7919) % 100);
+    }
+
+    auto run = [&](std::string const& label, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << label << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    if (saturate)
+    {
+        Out const lo = std::numeric_limits<Out>::lowest();
+        Out const hi = std::numeric_limits<Out>::max();
+        run("scalar saturated ", [&]()
+        {
+            std::transform(in.begin(), in.end(), out.begin(), [lo, hi](In x) { return static_cast<Out>(std::min(std::max(x, In(lo)), In(hi))); });
+        });
+        run("xsimd saturated  ", [&]()
+        {
+            xsimd::convert(in.begin(), in.end(), out.begin(), xsimd::conversion_policy::saturate);
+        });
+    }
+    else
+    {
+        run("scalar           ", [&]()
+        {
+            std::transform(in.begin(), in.end(), out.begin(), [](In x) { return static_cast<Out>(x); });
+        });
+        run("xsimd            ", [&]()
+        {
+            xsimd::convert(in.begin(), in.end(), out.begin());
+        });
+    }
+}
+
+void benchmark_convert()
+{
+    std::size_t size = 1 << 20;
+    std::size_t repeat = 10;
+    std::cout << "============================" << std::endl;
+    std::cout << "conversion of " << size << " values, " << repeat << " times" << std::endl;
+    benchmark_convert_pair<int16_t, float>("int16_t -> float", size, repeat, false);
+    benchmark_convert_pair<uint8_t, float>("uint8_t -> float", size, repeat, false);
+    benchmark_convert_pair<int32_t, double>("int32_t -> double", size, repeat, false);
+    benchmark_convert_pair<float, double>("float -> double", size, repeat, false);
+    benchmark_convert_pair<double, float>("double -> float", size, repeat, false);
+    benchmark_convert_pair<int32_t, int16_t>("int32_t -> int16_t", size, repeat, false);
+    benchmark_convert_pair<float, int16_t>("float -> int16_t", size, repeat, true);
+    benchmark_convert_pair<float, uint8_t>("float -> uint8_t", size, repeat, true);
+    benchmark_convert_pair<double, int32_t>("double -> int32_t", size, repeat, true);
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_histogram()
+{
+    using namespace xsimd::bench;
+    std::size_t size = 1 << 20;
+    std::size_t repeat = 10;
+    bench_vector<uint8_t> bytes(size);
+    bench_vector<int32_t> keys(size);
+    bench_vector<int32_t> wide_keys(size);
+    bench_vector<float> values(size);
+    std::vector<uint32_t> counts(65536);
+
+    auto run = [&](std::string const& name, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    // uniform values, then values concentrated in two bins, which makes
+    // consecutive increments hit the same counters
+    for (bool skewed : { false, true })
+    {
+        uint32_t state = 12345;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+            uint32_t const bits = skewed ? (state >> 31) * 0x55555555u : state;
+            bytes[i] = uint8_t(bits >> 24);
+            keys[i] = int32_t(bits >> 20);
+            wide_keys[i] = int32_t(bits >> 16);
+            values[i] = float(bits >> 8) / float(1 << 24);
+        }
+
+        std::cout << "============================" << std::endl;
+        std::cout << (skewed ? "skewed" : "uniform") << " histograms of " << size << " values, " << repeat << " times" << std::endl;
+        run("scalar bincount, uint8_t, 256 bins  ", [&]()
+        {
+            std::fill(counts.begin(), counts.begin() + 256, 0);
+            for (uint8_t b : bytes)
+            {
+                ++counts[b];
+            }
+        });
+        run("xsimd::bincount, uint8_t, 256 bins  ", [&]()
+        {
+            std::fill(counts.begin(), counts.begin() + 256, 0);
+            xsimd::bincount(bytes.begin(), bytes.end(), counts.begin(), counts.begin() + 256);
+        });
+        run("scalar bincount, int32_t, 4096 bins ", [&]()
+        {
+            std::fill(counts.begin(), counts.begin() + 4096, 0);
+            for (int32_t k : keys)
+            {
+                ++counts[k];
+            }
+        });
+        run("xsimd::bincount, int32_t, 4096 bins ", [&]()
+        {
+            std::fill(counts.begin(), counts.begin() + 4096, 0);
+            xsimd::bincount(keys.begin(), keys.end(), counts.begin(), counts.begin() + 4096);
+        });
+        // four tables of this many bins no longer fit in the L2 cache
+        run("scalar bincount, int32_t, 65536 bins", [&]()
+        {
+            std::fill(counts.begin(), counts.end(), 0);
+            for (int32_t k : wide_keys)
+            {
+                ++counts[k];
+            }
+        });
+        run("xsimd::bincount, int32_t, 65536 bins", [&]()
+        {
+            std::fill(counts.begin(), counts.end(), 0);
+            xsimd::bincount(wide_keys.begin(), wide_keys.end(), counts.begin(), counts.end());
+        });
+        for (std::size_t num_bins : { std::size_t(256), std::size_t(4096) })
+        {
+            std::string const bins = std::to_string(num_bins) + " bins" + (num_bins < 1000 ? " " : "");
+            run("scalar histogram, float, " + bins + "  ", [&]()
+            {
+                std::fill(counts.begin(), counts.begin() + num_bins, 0);
+                float const scale = float(num_bins);
+                for (float x : values)
+                {
+                    if (x >= 0.f && x <= 1.f)
+                    {
+                        ++counts[std::min(std::size_t(x * scale), num_bins - 1)];
+                    }
+                }
+            });
+            run("xsimd::histogram, float, " + bins + "  ", [&]()
+            {
+                std::fill(counts.begin(), counts.begin() + num_bins, 0);
+                xsimd::histogram(values.begin(), values.end(), counts.begin(), counts.begin() + num_bins, 0.f, 1.f);
+            });
+        }
+    }
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_expression()
+{
+    using namespace xsimd::bench;
+    std::size_t size = 1 << 16;
+    std::size_t repeat = 100;
+    auto a = make_input<float>(size);
+    auto b = make_input<float>(size);
+    auto c = make_input<float>(size);
+    bench_vector<float> res(size), tmp1(size), tmp2(size);
+
+    auto run = [&](std::string const& name, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    std::cout << "============================" << std::endl;
+    std::cout << "a * b + sin(c), " << size << " floats, " << repeat << " times" << std::endl;
+    run("scalar loop              ", [&]()
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            res[i] = a[i] * b[i] + std::sin(c[i]);
+        }
+    });
+    run("chained xsimd::transform ", [&]()
+    {
+        xsimd::transform(a.begin(), a.end(), b.begin(), tmp1.begin(), multiplies{});
+        xsimd::transform(c.begin(), c.end(), tmp2.begin(), sin_fn{});
+        xsimd::transform(tmp1.begin(), tmp1.end(), tmp2.begin(), res.begin(), plus{});
+    });
+    run("xsimd::evaluate          ", [&]()
+    {
+        xsimd::evaluate(xsimd::expr(a) * b + xsimd::sin(xsimd::expr(c)), res.begin());
+    });
+    std::cout << "============================" << std::endl;
+}
+
+void benchmark_strided_matrix(std::size_t rows, std::size_t cols, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    auto m = make_input<float>(rows * cols);
+    bench_vector<float> column(rows);
+    std::vector<float> sums(cols);
+    float checksum = 0;
+
+    auto run = [&](std::string const& name, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+                checksum += sums[r % cols];
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(rows * cols * repeat);
+        std::cout << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    std::cout << "column sums of a " << rows << " x " << cols << " float matrix, " << repeat << " times" << std::endl;
+    run("std::accumulate, strided   ", [&]()
+    {
+        for (std::size_t j = 0; j < cols; ++j)
+        {
+            auto first = xsimd::make_strided_iterator(m.data() + j, cols);
+            sums[j] = std::accumulate(first, first + rows, 0.f);
+        }
+    });
+    run("column copy + xsimd::reduce", [&]()
+    {
+        for (std::size_t j = 0; j < cols; ++j)
+        {
+            for (std::size_t i = 0; i < rows; ++i)
+            {
+                column[i] = m[i * cols + j];
+            }
+            sums[j] = xsimd::reduce(column.begin(), column.end(), 0.f);
+        }
+    });
+    run("xsimd::reduce, strided     ", [&]()
+    {
+        for (std::size_t j = 0; j < cols; ++j)
+        {
+            auto first = xsimd::make_strided_iterator(m.data() + j, cols);
+            sums[j] = xsimd::reduce(first, first + rows, 0.f);
+        }
+    });
+    std::cout << "(checksum " << checksum << ")" << std::endl;
+}
+
+void benchmark_strided()
+{
+    // fields of an array of structures, then columns of a wide matrix
+    std::cout << "============================" << std::endl;
+    benchmark_strided_matrix(1 << 16, 3, 100);
+    benchmark_strided_matrix(1 << 14, 4, 100);
+    benchmark_strided_matrix(1 << 12, 64, 10);
+    std::cout << "============================" << std::endl;
+}
+
+namespace stencils
+{
+    using gaussian_3x3 = xsimd::stencil_weights<3, 16, 1, 2, 1, 2, 4, 2, 1, 2, 1>;
+    using sobel_x = xsimd::stencil_weights<3, 1, -1, 0, 1, -2, 0, 2, -1, 0, 1>;
+    using gaussian_5x5 = xsimd::stencil_weights<5, 256,
+                                                1, 4, 6, 4, 1,
+                                                4, 16, 24, 16, 4,
+                                                6, 24, 36, 24, 6,
+                                                4, 16, 24, 16, 4,
+                                                1, 4, 6, 4, 1>;
+}
+
+// Plain loops with the same compile-time weights, sums and rounding.
+template <class Weights, class T>
+void scalar_stencil(T const* in, std::size_t rows, std::size_t cols, T* out)
+{
+    using acc_type = typename xsimd::detail::stencil_accumulator<T, Weights>::type;
+    std::size_t const n = Weights::size;
+    for (std::size_t i = 0; i + n <= rows; ++i)
+    {
+        for (std::size_t j = 0; j + n <= cols; ++j)
+        {
+            out[i * (cols - n + 1) + j] = xsimd::detail::stencil_scalar<Weights, acc_type>(in + i * cols + j, cols);
+        }
+    }
+}
+
+template <class Weights, class T>
+void benchmark_stencil_image(std::string const& name, std::size_t rows, std::size_t cols, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    bench_vector<T> in(rows * cols), out(rows * cols);
+    for (std::size_t k = 0; k < in.size(); ++k)
+    {
+        in[k] = static_cast<T>((k * 7919) % 256);
+    }
+
+    auto run = [&](std::string const& label, std::function<void()> const& f)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                f();
+            }
+        }, 5);
+        double ns_per_pixel = t.count() * 1e6 / double(rows * cols * repeat);
+        std::cout << label << name << " " << cols << "x" << rows << ": " << t.count() << "ms (" << ns_per_pixel << "ns / pixel)" << std::endl;
+    };
+
+    run("scalar           ", [&]() { scalar_stencil<Weights>(in.data(), rows, cols, out.data()); });
+    run("xsimd::stencil2d ", [&]() { xsimd::stencil2d<Weights>(in.data(), rows, cols, out.data()); });
+}
+
+void benchmark_stencil()
+{
+    std::size_t const sizes[][3] = { { 480, 640, 100 }, { 1080, 1920, 10 }, { 4320, 7680, 1 } };
+    std::cout << "============================" << std::endl;
+    for (auto const& size : sizes)
+    {
+        benchmark_stencil_image<stencils::gaussian_3x3, uint8_t>("uint8_t gaussian 3x3", size[0], size[1], size[2]);
+        benchmark_stencil_image<stencils::sobel_x, uint8_t>("uint8_t sobel 3x3   ", size[0], size[1], size[2]);
+        benchmark_stencil_image<stencils::gaussian_5x5, uint8_t>("uint8_t gaussian 5x5", size[0], size[1], size[2]);
+        benchmark_stencil_image<stencils::gaussian_3x3, float>("float gaussian 3x3  ", size[0], size[1], size[2]);
+        benchmark_stencil_image<stencils::gaussian_5x5, float>("float gaussian 5x5  ", size[0], size[1], size[2]);
+    }
+    std::cout << "============================" << std::endl;
+}
+
+template <class In, class Out>
+void benchmark_transform_pair(std::string const& name, std::size_t size, std::size_t repeat)
+{
+    using namespace xsimd::bench;
+    bench_vector<In> in(size);
+    bench_vector<float> tmp(size);
+    bench_vector<Out> out(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        in[i] = static_cast<In>((i * 7919) % 100);
+    }
+    scale_offset const f { 0.5f, 1.f };
+
+    auto run = [&](std::string const& label, std::function<void()> const& g)
+    {
+        duration_type t = best_of([&]()
+        {
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                g();
+            }
+        }, 10);
+        double ns_per_elt = t.count() * 1e6 / double(size * repeat);
+        std::cout << label << name << ": " << t.count() << "ms (" << ns_per_elt << "ns / element)" << std::endl;
+    };
+
+    run("scalar                     ", [&]()
+    {
+        std::transform(in.begin(), in.end(), out.begin(), [f](In x) { return static_cast<Out>(f(static_cast<float>(x))); });
+    });
+    run("xsimd::convert + transform ", [&]()
+    {
+        if (std::is_same<In, float>::value)
+        {
+            xsimd::transform(in.begin(), in.end(), tmp.begin(), f);
+            xsimd::convert(tmp.begin(), tmp.end(), out.begin());
+        }
+        else
+        {
+            xsimd::convert(in.begin(), in.end(), tmp.begin());
+            xsimd::transform(tmp.begin(), tmp.end(), tmp.begin(), f);
+            xsimd::convert(tmp.begin(), tmp.end(), out.begin());
+        }
+    });
+    run("mixed xsimd::transform     ", [&]()
+    {
+        xsimd::transform(in.begin(), in.end(), out.begin(), f);
+    });
+}
+
+void benchmark_transform()
+{
+    std::size_t size = 1 << 16;
+    std::size_t repeat = 100;
+    std::cout << "============================" << std::endl;
+    std::cout << "x * 0.5 + 1 computed in float, " << size << " values, " << repeat << " times" << std::endl;
+    benchmark_transform_pair<uint8_t, float>("uint8_t -> float", size, repeat);
+    benchmark_transform_pair<int16_t, float>("int16_t -> float", size, repeat);
+    benchmark_transform_pair<float, uint8_t>("float -> uint8_t", size, repeat);
+    std::cout << "============================" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::map<std::string, std::pair<std::string, void(*)()>> fn_map = {
+        {"accurate", {"compensated summation", benchmark_accurate}},
+        {"bytes", {"byte search", benchmark_bytes}},
+        {"convert", {"array conversion", benchmark_convert}},
+        {"convolve", {"1D convolution", benchmark_convolve}},
+        {"copy_if", {"stream compaction", benchmark_copy_if}},
+        {"expression", {"lazy expression", benchmark_expression}},
+        {"fast_math", {"approximate math functions", benchmark_fast_math}},
+        {"find", {"search", benchmark_find}},
+        {"histogram", {"histogram", benchmark_histogram}},
+        {"inner_product", {"fused transform / reduce", benchmark_inner_product}},
+        {"minmax", {"min / max search", benchmark_minmax}},
+        {"parallel", {"parallel execution of", benchmark_parallel}},
+        {"pi_trigo", {"sinpi / cospi / tanpi", benchmark_pi_trigo}},
+        {"polyval", {"polynomial evaluation", benchmark_polyval}},
+        {"reduce", {"reduction", benchmark_reduce}},
+        {"scan", {"prefix sum", benchmark_scan}},
+        {"sort", {"sorting", benchmark_sort}},
+        {"stencil", {"2D stencil", benchmark_stencil}},
+        {"strided", {"strided access", benchmark_strided}},
+        {"transform", {"mixed type transform", benchmark_transform}},
+    };
+
+    if (argc > 1)
+    {
+        if (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")
+        {
+            std::cout << "Available options:" << std::endl;
+            for(auto const& kv : fn_map)
+            {
+                std::cout << kv.first << ": run benchmark on " << kv.second.first << " algorithms" << std::endl;
+            }
+        }
+        else
+        {
+            for (int i = 1; i < argc; ++i)
+            {
+                fn_map.at(argv[i]).second();
+            }
+        }
+    }
+    else
+    {
+        for(auto const& kv : fn_map)
+        {
+            kv.second.second();
+        }
+    }
+    return 0;
+}
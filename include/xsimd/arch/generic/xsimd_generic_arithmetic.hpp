@@ -87,6 +87,23 @@ namespace xsimd {
 
 
 
+    // inclusive_scan
+    namespace detail {
+      template<std::size_t S, class A, class T> batch<T, A> inclusive_scan(batch<T, A> const& self, std::false_type) {
+        return self;
+      }
+      // after the step adding the batch slid by S lanes, each lane holds
+      // the sum of the 2 * S lanes ending at it
+      template<std::size_t S, class A, class T> batch<T, A> inclusive_scan(batch<T, A> const& self, std::true_type) {
+        batch<T, A> res = self + slide_left<S * sizeof(T)>(self);
+        return inclusive_scan<2 * S, A>(res, std::integral_constant<bool, (2 * S < batch<T, A>::size)>{});
+      }
+    }
+
+    template<class A, class T> batch<T, A> inclusive_scan(batch<T, A> const& self, requires_arch<generic>) {
+      return detail::inclusive_scan<1, A>(self, std::integral_constant<bool, (1 < batch<T, A>::size)>{});
+    }
+
     // mul
     template<class A, class T, class/*=typename std::enable_if<std::is_integral<T>::value, void>::type*/>
     batch<T, A> mul(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
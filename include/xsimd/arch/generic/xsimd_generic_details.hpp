@@ -13,7 +13,10 @@
 #define XSIMD_GENERIC_DETAILS_HPP
 
 #include <complex>
+#include <cstdint>
+#include <limits>
 
+#include "../../types/xsimd_all_registers.hpp"
 #include "../../types/xsimd_generic_arch.hpp"
 #include "../../types/xsimd_utils.hpp"
 #include "../../math/xsimd_rem_pio2.hpp"
@@ -118,6 +121,59 @@ namespace xsimd {
       }
     }
 
+    namespace detail {
+      // Whether fma rounds once on the given architecture, as the error
+      // of a product is then fms(x, y, x * y). NEON only maps fma to
+      // vfmaq when the target has VFPv4 or is AArch64.
+      template <class A>
+      struct has_fused_fma
+        : std::integral_constant<bool, std::is_base_of<fma3, A>::value || std::is_base_of<fma5, A>::value
+                                       || std::is_base_of<avx512f, A>::value
+#ifdef __ARM_FEATURE_FMA
+                                       || std::is_base_of<neon, A>::value
+#endif
+                                       >
+      {
+      };
+
+      // s + err == a + b exactly (Knuth's TwoSum).
+      template <class B>
+      B two_sum(B const& a, B const& b, B& err)
+      {
+        B const s = a + b;
+        B const z = s - a;
+        err = (a - (s - z)) + (b - z);
+        return s;
+      }
+
+      // p + err == a * b exactly, p being the rounded product. The error
+      // is fms(a, b, p) when fma rounds once, and Dekker's product of the
+      // halves of the operands otherwise.
+      template <class B>
+      B two_product(B const& a, B const& b, B& err, std::true_type)
+      {
+        B const p = a * b;
+        err = fms(a, b, p);
+        return p;
+      }
+
+      template <class B>
+      B two_product(B const& a, B const& b, B& err, std::false_type)
+      {
+        using value_type = typename B::value_type;
+        B const factor(value_type(std::uint64_t(1) << ((std::numeric_limits<value_type>::digits + 1) / 2)) + value_type(1));
+        B const ca = factor * a;
+        B const a_hi = ca - (ca - a);
+        B const a_lo = a - a_hi;
+        B const cb = factor * b;
+        B const b_hi = cb - (cb - b);
+        B const b_lo = b - b_hi;
+        B const p = a * b;
+        err = ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+        return p;
+      }
+    }
+
     namespace detail {
       // Generic conversion handling machinery. Each architecture must define
       // conversion function when such conversions exits in the form of
@@ -136,7 +192,7 @@ namespace xsimd {
 
       template <class A, class From, class To>
       struct conversion_type_impl<A, From, To,
-                void_t<decltype(fast_cast(std::declval<const From&>(), std::declval<const To&>(), std::declval<const A&>()))>>
+                void_t<decltype(fast_cast(std::declval<const batch<From, A>&>(), std::declval<const batch<To, A>&>(), std::declval<const A&>()))>>
       {
           using type = with_fast_conversion;
       };
@@ -21,6 +21,19 @@ namespace xsimd {
 
     using namespace types;
 
+    // conflict
+    template<class A, class T> batch<T, A> conflict(batch<T, A> const& self, requires_arch<generic>) {
+      constexpr std::size_t size = batch<T, A>::size;
+      alignas(A::alignment()) T buffer[size];
+      alignas(A::alignment()) T res[size] = {};
+      self.store_aligned(&buffer[0]);
+      for(std::size_t i = 1; i < size; ++i)
+        for(std::size_t j = 0; j < i; ++j)
+          if(buffer[j] == buffer[i])
+            res[i] |= T(1) << j;
+      return batch<T, A>::load_aligned(&res[0]);
+    }
+
     // ge
     template<class A, class T> batch_bool<T, A> ge(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
       return other <= self;
@@ -83,6 +96,15 @@ namespace xsimd {
       return (self < other) || (self == other);
     }
 
+    // mask
+    template<class A, class T> uint64_t mask(batch_bool<T, A> const& self, requires_arch<generic>) {
+      alignas(A::alignment()) bool buffer[batch_bool<T, A>::size];
+      self.store_aligned(&buffer[0]);
+      uint64_t res = 0;
+      for(std::size_t i = 0; i < batch_bool<T, A>::size; ++i)
+        res |= buffer[i] ? uint64_t(1) << i : uint64_t(0);
+      return res;
+    }
 
     // neq
     template<class A, class T> batch_bool<T, A> neq(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
@@ -12,6 +12,7 @@
 #ifndef XSIMD_GENERIC_MATH_HPP
 #define XSIMD_GENERIC_MATH_HPP
 
+#include <array>
 #include <type_traits>
 
 #include "./xsimd_generic_details.hpp"
@@ -189,11 +190,36 @@ namespace xsimd {
 #endif
     }
 
+    namespace detail {
+      // replaces the lanes where self is NaN, integers never being NaN
+      template<class A, class T> batch<T, A> select_nan(batch<T, A> const& self, batch<T, A> const& if_nan, batch<T, A> const& otherwise, std::true_type) {
+        return select(isnan(self), if_nan, otherwise);
+      }
+      template<class A, class T> batch<T, A> select_nan(batch<T, A> const&, batch<T, A> const&, batch<T, A> const& otherwise, std::false_type) {
+        return otherwise;
+      }
+    }
+
     // clip
     template<class A, class T> batch<T, A> clip(batch<T, A> const& self, batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<generic>) {
       return min(hi, max(self, lo));
     }
 
+    // clip_fast
+    template<class A, class T> batch<T, A> clip_fast(batch<T, A> const& self, batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<generic>) {
+      return clip(self, lo, hi);
+    }
+
+    // clip_ignore_nan
+    template<class A, class T> batch<T, A> clip_ignore_nan(batch<T, A> const& self, batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<generic>) {
+      return detail::select_nan(self, lo, clip(self, lo, hi), std::is_floating_point<T>());
+    }
+
+    // clip_propagate_nan
+    template<class A, class T> batch<T, A> clip_propagate_nan(batch<T, A> const& self, batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<generic>) {
+      return detail::select_nan(self, self, clip(self, lo, hi), std::is_floating_point<T>());
+    }
+
 
     // copysign
     template<class A, class T> batch<T, A> copysign(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
@@ -829,6 +855,56 @@ namespace xsimd {
       return detail::exp<detail::exp2_tag>(self);
     }
 
+    // exp_fast
+    /*
+     * k = nearbyint(x / log(2)) is obtained by adding 1.5 * 2^p to x / log(2),
+     * which leaves k in the low bits of the sum, and the result is scaled by
+     * 2^k by adding these bits to its exponent. Arguments are clamped to the
+     * range where both exp(x) and exp(x - k * log(2)) * 2^k are normal.
+     */
+    template<class A> batch<float, A> exp_fast(batch<float, A> const& self, requires_arch<generic>) {
+      using batch_type = batch<float, A>;
+      using i_type = as_integer_t<batch_type>;
+      const batch_type shift = batch_type(1.5) * constants::twotonmb<batch_type>();
+      const batch_type x = min(max(self, batch_type(-86.5f)), batch_type(88.f));
+      const batch_type t = fma(x, constants::invlog_2<batch_type>(), shift);
+      const batch_type k = t - shift;
+      batch_type r = fnma(k, constants::log_2hi<batch_type>(), x);
+      r = fnma(k, constants::log_2lo<batch_type>(), r);
+      const batch_type y = detail::horner<batch_type,
+                   0x3f800000,  //  1.0000000e+00
+                   0x3f800000,  //  1.0000000e+00
+                   0x3efffeaf,  //  4.9998996e-01
+                   0x3e2aaa4a,  //  1.6666523e-01
+                   0x3d2bb1b7,  //  4.1917529e-02
+                   0x3c091ec3  //  8.3691506e-03
+                   >(r);
+      return ::xsimd::bitwise_cast<batch_type>(::xsimd::bitwise_cast<i_type>(y) + (::xsimd::bitwise_cast<i_type>(t) << constants::nmb<float>()));
+    }
+    template<class A> batch<double, A> exp_fast(batch<double, A> const& self, requires_arch<generic>) {
+      using batch_type = batch<double, A>;
+      using i_type = as_integer_t<batch_type>;
+      const batch_type shift = batch_type(1.5) * constants::twotonmb<batch_type>();
+      const batch_type x = min(max(self, batch_type(-707.)), batch_type(709.));
+      const batch_type t = fma(x, constants::invlog_2<batch_type>(), shift);
+      const batch_type k = t - shift;
+      batch_type r = fnma(k, constants::log_2hi<batch_type>(), x);
+      r = fnma(k, constants::log_2lo<batch_type>(), r);
+      const batch_type y = detail::horner<batch_type,
+                   0x3ff0000000000000ull,
+                   0x3ff0000000000000ull,
+                   0x3fdffffffffffed2ull,
+                   0x3fc55555555507c6ull,
+                   0x3fa55555555890a2ull,
+                   0x3f811111125b3d7aull,
+                   0x3f56c16c0c836739ull,
+                   0x3f2a0198d5887baaull,
+                   0x3efa01b7c4463bc8ull,
+                   0x3ec72e91ac3ca27cull,
+                   0x3e92707ae6de6948ull>(r);
+      return ::xsimd::bitwise_cast<batch_type>(::xsimd::bitwise_cast<i_type>(y) + (::xsimd::bitwise_cast<i_type>(t) << constants::nmb<double>()));
+    }
+
     // expm1
     namespace detail {
             /* origin: boost/simd/arch/common/detail/generic/expm1_kernel.hpp */
@@ -918,7 +994,7 @@ namespace xsimd {
 
     // fdim
     template<class A, class T> batch<T, A> fdim(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
-      return fmax(batch<T, A>(0), self - other);
+      return max_propagate_nan(batch<T, A>(0), self - other);
     }
 
     // fmod
@@ -1713,6 +1789,88 @@ namespace xsimd {
     }
 
 
+    // log_fast
+    /*
+     * x = 2^k * (1 + f), with 1 + f in [sqrt(2) / 2, sqrt(2)), without the
+     * scaling of denormals nor the handling of zeros, negative numbers and
+     * infinities.
+     */
+    template<class A> batch<float, A> log_fast(batch<float, A> const& self, requires_arch<generic>) {
+      using batch_type = batch<float, A>;
+      using i_type = as_integer_t<batch_type>;
+      i_type ix = ::xsimd::bitwise_cast<i_type>(self);
+      ix += 0x3f800000 - 0x3f3504f3;
+      const batch_type dk = to_float((ix >> 23) - 0x7f);
+      ix = (ix & i_type(0x007fffff)) + 0x3f3504f3;
+      const batch_type f = ::xsimd::bitwise_cast<batch_type>(ix) - batch_type(1.);
+      const batch_type y = detail::horner<batch_type,
+                   0xbf000000,  // -5.0000000e-01
+                   0x3eaaab98,  //  3.3334041e-01
+                   0xbe800102,  // -2.5000769e-01
+                   0x3e4c5c72,  //  1.9957140e-01
+                   0xbe29ee3f,  // -1.6594790e-01
+                   0x3e19a038,  //  1.5002525e-01
+                   0xbe10dc31,  // -1.4146496e-01
+                   0x3da9355f  //  8.2621329e-02
+                   >(f);
+      return fma(dk, constants::log_2hi<batch_type>(), fma(dk, constants::log_2lo<batch_type>(), fma(y, f * f, f)));
+    }
+    template<class A> batch<double, A> log_fast(batch<double, A> const& self, requires_arch<generic>) {
+      using batch_type = batch<double, A>;
+      using i_type = as_integer_t<batch_type>;
+      i_type hx = ::xsimd::bitwise_cast<i_type>(self) >> 32;
+      hx += 0x3ff00000 - 0x3fe6a09e;
+      const batch_type dk = to_float((hx >> 20) - 0x3ff);
+      hx = (hx & i_type(0x000fffff)) + 0x3fe6a09e;
+      const batch_type x = ::xsimd::bitwise_cast<batch_type>(hx << 32 | (i_type(0xffffffff) & ::xsimd::bitwise_cast<i_type>(self)));
+      const batch_type f = x - batch_type(1.);
+      const batch_type hfsq = batch_type(0.5) * f * f;
+      const batch_type s = f / (batch_type(2.) + f);
+      const batch_type z = s * s;
+      const batch_type R = z * detail::horner<batch_type,
+                   0x3fe555555555397aull,
+                   0x3fd999999a28ebf1ull,
+                   0x3fd2492417a7ca12ull,
+                   0x3fcc72276a789b20ull,
+                   0x3fc732c504fc6e75ull,
+                   0x3fc5875a5883b52cull>(z);
+      return fma(dk, constants::log_2hi<batch_type>(), fma(s, (hfsq + R), dk * constants::log_2lo<batch_type>()) - hfsq + f);
+    }
+
+    // max_fast
+    template<class A, class T> batch<T, A> max_fast(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
+      return max(self, other);
+    }
+
+    // max_ignore_nan
+    template<class A, class T> batch<T, A> max_ignore_nan(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
+      using is_fp = std::is_floating_point<T>;
+      return detail::select_nan(self, other, detail::select_nan(other, self, max(self, other), is_fp()), is_fp());
+    }
+
+    // max_propagate_nan
+    template<class A, class T> batch<T, A> max_propagate_nan(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
+      using is_fp = std::is_floating_point<T>;
+      return detail::select_nan(self, self, detail::select_nan(other, other, max(self, other), is_fp()), is_fp());
+    }
+
+    // min_fast
+    template<class A, class T> batch<T, A> min_fast(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
+      return min(self, other);
+    }
+
+    // min_ignore_nan
+    template<class A, class T> batch<T, A> min_ignore_nan(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
+      using is_fp = std::is_floating_point<T>;
+      return detail::select_nan(self, other, detail::select_nan(other, self, min(self, other), is_fp()), is_fp());
+    }
+
+    // min_propagate_nan
+    template<class A, class T> batch<T, A> min_propagate_nan(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
+      using is_fp = std::is_floating_point<T>;
+      return detail::select_nan(self, self, detail::select_nan(other, other, min(self, other), is_fp()), is_fp());
+    }
+
     // mod
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> mod(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) {
@@ -1720,6 +1878,21 @@ namespace xsimd {
     }
 
 
+    // narrow
+    template<class A, class T> batch<narrow_type_t<T>, A> narrow(batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<generic>) {
+      using out_type = narrow_type_t<T>;
+      constexpr std::size_t size = batch<T, A>::size;
+      static_assert(batch<out_type, A>::size == 2 * size, "compatible sizes");
+      alignas(A::alignment()) T buffer_in[2 * size];
+      alignas(A::alignment()) out_type buffer_out[2 * size];
+      lo.store_aligned(&buffer_in[0]);
+      hi.store_aligned(&buffer_in[size]);
+      for(std::size_t i = 0; i < 2 * size; ++i) {
+        buffer_out[i] = static_cast<out_type>(buffer_in[i]);
+      }
+      return batch<out_type, A>::load_aligned(buffer_out);
+    }
+
     // nearbyint
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> nearbyint(batch<T, A> const& self, requires_arch<generic>) {
@@ -1850,6 +2023,29 @@ namespace xsimd {
         }
 
 
+    // reciprocal
+    /*
+     * Estimates from the bits of x, subtracted from a constant, within 5.1%
+     * of the result. Each Newton-Raphson step then squares the relative
+     * error, the estimates of the architectures being used when available.
+     */
+    template<class A>
+    batch<float, A> reciprocal(batch<float, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<generic>) {
+      using i_type = as_integer_t<batch<float, A>>;
+      return ::xsimd::bitwise_cast<batch<float, A>>(i_type(0x7ef311c2) - ::xsimd::bitwise_cast<i_type>(self));
+    }
+    template<class A>
+    batch<double, A> reciprocal(batch<double, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<generic>) {
+      using i_type = as_integer_t<batch<double, A>>;
+      return ::xsimd::bitwise_cast<batch<double, A>>(i_type(0x7fde623840000000) - ::xsimd::bitwise_cast<i_type>(self));
+    }
+    template<class A, class T, std::size_t Steps>
+    batch<T, A> reciprocal(batch<T, A> const& self, std::integral_constant<std::size_t, Steps>, requires_arch<generic>) {
+      using batch_type = batch<T, A>;
+      const batch_type y = reciprocal(self, std::integral_constant<std::size_t, Steps - 1>(), A{});
+      return fma(y, fnma(self, y, batch_type(1.)), y);
+    }
+
     // remainder
     template<class A>
     batch<float, A> remainder(batch<float, A> const& self, batch<float, A> const& other, requires_arch<generic>) {
@@ -1865,6 +2061,25 @@ namespace xsimd {
       return select(mod <= other / 2, mod, mod - other);
     }
 
+    // rsqrt
+    // the estimates are within 3.5% of the result
+    template<class A>
+    batch<float, A> rsqrt(batch<float, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<generic>) {
+      using i_type = as_integer_t<batch<float, A>>;
+      return ::xsimd::bitwise_cast<batch<float, A>>(i_type(0x5f37642f) - (::xsimd::bitwise_cast<i_type>(self) >> 1));
+    }
+    template<class A>
+    batch<double, A> rsqrt(batch<double, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<generic>) {
+      using i_type = as_integer_t<batch<double, A>>;
+      return ::xsimd::bitwise_cast<batch<double, A>>(i_type(0x5fe6ec85e0000000) - (::xsimd::bitwise_cast<i_type>(self) >> 1));
+    }
+    template<class A, class T, std::size_t Steps>
+    batch<T, A> rsqrt(batch<T, A> const& self, std::integral_constant<std::size_t, Steps>, requires_arch<generic>) {
+      using batch_type = batch<T, A>;
+      const batch_type y = rsqrt(self, std::integral_constant<std::size_t, Steps - 1>(), A{});
+      return fma(y * batch_type(0.5), fnma(self * y, y, batch_type(1.)), y);
+    }
+
     // select
     template<class A, class T>
     batch<std::complex<T>, A> select(batch_bool<T, A> const& cond, batch<std::complex<T>, A> const& true_br, batch<std::complex<T>, A> const& false_br, requires_arch<generic>) {
@@ -2207,6 +2422,20 @@ namespace xsimd {
     }
 
 
+    // widen
+    template<class A, class T> std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& self, requires_arch<generic>) {
+      using out_type = widen_type_t<T>;
+      using batch_type = batch<out_type, A>;
+      constexpr std::size_t size = batch_type::size;
+      static_assert(batch<T, A>::size == 2 * size, "compatible sizes");
+      alignas(A::alignment()) T buffer_in[2 * size];
+      alignas(A::alignment()) out_type buffer_out[2 * size];
+      self.store_aligned(&buffer_in[0]);
+      std::copy(std::begin(buffer_in), std::end(buffer_in), std::begin(buffer_out));
+      return {{ batch_type::load_aligned(&buffer_out[0]), batch_type::load_aligned(&buffer_out[size]) }};
+    }
+
+
   }
 
 }
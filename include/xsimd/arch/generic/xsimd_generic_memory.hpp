@@ -25,6 +25,20 @@ namespace xsimd {
 
     using namespace types;
 
+    // compress
+    template<class A, class T> batch<T, A> compress(batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<generic>) {
+      constexpr std::size_t size = batch<T, A>::size;
+      alignas(A::alignment()) T buffer[size];
+      alignas(A::alignment()) T res[size] = {};
+      self.store_aligned(&buffer[0]);
+      uint64_t bits = mask.mask();
+      std::size_t j = 0;
+      for(std::size_t i = 0; i < size; ++i)
+        if((bits >> i) & 1)
+          res[j++] = buffer[i];
+      return batch<T, A>::load_aligned(&res[0]);
+    }
+
     // extract_pair
     template<class A, class T> batch<T, A> extract_pair(batch<T, A> const& self, batch<T, A> const& other, std::size_t i, requires_arch<generic>) {
       constexpr std::size_t size = batch<T, A>::size;
@@ -49,6 +63,46 @@ namespace xsimd {
           return batch<T, A>::load_aligned(concat_buffer);
     }
 
+    // gather
+    template<class A, class T, class U> batch<T, A> gather(T const* src, batch<U, A> const& index, requires_arch<generic>) {
+      constexpr std::size_t size = batch<T, A>::size;
+      alignas(A::alignment()) U indices[size];
+      alignas(A::alignment()) T res[size];
+      index.store_aligned(&indices[0]);
+      for(std::size_t i = 0; i < size; ++i)
+        res[i] = src[indices[i]];
+      return batch<T, A>::load_aligned(&res[0]);
+    }
+
+    // get
+    template<class A, class T, std::size_t I> T get(batch<T, A> const& self, ::xsimd::index<I>, requires_arch<generic>) {
+      alignas(A::alignment()) T buffer[batch<T, A>::size];
+      self.store_aligned(&buffer[0]);
+      return buffer[I];
+    }
+
+    template<class A, class T, std::size_t I> bool get(batch_bool<T, A> const& self, ::xsimd::index<I>, requires_arch<generic>) {
+      return kernel::get(batch<T, A>(self), ::xsimd::index<I>{}, A{}) != T(0);
+    }
+
+    template<class A, class T> T get(batch<T, A> const& self, std::size_t i, requires_arch<generic>) {
+      alignas(A::alignment()) T buffer[batch<T, A>::size];
+      self.store_aligned(&buffer[0]);
+      return buffer[i];
+    }
+
+    template<class A, class T> bool get(batch_bool<T, A> const& self, std::size_t i, requires_arch<generic>) {
+      return kernel::get(batch<T, A>(self), i, A{}) != T(0);
+    }
+
+    // insert
+    template<class A, class T, std::size_t I> batch<T, A> insert(batch<T, A> const& self, T val, ::xsimd::index<I>, requires_arch<generic>) {
+      alignas(A::alignment()) T buffer[batch<T, A>::size];
+      self.store_aligned(&buffer[0]);
+      buffer[I] = val;
+      return batch<T, A>::load_aligned(&buffer[0]);
+    }
+
     // load_aligned
     namespace detail {
       template<class A, class T_in, class T_out>
@@ -91,6 +145,39 @@ namespace xsimd {
       return detail::load_unaligned<A>(mem, cvt, generic{}, detail::conversion_type<A, T_in, T_out>{});
     }
 
+    // scatter
+    template<class A, class T, class U> void scatter(batch<T, A> const& self, T* dst, batch<U, A> const& index, requires_arch<generic>) {
+      constexpr std::size_t size = batch<T, A>::size;
+      alignas(A::alignment()) U indices[size];
+      alignas(A::alignment()) T values[size];
+      index.store_aligned(&indices[0]);
+      self.store_aligned(&values[0]);
+      for(std::size_t i = 0; i < size; ++i)
+        dst[indices[i]] = values[i];
+    }
+
+    // slide_left
+    template<size_t N, class A> batch<uint8_t, A> slide_left(batch<uint8_t, A> const& self, requires_arch<generic>) {
+      constexpr std::size_t size = batch<uint8_t, A>::size;
+      alignas(A::alignment()) uint8_t buffer[size];
+      alignas(A::alignment()) uint8_t res[size];
+      self.store_aligned(&buffer[0]);
+      for(std::size_t i = 0; i < size; ++i)
+        res[i] = i < N ? 0 : buffer[i - N];
+      return batch<uint8_t, A>::load_aligned(&res[0]);
+    }
+
+    // slide_right
+    template<size_t N, class A> batch<uint8_t, A> slide_right(batch<uint8_t, A> const& self, requires_arch<generic>) {
+      constexpr std::size_t size = batch<uint8_t, A>::size;
+      alignas(A::alignment()) uint8_t buffer[size];
+      alignas(A::alignment()) uint8_t res[size];
+      self.store_aligned(&buffer[0]);
+      for(std::size_t i = 0; i < size; ++i)
+        res[i] = i + N < size ? buffer[i + N] : 0;
+      return batch<uint8_t, A>::load_aligned(&res[0]);
+    }
+
     // store
     template<class T, class A>
     void store(batch_bool<T, A> const& self, bool* mem, requires_arch<generic>) {
@@ -103,6 +190,17 @@ namespace xsimd {
     }
 
 
+    // swizzle
+    template<class A, class T, class ITy, ITy... Vs>
+    batch<T, A> swizzle(batch<T, A> const& self, batch_constant<batch<ITy, A>, Vs...>, requires_arch<generic>) {
+      constexpr std::size_t size = batch<T, A>::size;
+      alignas(A::alignment()) T buffer[size];
+      self.store_aligned(&buffer[0]);
+      alignas(A::alignment()) T res[size] = {buffer[Vs]...};
+      return batch<T, A>::load_aligned(&res[0]);
+    }
+
+
     // store_aligned
     template<class A, class T_in, class T_out> void store_aligned(T_out *mem, batch<T_in, A> const& self, requires_arch<generic>) {
       static_assert(!std::is_same<T_in, T_out>::value, "there should be a direct store for this type combination");
@@ -515,6 +515,79 @@ namespace xsimd {
          * ====================================================
          */
 
+        /*
+         * Payne-Hanek reduction: x * 2/pi is computed from the chunks
+         * of 2/pi of the exponent group of each lane, gathered from
+         * two_over_pi_chunks, as a sum of exact products whose integer
+         * parts are dropped modulo 4 as soon as they appear, so that
+         * the fraction left keeps its full precision even when x is
+         * very close to a multiple of pi/2. Exact for x above 2^17 in
+         * double precision and 2 in single precision. The rounding
+         * errors of the products are given by fms when Fused is
+         * std::true_type, by Dekker's splitting otherwise.
+         */
+        template <class B, class Fused>
+        B payne_hanek_reduce(const B& x, B& xr, Fused fused)
+        {
+            using value_type = typename B::value_type;
+            using int_type = as_integer_t<value_type>;
+            using arch_type = typename B::arch_type;
+            using int_batch = batch<int_type, arch_type>;
+            constexpr int mantissa = std::numeric_limits<value_type>::digits - 1;
+            constexpr int bias = std::numeric_limits<value_type>::max_exponent - 1;
+            constexpr int group_shift = sizeof(value_type) == sizeof(float) ? 3 : 4;
+            constexpr int first_group = sizeof(value_type) == sizeof(float) ? 16 : 65;
+
+            // x * 2^-E', E' being the lowest exponent of the group
+            const int_batch group = max(bitwise_cast<int_batch>(x) >> (mantissa + group_shift), int_batch(first_group));
+            const B xs = x * bitwise_cast<B>((int_batch(2 * bias + mantissa) - (group << group_shift)) << mantissa);
+
+            const value_type* chunks = ::xsimd::detail::two_over_pi_chunks(value_type());
+            const int_batch index = (group - int_batch(first_group)) << 2;
+            const B c0 = gather(chunks, index);
+            const B c1 = gather(chunks, index + int_batch(1));
+            const B c2 = gather(chunks, index + int_batch(2));
+            const B c3 = gather(chunks, index + int_batch(3));
+
+            B l0, l1, l2;
+            const B h0 = two_product(xs, c0, l0, fused);
+            const B h1 = two_product(xs, c1, l1, fused);
+            const B h2 = two_product(xs, c2, l2, fused);
+
+            // the integer parts, up to 2^(p+17), are kept modulo 4
+            B n = nearbyint(h0);
+            B s = h0 - n;
+            n -= B(4.) * floor(n * B(0.25));
+            B k = nearbyint(l0);
+            const B a = l0 - k;
+            n += k;
+            k = nearbyint(h1);
+            const B b = h1 - k;
+            n += k;
+
+            B e0, e1, e;
+            s = two_sum(s, a, e0);
+            s = two_sum(s, b, e1);
+            k = nearbyint(s);
+            n += k;
+            s -= k;
+
+            // s is now within [-0.5, 0.5], the smaller terms are added
+            // with their rounding errors
+            s = two_sum(s, e0, e);
+            B err = e;
+            s = two_sum(s, e1, e);
+            err += e;
+            s = two_sum(s, l1, e);
+            err += e;
+            s = two_sum(s, h2, e);
+            err += e;
+            err += fma(xs, c3, l2);
+
+            xr = fma(s, constants::pio2<B>(), fma(s, constants::pio_2lo<B>(), err * constants::pio2<B>()));
+            return quadrant(n);
+        }
+
         struct trigo_radian_tag
         {
         };
@@ -551,60 +624,53 @@ namespace xsimd {
                 }
                 else if (all(x <= constants::mediumpi<B>()))
                 {
-                    B fn = nearbyint(x * constants::twoopi<B>());
-                    B r = x - fn * constants::pio2_1<B>();
-                    B w = fn * constants::pio2_1t<B>();
-                    B t = r;
-                    w = fn * constants::pio2_2<B>();
-                    r = t - w;
-                    w = fn * constants::pio2_2t<B>() - ((t - r) - w);
-                    t = r;
-                    w = fn * constants::pio2_3<B>();
-                    r = t - w;
-                    w = fn * constants::pio2_3t<B>() - ((t - r) - w);
-                    xr = r - w;
-                    return quadrant(fn);
+                    return medium_reduce(x, xr);
                 }
                 else
                 {
-                    static constexpr std::size_t size = B::size;
-                    using value_type = typename B::value_type;
-                    alignas(B) std::array<value_type, size> tmp;
-                    alignas(B) std::array<value_type, size> txr;
-                    alignas(B) std::array<value_type, size> args;
-                    x.store_aligned(args.data());
-
-                    for (std::size_t i = 0; i < size; ++i)
-                    {
-                        double arg = args[i];
-                        if (arg == std::numeric_limits<value_type>::infinity())
-                        {
-                            tmp[i] = 0.;
-                            txr[i] = std::numeric_limits<value_type>::quiet_NaN();
-                        }
-                        else
-                        {
-                            double y[2];
-                            std::int32_t n = ::xsimd::detail::__ieee754_rem_pio2(arg, y);
-                            tmp[i] = value_type(n & 3);
-                            txr[i] = value_type(y[0]);
-                        }
-                    }
-                    xr = B::load_aligned(&txr[0]);
-                    B res = B::load_aligned(&tmp[0]);
-                    return res;
+                    B xr_medium;
+                    const B n_medium = medium_reduce(x, xr_medium);
+                    const B n = payne_hanek_reduce(x, xr, has_fused_fma<typename B::arch_type>());
+                    const auto test = x <= constants::mediumpi<B>();
+                    xr = select(test, xr_medium, xr);
+                    return select(test, n_medium, n);
                 }
             }
+
+        private:
+            static inline B medium_reduce(const B& x, B& xr)
+            {
+                B fn = nearbyint(x * constants::twoopi<B>());
+                B r = x - fn * constants::pio2_1<B>();
+                B w = fn * constants::pio2_1t<B>();
+                B t = r;
+                w = fn * constants::pio2_2<B>();
+                r = t - w;
+                w = fn * constants::pio2_2t<B>() - ((t - r) - w);
+                t = r;
+                w = fn * constants::pio2_3<B>();
+                r = t - w;
+                w = fn * constants::pio2_3t<B>() - ((t - r) - w);
+                xr = r - w;
+                return quadrant(fn);
+            }
         };
 
+        /*
+         * x is reduced to a multiple of 0.5 and a remainder in
+         * [-0.25, 0.25], both exact, the remainder being then multiplied
+         * by pi in extended precision. Values from 2^(p+1) are even
+         * integers and are replaced by zero, and infinities by NaN.
+         */
         template <class B>
         struct trigo_reducer<B, trigo_pi_tag>
         {
             static inline B reduce(const B& x, B& xr)
             {
-                B xi = nearbyint(x * B(2.));
-                B x2 = x - xi * B(0.5);
-                xr = x2 * constants::pi<B>();
+                const B xs = select(x >= B(2.) * constants::twotonmb<B>(), x * B(0.), x);
+                B xi = nearbyint(xs * B(2.));
+                B x2 = fnma(xi, B(0.5), xs);
+                xr = fma(x2, constants::pi<B>(), x2 * (B(2.) * constants::pio_2lo<B>()));
                 return quadrant(xi);
             }
         };
@@ -629,6 +695,81 @@ namespace xsimd {
       return {cos(z.real()) * cosh(z.imag()), -sin(z.real()) * sinh(z.imag())};
     }
 
+    // cos_fast
+    namespace detail {
+        template<class A>
+        inline batch<float, A> cos_fast_eval(const batch<float, A>& z)
+        {
+          using batch_type = batch<float, A>;
+            batch_type y = detail::horner<batch_type,
+                         0x3d2aa4cd,
+                         0xbab2e57c>(z);
+            return batch_type(1.) + fma(z, batch_type(-0.5), y * z * z);
+        }
+
+        template<class A>
+        inline batch<double, A> cos_fast_eval(const batch<double, A>& z)
+        {
+          using batch_type = batch<double, A>;
+            batch_type y = detail::horner<batch_type,
+                         0x3fa5555555552ddbull,
+                         0xbf56c16c1672110full,
+                         0x3efa019fa5ffbdabull,
+                         0xbe927e00b911e464ull,
+                         0x3e21bbe8e3f8e331ull>(z);
+            return batch_type(1.) + fma(z, batch_type(-0.5), y * z * z);
+        }
+
+        /*
+         * Cody-Waite reduction by k * pi/2, the products by the first two
+         * parts of pi/2 being exact, with or without fma, for |k| < 2^12 in
+         * single precision and |k| < 2^20 in double precision.
+         */
+        template<class A>
+        inline batch<float, A> trigo_fast_reduce(const batch<float, A>& x, const batch<float, A>& k)
+        {
+          using batch_type = batch<float, A>;
+            batch_type xr = fnma(k, detail::coef<batch_type, 0x3fc91000>(), x);
+            xr = fnma(k, detail::coef<batch_type, 0xb6957000>(), xr);
+            return fnma(k, detail::coef<batch_type, 0xb06f4b9f>(), xr);
+        }
+
+        template<class A>
+        inline batch<double, A> trigo_fast_reduce(const batch<double, A>& x, const batch<double, A>& k)
+        {
+          using batch_type = batch<double, A>;
+            batch_type xr = fnma(k, constants::pio2_1<batch_type>(), x);
+            xr = fnma(k, constants::pio2_2<batch_type>(), xr);
+            return fnma(k, constants::pio2_2t<batch_type>(), xr);
+        }
+
+        /*
+         * The quadrant is read from the low bits of x * 2/pi + 1.5 * 2^p, and
+         * x is reduced in a single step whatever its magnitude. offset is 0
+         * for the sine and 1 for the cosine.
+         */
+        template<class A, class T>
+        inline batch<T, A> trigo_fast(batch<T, A> const& self, as_integer_t<T> offset)
+        {
+          using batch_type = batch<T, A>;
+          using i_type = as_integer_t<batch_type>;
+            const batch_type shift = batch_type(1.5) * constants::twotonmb<batch_type>();
+            const batch_type t = fma(self, constants::twoopi<batch_type>(), shift);
+            const batch_type k = t - shift;
+            const batch_type xr = trigo_fast_reduce(self, k);
+            const i_type n = ::xsimd::bitwise_cast<i_type>(t) + i_type(offset);
+            const batch_type z = xr * xr;
+            const batch_type se = detail::sin_eval(z, xr);
+            const batch_type ce = detail::cos_fast_eval(z);
+            const batch_type z1 = select(bool_cast((n & i_type(1)) != i_type(0)), ce, se);
+            return z1 ^ ::xsimd::bitwise_cast<batch_type>((n & i_type(2)) << (8 * sizeof(T) - 2));
+        }
+    }
+
+    template<class A, class T> batch<T, A> cos_fast(batch<T, A> const& self, requires_arch<generic>) {
+      return detail::trigo_fast(self, 1);
+    }
+
     // cosh
 
     /* origin: boost/simd/arch/common/simd/function/cosh.hpp */
@@ -659,6 +800,23 @@ namespace xsimd {
         }
 
 
+    // cospi
+    template<class A, class T> batch<T, A> cospi(batch<T, A> const& self, requires_arch<generic>) {
+      using batch_type = batch<T, A>;
+                const batch_type x = abs(self);
+                batch_type xr = constants::nan<batch_type>();
+                const batch_type n = detail::trigo_reducer<batch_type, detail::trigo_pi_tag>::reduce(x, xr);
+                auto tmp = select(n >= batch_type(2.), batch_type(1.), batch_type(0.));
+                auto swap_bit = fma(batch_type(-2.), tmp, n);
+                auto sign_bit = select((swap_bit ^ tmp) != batch_type(0.), constants::signmask<batch_type>(), batch_type(0.));
+                const batch_type z = xr * xr;
+                const batch_type se = detail::sin_eval(z, xr);
+                const batch_type ce = detail::cos_eval(z);
+                const batch_type z1 = select(swap_bit != batch_type(0.), se, ce);
+                // the zeros of odd multiples of 0.5 are positive
+                return (z1 ^ sign_bit) + batch_type(0.);
+    }
+
     // sin
     namespace detail {
     template<class A, class T, class Tag=trigo_radian_tag> batch<T, A> sin(batch<T, A> const& self, Tag = Tag()) {
@@ -685,6 +843,11 @@ namespace xsimd {
       return {sin(z.real()) * cosh(z.imag()), cos(z.real()) * sinh(z.imag())};
     }
 
+    // sin_fast
+    template<class A, class T> batch<T, A> sin_fast(batch<T, A> const& self, requires_arch<generic>) {
+      return detail::trigo_fast(self, 0);
+    }
+
     // sincos
     template<class A, class T> std::pair<batch<T, A>, batch<T, A>> sincos(batch<T, A> const& self, requires_arch<generic>) {
       using batch_type = batch<T, A>;
@@ -715,6 +878,24 @@ namespace xsimd {
             return std::make_pair(batch_type(rsin * icosh, rcos * isinh), batch_type(rcos * icosh, -rsin * isinh));
     }
 
+    // sincospi
+    template<class A, class T> std::pair<batch<T, A>, batch<T, A>> sincospi(batch<T, A> const& self, requires_arch<generic>) {
+      using batch_type = batch<T, A>;
+                const batch_type x = abs(self);
+                batch_type xr = constants::nan<batch_type>();
+                const batch_type n = detail::trigo_reducer<batch_type, detail::trigo_pi_tag>::reduce(x, xr);
+                auto tmp = select(n >= batch_type(2.), batch_type(1.), batch_type(0.));
+                auto swap_bit = fma(batch_type(-2.), tmp, n);
+                const batch_type z = xr * xr;
+                const batch_type se = detail::sin_eval(z, xr);
+                const batch_type ce = detail::cos_eval(z);
+                auto sin_sign_bit = select(tmp != batch_type(0.), constants::signmask<batch_type>(), batch_type(0.));
+                const batch_type sin_z1 = select(swap_bit == batch_type(0.), se, ce);
+                auto cos_sign_bit = select((swap_bit ^ tmp) != batch_type(0.), constants::signmask<batch_type>(), batch_type(0.));
+                const batch_type cos_z1 = select(swap_bit != batch_type(0.), se, ce);
+                return std::make_pair(((sin_z1 ^ sin_sign_bit) + batch_type(0.)) ^ bitofsign(self), (cos_z1 ^ cos_sign_bit) + batch_type(0.));
+    }
+
     // sinh
     namespace detail {
         /* origin: boost/simd/arch/common/detail/generic/sinh_kernel.hpp */
@@ -793,6 +974,23 @@ namespace xsimd {
             return {sinh(x) * cos(y), cosh(x) * sin(y)};
         }
 
+    // sinpi
+    template<class A, class T> batch<T, A> sinpi(batch<T, A> const& self, requires_arch<generic>) {
+      using batch_type = batch<T, A>;
+                const batch_type x = abs(self);
+                batch_type xr = constants::nan<batch_type>();
+                const batch_type n = detail::trigo_reducer<batch_type, detail::trigo_pi_tag>::reduce(x, xr);
+                auto tmp = select(n >= batch_type(2.), batch_type(1.), batch_type(0.));
+                auto swap_bit = fma(batch_type(-2.), tmp, n);
+                auto sign_bit = select(tmp != batch_type(0.), constants::signmask<batch_type>(), batch_type(0.));
+                const batch_type z = xr * xr;
+                const batch_type se = detail::sin_eval(z, xr);
+                const batch_type ce = detail::cos_eval(z);
+                const batch_type z1 = select(swap_bit == batch_type(0.), se, ce);
+                // the zeros of integers have the sign of the argument
+                return ((z1 ^ sign_bit) + batch_type(0.)) ^ bitofsign(self);
+    }
+
     // tan
     template<class A, class T> batch<T, A> tan(batch<T, A> const& self, requires_arch<generic>) {
       using batch_type = batch<T, A>;
@@ -928,6 +1126,22 @@ namespace xsimd {
             return {sinh(two * x) / d, sin(two * y) / d};
         }
 
+    // tanpi
+    template<class A, class T> batch<T, A> tanpi(batch<T, A> const& self, requires_arch<generic>) {
+      using batch_type = batch<T, A>;
+                const batch_type x = abs(self);
+                batch_type xr = constants::nan<batch_type>();
+                const batch_type n = detail::trigo_reducer<batch_type, detail::trigo_pi_tag>::reduce(x, xr);
+                auto tmp = select(n >= batch_type(2.), batch_type(1.), batch_type(0.));
+                auto swap_bit = fma(batch_type(-2.), tmp, n);
+                auto test = (swap_bit == batch_type(0.));
+                const batch_type y = detail::tan_eval(xr, test);
+                // the zeros of integers and the infinities of odd multiples
+                // of 0.5 are negative when the integer part of |x| is odd
+                auto sign_bit = select(tmp != batch_type(0.), constants::signmask<batch_type>(), batch_type(0.));
+                return select(xr == batch_type(0.), abs(y) ^ sign_bit, y) ^ bitofsign(self);
+    }
+
   }
 
 }
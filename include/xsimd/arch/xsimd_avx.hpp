@@ -12,6 +12,7 @@
 #ifndef XSIMD_AVX_HPP
 #define XSIMD_AVX_HPP
 
+#include <array>
 #include <complex>
 #include <limits>
 #include <type_traits>
@@ -327,6 +328,11 @@ namespace xsimd {
       return _mm256_set1_pd(val);
     }
 
+    // compress
+    template<class A, class T> batch<T, A> compress(batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx>) {
+      return compress(self, mask, generic{});
+    }
+
     // ceil
     template<class A> batch<float, A> ceil(batch<float, A> const& self, requires_arch<avx>) {
       return _mm256_ceil_ps(self);
@@ -380,6 +386,23 @@ namespace xsimd {
                 return get_half_complex_d<1>(self.real(), self.imag());
         }
     }
+
+    // clip_ignore_nan
+    template<class A> batch<float, A> clip_ignore_nan(batch<float, A> const& self, batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<avx>) {
+      return _mm256_min_ps(_mm256_max_ps(self, lo), hi);
+    }
+    template<class A> batch<double, A> clip_ignore_nan(batch<double, A> const& self, batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<avx>) {
+      return _mm256_min_pd(_mm256_max_pd(self, lo), hi);
+    }
+
+    // clip_propagate_nan
+    template<class A> batch<float, A> clip_propagate_nan(batch<float, A> const& self, batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<avx>) {
+      return _mm256_min_ps(hi, _mm256_max_ps(lo, self));
+    }
+    template<class A> batch<double, A> clip_propagate_nan(batch<double, A> const& self, batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<avx>) {
+      return _mm256_min_pd(hi, _mm256_max_pd(lo, self));
+    }
+
     // convert
     namespace detail {
     template<class A> batch<float, A> fast_cast(batch<int32_t, A> const& self, batch<float, A> const&, requires_arch<avx>) {
@@ -453,6 +476,24 @@ namespace xsimd {
       return detail::fwd_to_sse([](__m128i s, __m128i o) { return ge(batch<T, sse4_2>(s), batch<T, sse4_2>(o)); }, self, other);
     }
 
+    // get
+    template<class A, std::size_t I> float get(batch<float, A> const& self, ::xsimd::index<I>, requires_arch<avx>) {
+      constexpr std::size_t half_size = batch<float, sse4_2>::size;
+      __m128 half = _mm256_extractf128_ps(self, I / half_size);
+      return get(batch<float, sse4_2>(half), ::xsimd::index<I % half_size>{}, sse4_2{});
+    }
+    template<class A, std::size_t I> double get(batch<double, A> const& self, ::xsimd::index<I>, requires_arch<avx>) {
+      constexpr std::size_t half_size = batch<double, sse4_2>::size;
+      __m128d half = _mm256_extractf128_pd(self, I / half_size);
+      return get(batch<double, sse4_2>(half), ::xsimd::index<I % half_size>{}, sse4_2{});
+    }
+    template<class A, class T, std::size_t I, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    T get(batch<T, A> const& self, ::xsimd::index<I>, requires_arch<avx>) {
+      constexpr std::size_t half_size = batch<T, sse4_2>::size;
+      __m128i half = _mm256_extractf128_si256(self, I / half_size);
+      return get(batch<T, sse4_2>(half), ::xsimd::index<I % half_size>{}, sse4_2{});
+    }
+
     // gt
     template<class A> batch_bool<float, A> gt(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
       return _mm256_cmp_ps(self, other, _CMP_GT_OQ);
@@ -542,6 +583,27 @@ namespace xsimd {
                 return _mm256_add_pd(tmp1, tmp2);
     }
 
+    // insert
+    template<class A, std::size_t I> batch<float, A> insert(batch<float, A> const& self, float val, ::xsimd::index<I>, requires_arch<avx>) {
+      constexpr std::size_t half_size = batch<float, sse4_2>::size;
+      __m128 half = _mm256_extractf128_ps(self, I / half_size);
+      half = insert(batch<float, sse4_2>(half), val, ::xsimd::index<I % half_size>{}, sse4_2{});
+      return _mm256_insertf128_ps(self, half, I / half_size);
+    }
+    template<class A, std::size_t I> batch<double, A> insert(batch<double, A> const& self, double val, ::xsimd::index<I>, requires_arch<avx>) {
+      constexpr std::size_t half_size = batch<double, sse4_2>::size;
+      __m128d half = _mm256_extractf128_pd(self, I / half_size);
+      half = insert(batch<double, sse4_2>(half), val, ::xsimd::index<I % half_size>{}, sse4_2{});
+      return _mm256_insertf128_pd(self, half, I / half_size);
+    }
+    template<class A, class T, std::size_t I, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> insert(batch<T, A> const& self, T val, ::xsimd::index<I>, requires_arch<avx>) {
+      constexpr std::size_t half_size = batch<T, sse4_2>::size;
+      __m128i half = _mm256_extractf128_si256(self, I / half_size);
+      half = insert(batch<T, sse4_2>(half), val, ::xsimd::index<I % half_size>{}, sse4_2{});
+      return _mm256_insertf128_si256(self, half, I / half_size);
+    }
+
     // isnan
     template<class A> batch_bool<float, A> isnan(batch<float, A> const& self, requires_arch<avx>) {
                 return _mm256_cmp_ps(self, self, _CMP_UNORD_Q);
@@ -633,6 +695,30 @@ namespace xsimd {
       return detail::fwd_to_sse([](__m128i s, __m128i o) { return lt(batch<T, sse4_2>(s), batch<T, sse4_2>(o)); }, self, other);
     }
 
+    // mask
+    template<class A> uint64_t mask(batch_bool<float, A> const& self, requires_arch<avx>) {
+      return _mm256_movemask_ps(self);
+    }
+    template<class A> uint64_t mask(batch_bool<double, A> const& self, requires_arch<avx>) {
+      return _mm256_movemask_pd(self);
+    }
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    uint64_t mask(batch_bool<T, A> const& self, requires_arch<avx>) {
+      switch(sizeof(T)) {
+        case 1:
+        case 2: {
+          __m128i self_low, self_high;
+          detail::split_avx(self, self_low, self_high);
+          uint64_t mask_low = mask(batch_bool<T, sse4_2>(self_low), sse4_2{});
+          uint64_t mask_high = mask(batch_bool<T, sse4_2>(self_high), sse4_2{});
+          return mask_low | (mask_high << batch_bool<T, sse4_2>::size);
+        }
+        case 4: return _mm256_movemask_ps(_mm256_castsi256_ps(self));
+        case 8: return _mm256_movemask_pd(_mm256_castsi256_pd(self));
+        default: assert(false && "unsupported arch/op combination"); return {};
+      }
+    }
+
     // max
     template<class A> batch<float, A> max(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
       return _mm256_max_ps(self, other);
@@ -645,6 +731,22 @@ namespace xsimd {
       return select(self > other, self, other);
     }
 
+    // max_ignore_nan
+    template<class A> batch<float, A> max_ignore_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
+      return select(isnan(other), self, batch<float, A>(_mm256_max_ps(self, other)));
+    }
+    template<class A> batch<double, A> max_ignore_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx>) {
+      return select(isnan(other), self, batch<double, A>(_mm256_max_pd(self, other)));
+    }
+
+    // max_propagate_nan
+    template<class A> batch<float, A> max_propagate_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
+      return _mm256_or_ps(_mm256_max_ps(self, other), _mm256_cmp_ps(self, self, _CMP_UNORD_Q));
+    }
+    template<class A> batch<double, A> max_propagate_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx>) {
+      return _mm256_or_pd(_mm256_max_pd(self, other), _mm256_cmp_pd(self, self, _CMP_UNORD_Q));
+    }
+
     // min
     template<class A> batch<float, A> min(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
       return _mm256_min_ps(self, other);
@@ -657,6 +759,22 @@ namespace xsimd {
       return select(self <= other, self, other);
     }
 
+    // min_ignore_nan
+    template<class A> batch<float, A> min_ignore_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
+      return select(isnan(other), self, batch<float, A>(_mm256_min_ps(self, other)));
+    }
+    template<class A> batch<double, A> min_ignore_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx>) {
+      return select(isnan(other), self, batch<double, A>(_mm256_min_pd(self, other)));
+    }
+
+    // min_propagate_nan
+    template<class A> batch<float, A> min_propagate_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
+      return _mm256_or_ps(_mm256_min_ps(self, other), _mm256_cmp_ps(self, self, _CMP_UNORD_Q));
+    }
+    template<class A> batch<double, A> min_propagate_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx>) {
+      return _mm256_or_pd(_mm256_min_pd(self, other), _mm256_cmp_pd(self, self, _CMP_UNORD_Q));
+    }
+
     // mul
     template<class A> batch<float, A> mul(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
       return _mm256_mul_ps(self, other);
@@ -673,6 +791,19 @@ namespace xsimd {
       return _mm256_round_pd(self, _MM_FROUND_TO_NEAREST_INT);
     }
 
+    // narrow
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<narrow_type_t<T>, A> narrow(batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<avx>) {
+      __m128i lo_low, lo_high, hi_low, hi_high;
+      detail::split_avx(lo, lo_low, lo_high);
+      detail::split_avx(hi, hi_low, hi_high);
+      return detail::merge_sse(narrow(batch<T, sse4_2>(lo_low), batch<T, sse4_2>(lo_high), sse4_2{}),
+                               narrow(batch<T, sse4_2>(hi_low), batch<T, sse4_2>(hi_high), sse4_2{}));
+    }
+    template<class A> batch<float, A> narrow(batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<avx>) {
+      return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)), _mm256_cvtpd_ps(hi), 1);
+    }
+
     // neg
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> neg(batch<T, A> const& self, requires_arch<avx>) {
@@ -688,10 +819,10 @@ namespace xsimd {
 
     // neq
     template<class A> batch_bool<float, A> neq(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
-      return _mm256_cmp_ps(self, other, _CMP_NEQ_OQ);
+      return _mm256_cmp_ps(self, other, _CMP_NEQ_UQ);
     }
     template<class A> batch_bool<double, A> neq(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx>) {
-      return _mm256_cmp_pd(self, other, _CMP_NEQ_OQ);
+      return _mm256_cmp_pd(self, other, _CMP_NEQ_UQ);
     }
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch_bool<T, A> neq(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx>) {
@@ -710,6 +841,16 @@ namespace xsimd {
         return ~(self == other);
     }
 
+    // reciprocal
+    template<class A> batch<float, A> reciprocal(batch<float, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<avx>) {
+      return _mm256_rcp_ps(self);
+    }
+
+    // rsqrt
+    template<class A> batch<float, A> rsqrt(batch<float, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<avx>) {
+      return _mm256_rsqrt_ps(self);
+    }
+
     // sadd
     template<class A> batch<float, A> sadd(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx>) {
       return add(self, other); // no saturated arithmetic on floating point numbers
@@ -807,6 +948,32 @@ namespace xsimd {
       return _mm256_castsi256_pd(set(batch<int64_t, A>(), A{},  static_cast<int64_t>(values ? -1LL : 0LL )...).data);
     }
 
+    // slide_left
+    template<size_t N, class A> batch<uint8_t, A> slide_left(batch<uint8_t, A> const& self, requires_arch<avx>) {
+      __m128i self_low, self_high;
+      detail::split_avx(self, self_low, self_high);
+      if(N < 16) {
+        // the high half takes the last bytes of the low one
+        constexpr int n = N < 16 ? N : 0;
+        return detail::merge_sse(_mm_slli_si128(self_low, n), _mm_alignr_epi8(self_high, self_low, 16 - n));
+      }
+      constexpr int n = N >= 16 && N < 32 ? N - 16 : 16;
+      return detail::merge_sse(_mm_setzero_si128(), _mm_slli_si128(self_low, n));
+    }
+
+    // slide_right
+    template<size_t N, class A> batch<uint8_t, A> slide_right(batch<uint8_t, A> const& self, requires_arch<avx>) {
+      __m128i self_low, self_high;
+      detail::split_avx(self, self_low, self_high);
+      if(N < 16) {
+        // the low half takes the first bytes of the high one
+        constexpr int n = N < 16 ? N : 0;
+        return detail::merge_sse(_mm_alignr_epi8(self_high, self_low, n), _mm_srli_si128(self_high, n));
+      }
+      constexpr int n = N >= 16 && N < 32 ? N - 16 : 16;
+      return detail::merge_sse(_mm_srli_si128(self_high, n), _mm_setzero_si128());
+    }
+
     // sqrt
     template<class A> batch<float, A> sqrt(batch<float, A> const& val, requires_arch<avx>) {
       return _mm256_sqrt_ps(val);
@@ -918,6 +1085,20 @@ namespace xsimd {
       return _mm256_round_pd(self, _MM_FROUND_TO_ZERO);
     }
 
+    // widen
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& self, requires_arch<avx>) {
+      using batch_type = batch<widen_type_t<T>, A>;
+      __m128i self_low, self_high;
+      detail::split_avx(self, self_low, self_high);
+      auto low = widen(batch<T, sse4_2>(self_low), sse4_2{});
+      auto high = widen(batch<T, sse4_2>(self_high), sse4_2{});
+      return {{ batch_type(detail::merge_sse(low[0], low[1])), batch_type(detail::merge_sse(high[0], high[1])) }};
+    }
+    template<class A> std::array<batch<double, A>, 2> widen(batch<float, A> const& self, requires_arch<avx>) {
+      return {{ batch<double, A>(_mm256_cvtps_pd(_mm256_castps256_ps128(self))), batch<double, A>(_mm256_cvtps_pd(_mm256_extractf128_ps(self, 1))) }};
+    }
+
     // zip_hi
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> zip_hi(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx>) {
@@ -12,6 +12,7 @@
 #ifndef XSIMD_AVX2_HPP
 #define XSIMD_AVX2_HPP
 
+#include <array>
 #include <complex>
 #include <type_traits>
 
@@ -140,6 +141,57 @@ namespace xsimd {
             return _mm256_blend_pd(tmp0, tmp1, 10);
     }
 
+    // compress
+    namespace detail {
+
+      // 4-bit fields holding the indices of the 32-bit lanes selected by
+      // the 8-bit mask m, 8 for the fields past them
+      constexpr uint32_t compress_nibble(uint32_t m, uint32_t s) {
+        return nth_set_bit(m, s) < 8 ? nth_set_bit(m, s) : 8;
+      }
+
+      constexpr uint32_t compress_nibbles(uint32_t m, uint32_t s = 0) {
+        return s == 8 ? 0 : (compress_nibble(m, s) << (4 * s)) | compress_nibbles(m, s + 1);
+      }
+
+      template<std::size_t... Ms>
+      struct compress_table_epi32 {
+        static constexpr uint32_t value[sizeof...(Ms)] = {compress_nibbles(Ms)...};
+      };
+
+      template<std::size_t... Ms>
+      constexpr uint32_t compress_table_epi32<Ms...>::value[sizeof...(Ms)];
+
+      template<std::size_t... Ms>
+      compress_table_epi32<Ms...> make_compress_table_epi32(::xsimd::detail::index_sequence<Ms...>);
+
+      // mask holds one bit per 32-bit lane
+      inline __m256i compress_epi32(__m256i self, int mask) {
+        using table = decltype(make_compress_table_epi32(::xsimd::detail::make_index_sequence<256>()));
+        __m256i index = _mm256_srlv_epi32(_mm256_set1_epi32(static_cast<int>(table::value[mask])),
+                                          _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+        __m256i res = _mm256_permutevar8x32_epi32(self, index);
+        // bit 3 of the field flags the lanes to zero
+        __m256i unused = _mm256_srai_epi32(_mm256_slli_epi32(index, 28), 31);
+        return _mm256_andnot_si256(unused, res);
+      }
+    }
+
+    template<class A> batch<float, A> compress(batch<float, A> const& self, batch_bool<float, A> const& mask, requires_arch<avx2>) {
+      return _mm256_castsi256_ps(detail::compress_epi32(_mm256_castps_si256(self), _mm256_movemask_ps(mask)));
+    }
+    template<class A> batch<double, A> compress(batch<double, A> const& self, batch_bool<double, A> const& mask, requires_arch<avx2>) {
+      return _mm256_castsi256_pd(detail::compress_epi32(_mm256_castpd_si256(self), _mm256_movemask_ps(_mm256_castpd_ps(mask))));
+    }
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> compress(batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx2>) {
+      switch(sizeof(T)) {
+        case 4:
+        case 8: return detail::compress_epi32(self, _mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+        default: return compress(self, mask, generic{});
+      }
+    }
+
     // eq
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch_bool<T, A> eq(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx2>) {
@@ -152,6 +204,22 @@ namespace xsimd {
       }
     }
 
+    // gather
+    template<class A, class T, class U, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> gather(T const* src, batch<U, A> const& index, requires_arch<avx2>) {
+      switch(sizeof(T)) {
+        case 4: return _mm256_i32gather_epi32(reinterpret_cast<int const*>(src), index, 4);
+        case 8: return _mm256_i64gather_epi64(reinterpret_cast<long long const*>(src), index, 8);
+        default: return gather(src, index, generic{});
+      }
+    }
+    template<class A, class U> batch<float, A> gather(float const* src, batch<U, A> const& index, requires_arch<avx2>) {
+      return _mm256_i32gather_ps(src, index, 4);
+    }
+    template<class A, class U> batch<double, A> gather(double const* src, batch<U, A> const& index, requires_arch<avx2>) {
+      return _mm256_i64gather_pd(src, index, 8);
+    }
+
     // gt
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch_bool<T, A> gt(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx2>) {
@@ -169,6 +237,34 @@ namespace xsimd {
       }
     }
 
+    // get
+    template<class A> float get(batch<float, A> const& self, std::size_t i, requires_arch<avx2>) {
+      __m256 lane = _mm256_permutevar8x32_ps(self, _mm256_set1_epi32(static_cast<int>(i)));
+      return _mm_cvtss_f32(_mm256_castps256_ps128(lane));
+    }
+    template<class A> double get(batch<double, A> const& self, std::size_t i, requires_arch<avx2>) {
+      int lo = static_cast<int>(2 * i), hi = lo + 1;
+      __m256 lane = _mm256_permutevar8x32_ps(_mm256_castpd_ps(self), _mm256_setr_epi32(lo, hi, lo, hi, lo, hi, lo, hi));
+      return _mm_cvtsd_f64(_mm256_castpd256_pd128(_mm256_castps_pd(lane)));
+    }
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    T get(batch<T, A> const& self, std::size_t i, requires_arch<avx2>) {
+      switch(sizeof(T)) {
+        case 4: {
+                  __m256i lane = _mm256_permutevar8x32_epi32(self, _mm256_set1_epi32(static_cast<int>(i)));
+                  return static_cast<T>(_mm_cvtsi128_si32(_mm256_castsi256_si128(lane)));
+                }
+#if defined(__x86_64__)
+        case 8: {
+                  int lo = static_cast<int>(2 * i), hi = lo + 1;
+                  __m256i lane = _mm256_permutevar8x32_epi32(self, _mm256_setr_epi32(lo, hi, lo, hi, lo, hi, lo, hi));
+                  return static_cast<T>(_mm_cvtsi128_si64(_mm256_castsi256_si128(lane)));
+                }
+#endif
+        default: return get(self, i, generic{});
+      }
+    }
+
     // hadd
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     T hadd(batch<T, A> const& self, requires_arch<avx2>) {
@@ -220,6 +316,15 @@ namespace xsimd {
             return {real, imag};
     }
 
+    // mask
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    uint64_t mask(batch_bool<T, A> const& self, requires_arch<avx2>) {
+      switch(sizeof(T)) {
+        case 1: return static_cast<uint32_t>(_mm256_movemask_epi8(self));
+        default: return mask(self, avx{});
+      }
+    }
+
     // max
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> max(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx2>) {
@@ -272,6 +377,24 @@ namespace xsimd {
       }
     }
 
+    // narrow
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<narrow_type_t<T>, A> narrow(batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<avx2>) {
+      // the packs work within 128 bits lanes, the permutation restores the order
+      switch(sizeof(T)) {
+        case 2: {
+          __m256i mask = _mm256_set1_epi16(0xFF);
+          return _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(lo, mask), _mm256_and_si256(hi, mask)), _MM_SHUFFLE(3, 1, 2, 0));
+        }
+        case 4: {
+          __m256i mask = _mm256_set1_epi32(0xFFFF);
+          return _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(lo, mask), _mm256_and_si256(hi, mask)), _MM_SHUFFLE(3, 1, 2, 0));
+        }
+        case 8: return _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(lo), _mm256_castsi256_ps(hi), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+        default: assert(false && "unsupported arch/op combination"); return {};
+      }
+    }
+
     // sadd
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> sadd(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx2>) {
@@ -318,6 +441,30 @@ namespace xsimd {
       }
     }
 
+    // slide_left
+    template<size_t N, class A> batch<uint8_t, A> slide_left(batch<uint8_t, A> const& self, requires_arch<avx2>) {
+      // the low half moved to the high one, zeros below
+      __m256i lane_up = _mm256_permute2x128_si256(self, self, 0x08);
+      if(N < 16) {
+        constexpr int n = N < 16 ? N : 0;
+        return _mm256_alignr_epi8(self, lane_up, 16 - n);
+      }
+      constexpr int n = N >= 16 && N < 32 ? N - 16 : 16;
+      return _mm256_slli_si256(lane_up, n);
+    }
+
+    // slide_right
+    template<size_t N, class A> batch<uint8_t, A> slide_right(batch<uint8_t, A> const& self, requires_arch<avx2>) {
+      // the high half moved to the low one, zeros above
+      __m256i lane_down = _mm256_permute2x128_si256(self, self, 0x81);
+      if(N < 16) {
+        constexpr int n = N < 16 ? N : 0;
+        return _mm256_alignr_epi8(lane_down, self, n);
+      }
+      constexpr int n = N >= 16 && N < 32 ? N - 16 : 16;
+      return _mm256_srli_si256(lane_down, n);
+    }
+
     // ssub
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> ssub(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx2>) {
@@ -349,7 +496,51 @@ namespace xsimd {
       }
     }
 
+    // swizzle
+    template<class A, uint32_t... Vs>
+    batch<float, A> swizzle(batch<float, A> const& self, batch_constant<batch<uint32_t, A>, Vs...>, requires_arch<avx2>) {
+      return _mm256_permutevar8x32_ps(self, _mm256_setr_epi32(Vs...));
+    }
+    template<class A, uint64_t V0, uint64_t V1, uint64_t V2, uint64_t V3>
+    batch<double, A> swizzle(batch<double, A> const& self, batch_constant<batch<uint64_t, A>, V0, V1, V2, V3>, requires_arch<avx2>) {
+      constexpr uint32_t index = _MM_SHUFFLE(V3, V2, V1, V0);
+      return _mm256_permute4x64_pd(self, index);
+    }
+    template<class A, class T, uint32_t... Vs, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> swizzle(batch<T, A> const& self, batch_constant<batch<uint32_t, A>, Vs...>, requires_arch<avx2>) {
+      return _mm256_permutevar8x32_epi32(self, _mm256_setr_epi32(Vs...));
+    }
+    template<class A, class T, uint64_t V0, uint64_t V1, uint64_t V2, uint64_t V3, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> swizzle(batch<T, A> const& self, batch_constant<batch<uint64_t, A>, V0, V1, V2, V3>, requires_arch<avx2>) {
+      constexpr uint32_t index = _MM_SHUFFLE(V3, V2, V1, V0);
+      return _mm256_permute4x64_epi64(self, index);
+    }
 
+    // widen
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& self, requires_arch<avx2>) {
+      using batch_type = batch<widen_type_t<T>, A>;
+      __m128i const low = _mm256_castsi256_si128(self);
+      __m128i const high = _mm256_extracti128_si256(self, 1);
+      switch(sizeof(T)) {
+        case 1:
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm256_cvtepi8_epi16(low)), batch_type(_mm256_cvtepi8_epi16(high)) }};
+          else
+            return {{ batch_type(_mm256_cvtepu8_epi16(low)), batch_type(_mm256_cvtepu8_epi16(high)) }};
+        case 2:
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm256_cvtepi16_epi32(low)), batch_type(_mm256_cvtepi16_epi32(high)) }};
+          else
+            return {{ batch_type(_mm256_cvtepu16_epi32(low)), batch_type(_mm256_cvtepu16_epi32(high)) }};
+        case 4:
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm256_cvtepi32_epi64(low)), batch_type(_mm256_cvtepi32_epi64(high)) }};
+          else
+            return {{ batch_type(_mm256_cvtepu32_epi64(low)), batch_type(_mm256_cvtepu32_epi64(high)) }};
+        default: assert(false && "unsupported arch/op combination"); return {};
+      }
+    }
 
   }
 
@@ -12,6 +12,7 @@
 #ifndef XSIMD_AVX512BW_HPP
 #define XSIMD_AVX512BW_HPP
 
+#include <array>
 #include <type_traits>
 
 #include "../types/xsimd_avx512bw_register.hpp"
@@ -209,6 +210,15 @@ namespace xsimd {
       return detail::compare_int_avx512bw<A, T, _MM_CMPINT_NE>(self, other);
     }
 
+    // narrow
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<narrow_type_t<T>, A> narrow(batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<avx512bw>) {
+      switch(sizeof(T)) {
+        case 2: return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi16_epi8(lo)), _mm512_cvtepi16_epi8(hi), 1);
+        default: return narrow(lo, hi, avx512dq{});
+      }
+    }
+
     // sadd
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> sadd(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx512bw>) {
@@ -239,6 +249,37 @@ namespace xsimd {
     }
 
 
+    // slide_left
+    namespace detail {
+      // slides by L whole 128 bits lanes
+      template<size_t L> __m512i slide_left_lanes(__m512i self) {
+        constexpr int n = L > 0 && L < 4 ? 16 - 4 * L : 0;
+        return L == 0 ? self : (L < 4 ? _mm512_alignr_epi32(self, _mm512_setzero_si512(), n) : _mm512_setzero_si512());
+      }
+      template<size_t L> __m512i slide_right_lanes(__m512i self) {
+        constexpr int n = L < 4 ? 4 * L : 0;
+        return L < 4 ? _mm512_alignr_epi32(_mm512_setzero_si512(), self, n) : _mm512_setzero_si512();
+      }
+    }
+
+    template<size_t N, class A> batch<uint8_t, A> slide_left(batch<uint8_t, A> const& self, requires_arch<avx512bw>) {
+      if(N % 16 == 0) {
+        return detail::slide_left_lanes<N / 16>(self);
+      }
+      // each 128 bits lane takes the last bytes of the one below
+      constexpr int n = 16 - N % 16;
+      return _mm512_alignr_epi8(detail::slide_left_lanes<N / 16>(self), detail::slide_left_lanes<N / 16 + 1>(self), n);
+    }
+
+    // slide_right
+    template<size_t N, class A> batch<uint8_t, A> slide_right(batch<uint8_t, A> const& self, requires_arch<avx512bw>) {
+      if(N % 16 == 0) {
+        return detail::slide_right_lanes<N / 16>(self);
+      }
+      constexpr int n = N % 16;
+      return _mm512_alignr_epi8(detail::slide_right_lanes<N / 16 + 1>(self), detail::slide_right_lanes<N / 16>(self), n);
+    }
+
     // ssub
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> ssub(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx512bw>) {
@@ -269,6 +310,23 @@ namespace xsimd {
       }
     }
 
+    // widen
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& self, requires_arch<avx512bw>) {
+      using batch_type = batch<widen_type_t<T>, A>;
+      switch(sizeof(T)) {
+        case 1: {
+          __m256i const low = _mm512_castsi512_si256(self);
+          __m256i const high = _mm512_extracti64x4_epi64(self, 1);
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm512_cvtepi8_epi16(low)), batch_type(_mm512_cvtepi8_epi16(high)) }};
+          else
+            return {{ batch_type(_mm512_cvtepu8_epi16(low)), batch_type(_mm512_cvtepu8_epi16(high)) }};
+        }
+        default: return widen(self, avx512dq{});
+      }
+    }
+
   }
 
 }
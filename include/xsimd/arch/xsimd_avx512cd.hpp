@@ -17,7 +17,17 @@
 namespace xsimd {
 
   namespace kernel {
-  // Nothing there yet.
+    using namespace types;
+
+    // conflict
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> conflict(batch<T, A> const& self, requires_arch<avx512cd>) {
+      switch(sizeof(T)) {
+        case 4: return _mm512_conflict_epi32(self);
+        case 8: return _mm512_conflict_epi64(self);
+        default: return conflict(self, generic{});
+      }
+    }
 
   }
 
@@ -12,6 +12,7 @@
 #ifndef XSIMD_AVX512F_HPP
 #define XSIMD_AVX512F_HPP
 
+#include <array>
 #include <complex>
 #include <limits>
 #include <type_traits>
@@ -474,9 +475,26 @@ namespace xsimd {
       return _mm512_roundscale_pd(self, _MM_FROUND_TO_POS_INF);
     }
 
+    // clip_ignore_nan
+    template<class A> batch<float, A> clip_ignore_nan(batch<float, A> const& self, batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<avx512f>) {
+      return _mm512_min_ps(_mm512_max_ps(self, lo), hi);
+    }
+    template<class A> batch<double, A> clip_ignore_nan(batch<double, A> const& self, batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<avx512f>) {
+      return _mm512_min_pd(_mm512_max_pd(self, lo), hi);
+    }
+
+    // clip_propagate_nan
+    template<class A> batch<float, A> clip_propagate_nan(batch<float, A> const& self, batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<avx512f>) {
+      return _mm512_min_ps(hi, _mm512_max_ps(lo, self));
+    }
+    template<class A> batch<double, A> clip_propagate_nan(batch<double, A> const& self, batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<avx512f>) {
+      return _mm512_min_pd(hi, _mm512_max_pd(lo, self));
+    }
+
 
     namespace detail
     {
+
     // complex_low
     template<class A> batch<float, A> complex_low(batch<std::complex<float>, A> const& self, requires_arch<avx512f>) {
         __m512i idx = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
@@ -498,6 +516,22 @@ namespace xsimd {
     }
     }
 
+    // compress
+    template<class A> batch<float, A> compress(batch<float, A> const& self, batch_bool<float, A> const& mask, requires_arch<avx512f>) {
+      return _mm512_maskz_compress_ps(mask, self);
+    }
+    template<class A> batch<double, A> compress(batch<double, A> const& self, batch_bool<double, A> const& mask, requires_arch<avx512f>) {
+      return _mm512_maskz_compress_pd(mask, self);
+    }
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> compress(batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx512f>) {
+      switch(sizeof(T)) {
+        case 4: return _mm512_maskz_compress_epi32(static_cast<__mmask16>(mask.mask()), self);
+        case 8: return _mm512_maskz_compress_epi64(static_cast<__mmask8>(mask.mask()), self);
+        default: return compress(self, mask, generic{});
+      }
+    }
+
     // convert
     namespace detail {
     template<class A> batch<float, A> fast_cast(batch<int32_t, A> const& self, batch<float, A> const&, requires_arch<avx512f>) {
@@ -535,6 +569,38 @@ namespace xsimd {
       return register_type(~self.data ^ other.data);
     }
 
+    // fnma
+    template<class A> batch<float, A> fnma(batch<float, A> const& x, batch<float, A> const& y, batch<float, A> const& z, requires_arch<avx512f>) {
+      return _mm512_fnmadd_ps(x, y, z);
+    }
+    template<class A> batch<double, A> fnma(batch<double, A> const& x, batch<double, A> const& y, batch<double, A> const& z, requires_arch<avx512f>) {
+      return _mm512_fnmadd_pd(x, y, z);
+    }
+
+    // fnms
+    template<class A> batch<float, A> fnms(batch<float, A> const& x, batch<float, A> const& y, batch<float, A> const& z, requires_arch<avx512f>) {
+      return _mm512_fnmsub_ps(x, y, z);
+    }
+    template<class A> batch<double, A> fnms(batch<double, A> const& x, batch<double, A> const& y, batch<double, A> const& z, requires_arch<avx512f>) {
+      return _mm512_fnmsub_pd(x, y, z);
+    }
+
+    // fma
+    template<class A> batch<float, A> fma(batch<float, A> const& x, batch<float, A> const& y, batch<float, A> const& z, requires_arch<avx512f>) {
+      return _mm512_fmadd_ps(x, y, z);
+    }
+    template<class A> batch<double, A> fma(batch<double, A> const& x, batch<double, A> const& y, batch<double, A> const& z, requires_arch<avx512f>) {
+      return _mm512_fmadd_pd(x, y, z);
+    }
+
+    // fms
+    template<class A> batch<float, A> fms(batch<float, A> const& x, batch<float, A> const& y, batch<float, A> const& z, requires_arch<avx512f>) {
+      return _mm512_fmsub_ps(x, y, z);
+    }
+    template<class A> batch<double, A> fms(batch<double, A> const& x, batch<double, A> const& y, batch<double, A> const& z, requires_arch<avx512f>) {
+      return _mm512_fmsub_pd(x, y, z);
+    }
+
     // floor
     template<class A> batch<float, A> floor(batch<float, A> const& self, requires_arch<avx512f>) {
       return _mm512_roundscale_ps(self, _MM_FROUND_TO_NEG_INF);
@@ -549,6 +615,22 @@ namespace xsimd {
       return select(self, batch<T, A>(1), batch<T, A>(0));
     }
 
+    // gather
+    template<class A, class T, class U, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> gather(T const* src, batch<U, A> const& index, requires_arch<avx512f>) {
+      switch(sizeof(T)) {
+        case 4: return _mm512_i32gather_epi32(index, src, 4);
+        case 8: return _mm512_i64gather_epi64(index, src, 8);
+        default: return gather(src, index, generic{});
+      }
+    }
+    template<class A, class U> batch<float, A> gather(float const* src, batch<U, A> const& index, requires_arch<avx512f>) {
+      return _mm512_i32gather_ps(index, src, 4);
+    }
+    template<class A, class U> batch<double, A> gather(double const* src, batch<U, A> const& index, requires_arch<avx512f>) {
+      return _mm512_i64gather_pd(index, src, 8);
+    }
+
     // ge
     template<class A> batch_bool<float, A> ge(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
       return _mm512_cmp_ps_mask(self, other, _CMP_GE_OQ);
@@ -561,6 +643,57 @@ namespace xsimd {
       return detail::compare_int_avx512f<A, T, _MM_CMPINT_GE>(self, other);
     }
 
+    // get
+    template<class A, std::size_t I> float get(batch<float, A> const& self, ::xsimd::index<I>, requires_arch<avx512f>) {
+      constexpr std::size_t quarter_size = batch<float, sse4_2>::size;
+      __m128 quarter = _mm512_extractf32x4_ps(self, I / quarter_size);
+      return get(batch<float, sse4_2>(quarter), ::xsimd::index<I % quarter_size>{}, sse4_2{});
+    }
+    template<class A, std::size_t I> double get(batch<double, A> const& self, ::xsimd::index<I>, requires_arch<avx512f>) {
+      constexpr std::size_t quarter_size = batch<double, sse4_2>::size;
+      __m128d quarter = _mm_castps_pd(_mm512_extractf32x4_ps(_mm512_castpd_ps(self), I / quarter_size));
+      return get(batch<double, sse4_2>(quarter), ::xsimd::index<I % quarter_size>{}, sse4_2{});
+    }
+    template<class A, class T, std::size_t I, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    T get(batch<T, A> const& self, ::xsimd::index<I>, requires_arch<avx512f>) {
+      constexpr std::size_t quarter_size = batch<T, sse4_2>::size;
+      __m128i quarter = _mm512_extracti32x4_epi32(self, I / quarter_size);
+      return get(batch<T, sse4_2>(quarter), ::xsimd::index<I % quarter_size>{}, sse4_2{});
+    }
+    template<class A, class T, std::size_t I>
+    bool get(batch_bool<T, A> const& self, ::xsimd::index<I>, requires_arch<avx512f>) {
+      return (self.data >> I) & 1;
+    }
+
+    template<class A> float get(batch<float, A> const& self, std::size_t i, requires_arch<avx512f>) {
+      __m512 lane = _mm512_permutexvar_ps(_mm512_set1_epi32(static_cast<int>(i)), self);
+      return _mm_cvtss_f32(_mm512_castps512_ps128(lane));
+    }
+    template<class A> double get(batch<double, A> const& self, std::size_t i, requires_arch<avx512f>) {
+      __m512d lane = _mm512_permutexvar_pd(_mm512_set1_epi64(static_cast<int64_t>(i)), self);
+      return _mm_cvtsd_f64(_mm512_castpd512_pd128(lane));
+    }
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    T get(batch<T, A> const& self, std::size_t i, requires_arch<avx512f>) {
+      switch(sizeof(T)) {
+        case 4: {
+                  __m512i lane = _mm512_permutexvar_epi32(_mm512_set1_epi32(static_cast<int>(i)), self);
+                  return static_cast<T>(_mm_cvtsi128_si32(_mm512_castsi512_si128(lane)));
+                }
+#if defined(__x86_64__)
+        case 8: {
+                  __m512i lane = _mm512_permutexvar_epi64(_mm512_set1_epi64(static_cast<int64_t>(i)), self);
+                  return static_cast<T>(_mm_cvtsi128_si64(_mm512_castsi512_si128(lane)));
+                }
+#endif
+        default: return get(self, i, generic{});
+      }
+    }
+    template<class A, class T>
+    bool get(batch_bool<T, A> const& self, std::size_t i, requires_arch<avx512f>) {
+      return (self.data >> i) & 1;
+    }
+
     // gt
     template<class A> batch_bool<float, A> gt(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
       return _mm512_cmp_ps_mask(self, other, _CMP_GT_OQ);
@@ -689,6 +822,27 @@ namespace xsimd {
                 return _mm512_add_pd(tmpx, tmpy);
     }
 
+    // insert
+    template<class A, std::size_t I> batch<float, A> insert(batch<float, A> const& self, float val, ::xsimd::index<I>, requires_arch<avx512f>) {
+      constexpr std::size_t quarter_size = batch<float, sse4_2>::size;
+      __m128 quarter = _mm512_extractf32x4_ps(self, I / quarter_size);
+      quarter = insert(batch<float, sse4_2>(quarter), val, ::xsimd::index<I % quarter_size>{}, sse4_2{});
+      return _mm512_insertf32x4(self, quarter, I / quarter_size);
+    }
+    template<class A, std::size_t I> batch<double, A> insert(batch<double, A> const& self, double val, ::xsimd::index<I>, requires_arch<avx512f>) {
+      constexpr std::size_t quarter_size = batch<double, sse4_2>::size;
+      __m128d quarter = _mm_castps_pd(_mm512_extractf32x4_ps(_mm512_castpd_ps(self), I / quarter_size));
+      quarter = insert(batch<double, sse4_2>(quarter), val, ::xsimd::index<I % quarter_size>{}, sse4_2{});
+      return _mm512_castps_pd(_mm512_insertf32x4(_mm512_castpd_ps(self), _mm_castpd_ps(quarter), I / quarter_size));
+    }
+    template<class A, class T, std::size_t I, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> insert(batch<T, A> const& self, T val, ::xsimd::index<I>, requires_arch<avx512f>) {
+      constexpr std::size_t quarter_size = batch<T, sse4_2>::size;
+      __m128i quarter = _mm512_extracti32x4_epi32(self, I / quarter_size);
+      quarter = insert(batch<T, sse4_2>(quarter), val, ::xsimd::index<I % quarter_size>{}, sse4_2{});
+      return _mm512_inserti32x4(self, quarter, I / quarter_size);
+    }
+
     // isnan
     template<class A> batch_bool<float, A> isnan(batch<float, A> const& self, requires_arch<avx512f>) {
                 return _mm512_cmp_ps_mask(self, self, _CMP_UNORD_Q);
@@ -767,6 +921,12 @@ namespace xsimd {
       return detail::compare_int_avx512f<A, T, _MM_CMPINT_LT>(self, other);
     }
 
+    // mask
+    template<class A, class T>
+    uint64_t mask(batch_bool<T, A> const& self, requires_arch<avx512f>) {
+      return self.data;
+    }
+
     // max
     template<class A> batch<float, A> max(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
       return _mm512_max_ps(self, other);
@@ -792,6 +952,22 @@ namespace xsimd {
       }
     }
 
+    // max_ignore_nan
+    template<class A> batch<float, A> max_ignore_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
+      return _mm512_mask_max_ps(self, _mm512_cmp_ps_mask(other, other, _CMP_ORD_Q), self, other);
+    }
+    template<class A> batch<double, A> max_ignore_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx512f>) {
+      return _mm512_mask_max_pd(self, _mm512_cmp_pd_mask(other, other, _CMP_ORD_Q), self, other);
+    }
+
+    // max_propagate_nan
+    template<class A> batch<float, A> max_propagate_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
+      return _mm512_mask_max_ps(self, _mm512_cmp_ps_mask(self, self, _CMP_ORD_Q), self, other);
+    }
+    template<class A> batch<double, A> max_propagate_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx512f>) {
+      return _mm512_mask_max_pd(self, _mm512_cmp_pd_mask(self, self, _CMP_ORD_Q), self, other);
+    }
+
     // min
     template<class A> batch<float, A> min(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
       return _mm512_min_ps(self, other);
@@ -817,6 +993,22 @@ namespace xsimd {
       }
     }
 
+    // min_ignore_nan
+    template<class A> batch<float, A> min_ignore_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
+      return _mm512_mask_min_ps(self, _mm512_cmp_ps_mask(other, other, _CMP_ORD_Q), self, other);
+    }
+    template<class A> batch<double, A> min_ignore_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx512f>) {
+      return _mm512_mask_min_pd(self, _mm512_cmp_pd_mask(other, other, _CMP_ORD_Q), self, other);
+    }
+
+    // min_propagate_nan
+    template<class A> batch<float, A> min_propagate_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
+      return _mm512_mask_min_ps(self, _mm512_cmp_ps_mask(self, self, _CMP_ORD_Q), self, other);
+    }
+    template<class A> batch<double, A> min_propagate_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx512f>) {
+      return _mm512_mask_min_pd(self, _mm512_cmp_pd_mask(self, self, _CMP_ORD_Q), self, other);
+    }
+
     // mul
     template<class A> batch<float, A> mul(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
       return _mm512_mul_ps(self, other);
@@ -841,6 +1033,20 @@ namespace xsimd {
       return _mm512_roundscale_round_pd(self, _MM_FROUND_TO_NEAREST_INT, _MM_FROUND_CUR_DIRECTION);
     }
 
+    // narrow
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<narrow_type_t<T>, A> narrow(batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<avx512f>) {
+      switch(sizeof(T)) {
+        case 4: return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi32_epi16(lo)), _mm512_cvtepi32_epi16(hi), 1);
+        case 8: return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi64_epi32(lo)), _mm512_cvtepi64_epi32(hi), 1);
+        default: return narrow(lo, hi, generic{});
+      }
+    }
+    template<class A> batch<float, A> narrow(batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<avx512f>) {
+      __m512d low = _mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(lo)));
+      return _mm512_castpd_ps(_mm512_insertf64x4(low, _mm256_castps_pd(_mm512_cvtpd_ps(hi)), 1));
+    }
+
     // neg
     template<class A, class T>
     batch<T, A> neg(batch<T, A> const& self, requires_arch<avx512f>) {
@@ -849,10 +1055,10 @@ namespace xsimd {
 
     // neq
     template<class A> batch_bool<float, A> neq(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
-      return _mm512_cmp_ps_mask(self, other, _CMP_NEQ_OQ);
+      return _mm512_cmp_ps_mask(self, other, _CMP_NEQ_UQ);
     }
     template<class A> batch_bool<double, A> neq(batch<double, A> const& self, batch<double, A> const& other, requires_arch<avx512f>) {
-      return _mm512_cmp_pd_mask(self, other, _CMP_NEQ_OQ);
+      return _mm512_cmp_pd_mask(self, other, _CMP_NEQ_UQ);
     }
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch_bool<T, A> neq(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx512f>) {
@@ -865,6 +1071,22 @@ namespace xsimd {
       return register_type(self.data ^ other.data);
     }
 
+    // reciprocal
+    template<class A> batch<float, A> reciprocal(batch<float, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<avx512f>) {
+      return _mm512_rcp14_ps(self);
+    }
+    template<class A> batch<double, A> reciprocal(batch<double, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<avx512f>) {
+      return _mm512_rcp14_pd(self);
+    }
+
+    // rsqrt
+    template<class A> batch<float, A> rsqrt(batch<float, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<avx512f>) {
+      return _mm512_rsqrt14_ps(self);
+    }
+    template<class A> batch<double, A> rsqrt(batch<double, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<avx512f>) {
+      return _mm512_rsqrt14_pd(self);
+    }
+
     // sadd
     template<class A> batch<float, A> sadd(batch<float, A> const& self, batch<float, A> const& other, requires_arch<avx512f>) {
       return add(self, other); // no saturated arithmetic on floating point numbers
@@ -952,6 +1174,22 @@ namespace xsimd {
                                                                   int>::type;
     }
 
+    // scatter
+    template<class A, class T, class U, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    void scatter(batch<T, A> const& self, T* dst, batch<U, A> const& index, requires_arch<avx512f>) {
+      switch(sizeof(T)) {
+        case 4: _mm512_i32scatter_epi32(dst, index, self, 4); break;
+        case 8: _mm512_i64scatter_epi64(dst, index, self, 8); break;
+        default: scatter(self, dst, index, generic{});
+      }
+    }
+    template<class A, class U> void scatter(batch<float, A> const& self, float* dst, batch<U, A> const& index, requires_arch<avx512f>) {
+      _mm512_i32scatter_ps(dst, index, self, 4);
+    }
+    template<class A, class U> void scatter(batch<double, A> const& self, double* dst, batch<U, A> const& index, requires_arch<avx512f>) {
+      _mm512_i64scatter_pd(dst, index, self, 8);
+    }
+
     // set
     template<class A>
     batch<float, A> set(batch<float, A> const&, requires_arch<avx512f>, float v0, float v1, float v2, float v3, float v4, float v5, float v6, float v7, float v8, float v9, float v10, float v11, float v12, float v13, float v14, float v15) {
@@ -1065,6 +1303,28 @@ namespace xsimd {
       return r;
     }
 
+    // slide_left
+    template<size_t N, class A> batch<uint8_t, A> slide_left(batch<uint8_t, A> const& self, requires_arch<avx512f>) {
+      // whole 32 bits lanes only, smaller steps need avx512bw
+      if(N % 4 != 0) {
+        return slide_left<N>(self, generic{});
+      }
+      if(N == 0) {
+        return self;
+      }
+      constexpr int n = N < 64 ? 16 - N / 4 : 0;
+      return N < 64 ? _mm512_alignr_epi32(self, _mm512_setzero_si512(), n) : _mm512_setzero_si512();
+    }
+
+    // slide_right
+    template<size_t N, class A> batch<uint8_t, A> slide_right(batch<uint8_t, A> const& self, requires_arch<avx512f>) {
+      if(N % 4 != 0) {
+        return slide_right<N>(self, generic{});
+      }
+      constexpr int n = N < 64 ? N / 4 : 0;
+      return N < 64 ? _mm512_alignr_epi32(_mm512_setzero_si512(), self, n) : _mm512_setzero_si512();
+    }
+
     // sqrt
     template<class A> batch<float, A> sqrt(batch<float, A> const& val, requires_arch<avx512f>) {
       return _mm512_sqrt_ps(val);
@@ -1150,6 +1410,24 @@ namespace xsimd {
       return _mm512_sub_pd(self, other);
     }
 
+    // swizzle
+    template<class A, uint32_t... Vs>
+    batch<float, A> swizzle(batch<float, A> const& self, batch_constant<batch<uint32_t, A>, Vs...> mask, requires_arch<avx512f>) {
+      return _mm512_permutexvar_ps(static_cast<batch<uint32_t, A>>(mask), self);
+    }
+    template<class A, uint64_t... Vs>
+    batch<double, A> swizzle(batch<double, A> const& self, batch_constant<batch<uint64_t, A>, Vs...> mask, requires_arch<avx512f>) {
+      return _mm512_permutexvar_pd(static_cast<batch<uint64_t, A>>(mask), self);
+    }
+    template<class A, class T, uint32_t... Vs, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> swizzle(batch<T, A> const& self, batch_constant<batch<uint32_t, A>, Vs...> mask, requires_arch<avx512f>) {
+      return _mm512_permutexvar_epi32(static_cast<batch<uint32_t, A>>(mask), self);
+    }
+    template<class A, class T, uint64_t... Vs, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> swizzle(batch<T, A> const& self, batch_constant<batch<uint64_t, A>, Vs...> mask, requires_arch<avx512f>) {
+      return _mm512_permutexvar_epi64(static_cast<batch<uint64_t, A>>(mask), self);
+    }
+
     // to_float
     template<class A>
     batch<float, A> to_float(batch<int32_t, A> const& self, requires_arch<avx512f>) {
@@ -1187,6 +1465,32 @@ namespace xsimd {
       return _mm512_roundscale_round_pd(self, _MM_FROUND_TO_ZERO, _MM_FROUND_CUR_DIRECTION);
     }
 
+    // widen
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& self, requires_arch<avx512f>) {
+      using batch_type = batch<widen_type_t<T>, A>;
+      __m256i const low = _mm512_castsi512_si256(self);
+      __m256i const high = _mm512_extracti64x4_epi64(self, 1);
+      switch(sizeof(T)) {
+        case 2:
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm512_cvtepi16_epi32(low)), batch_type(_mm512_cvtepi16_epi32(high)) }};
+          else
+            return {{ batch_type(_mm512_cvtepu16_epi32(low)), batch_type(_mm512_cvtepu16_epi32(high)) }};
+        case 4:
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm512_cvtepi32_epi64(low)), batch_type(_mm512_cvtepi32_epi64(high)) }};
+          else
+            return {{ batch_type(_mm512_cvtepu32_epi64(low)), batch_type(_mm512_cvtepu32_epi64(high)) }};
+        default: return widen(self, generic{});
+      }
+    }
+    template<class A> std::array<batch<double, A>, 2> widen(batch<float, A> const& self, requires_arch<avx512f>) {
+      __m256 low = _mm512_castps512_ps256(self);
+      __m256 high = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(self), 1));
+      return {{ batch<double, A>(_mm512_cvtps_pd(low)), batch<double, A>(_mm512_cvtps_pd(high)) }};
+    }
+
     // zip_hi
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> zip_hi(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx512f>) {
@@ -12,6 +12,7 @@
 #ifndef XSIMD_GENERIC_FWD_HPP
 #define XSIMD_GENERIC_FWD_HPP
 
+#include <array>
 #include <type_traits>
 
 namespace xsimd {
@@ -24,9 +25,22 @@ namespace xsimd {
     batch<T, A> bitwise_lshift(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>);
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> bitwise_rshift(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>);
+    template<class A, class T> batch<T, A> compress(batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<generic>);
+    template<class A, class T> batch<T, A> conflict(batch<T, A> const& self, requires_arch<generic>);
+    template<class A, class T, class U> batch<T, A> gather(T const* src, batch<U, A> const& index, requires_arch<generic>);
+    template<class A, class T, std::size_t I> T get(batch<T, A> const& self, ::xsimd::index<I>, requires_arch<generic>);
+    template<class A, class T> T get(batch<T, A> const& self, std::size_t i, requires_arch<generic>);
     template<class A, class T> batch_bool<T, A> gt(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>);
+    template<class A, class T, std::size_t I> batch<T, A> insert(batch<T, A> const& self, T val, ::xsimd::index<I>, requires_arch<generic>);
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> mul(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>);
+    template<class A, class T> batch<narrow_type_t<T>, A> narrow(batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<generic>);
+    template<class A, class T, class U> void scatter(batch<T, A> const& self, T* dst, batch<U, A> const& index, requires_arch<generic>);
+    template<size_t N, class A> batch<uint8_t, A> slide_left(batch<uint8_t, A> const& self, requires_arch<generic>);
+    template<size_t N, class A> batch<uint8_t, A> slide_right(batch<uint8_t, A> const& self, requires_arch<generic>);
+    template<class A, class T, class ITy, ITy... Vs>
+    batch<T, A> swizzle(batch<T, A> const& self, batch_constant<batch<ITy, A>, Vs...>, requires_arch<generic>);
+    template<class A, class T> std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& self, requires_arch<generic>);
 
   }
 }
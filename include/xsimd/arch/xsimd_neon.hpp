@@ -1169,6 +1169,37 @@ namespace xsimd
             return { std::max(lhs.get(0), rhs.get(0)), std::max(lhs.get(1), rhs.get(1)) };
         }
 
+        /*********************
+         * min_propagate_nan *
+         *********************/
+
+        // vminq and vmaxq return NaN when either operand is NaN
+        template <class A>
+        batch<float, A> min_propagate_nan(batch<float, A> const& lhs, batch<float, A> const& rhs, requires_arch<neon>)
+        {
+            return vminq_f32(lhs, rhs);
+        }
+
+        /*********************
+         * max_propagate_nan *
+         *********************/
+
+        template <class A>
+        batch<float, A> max_propagate_nan(batch<float, A> const& lhs, batch<float, A> const& rhs, requires_arch<neon>)
+        {
+            return vmaxq_f32(lhs, rhs);
+        }
+
+        /**********************
+         * clip_propagate_nan *
+         **********************/
+
+        template <class A>
+        batch<float, A> clip_propagate_nan(batch<float, A> const& self, batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<neon>)
+        {
+            return vminq_f32(vmaxq_f32(self, lo), hi);
+        }
+
         /*******
          * abs *
          *******/
@@ -1225,6 +1256,40 @@ namespace xsimd
             return select(arg == zero, zero, sqrt_approx);
         }
 
+        /**************
+         * reciprocal *
+         **************/
+
+        template <class A>
+        batch<float, A> reciprocal(batch<float, A> const& arg, std::integral_constant<std::size_t, 0>, requires_arch<neon>)
+        {
+            return vrecpeq_f32(arg);
+        }
+
+        template <class A, std::size_t Steps>
+        batch<float, A> reciprocal(batch<float, A> const& arg, std::integral_constant<std::size_t, Steps>, requires_arch<neon>)
+        {
+            float32x4_t y = reciprocal(arg, std::integral_constant<std::size_t, Steps - 1>(), A{});
+            return vmulq_f32(vrecpsq_f32(arg, y), y);
+        }
+
+        /*********
+         * rsqrt *
+         *********/
+
+        template <class A>
+        batch<float, A> rsqrt(batch<float, A> const& arg, std::integral_constant<std::size_t, 0>, requires_arch<neon>)
+        {
+            return vrsqrteq_f32(arg);
+        }
+
+        template <class A, std::size_t Steps>
+        batch<float, A> rsqrt(batch<float, A> const& arg, std::integral_constant<std::size_t, Steps>, requires_arch<neon>)
+        {
+            float32x4_t y = rsqrt(arg, std::integral_constant<std::size_t, Steps - 1>(), A{});
+            return vmulq_f32(vrsqrtsq_f32(vmulq_f32(arg, y), y), y);
+        }
+
         /********************
          * Fused operations *
          ********************/
@@ -1686,6 +1751,144 @@ namespace xsimd
             return detail::extract_pair_impl(lhs, rhs, n, ::xsimd::detail::make_index_sequence<size>());
         }
 
+        /**************
+         * slide_left *
+         **************/
+
+        template <size_t N, class A>
+        batch<uint8_t, A> slide_left(batch<uint8_t, A> const& x, requires_arch<neon>)
+        {
+            constexpr int n = N > 0 && N < 16 ? 16 - N : 0;
+            return N == 0 ? x : batch<uint8_t, A>(N < 16 ? vextq_u8(vdupq_n_u8(0), x, n) : vdupq_n_u8(0));
+        }
+
+        /***************
+         * slide_right *
+         ***************/
+
+        template <size_t N, class A>
+        batch<uint8_t, A> slide_right(batch<uint8_t, A> const& x, requires_arch<neon>)
+        {
+            constexpr int n = N < 16 ? N : 0;
+            return N < 16 ? batch<uint8_t, A>(vextq_u8(x, vdupq_n_u8(0), n)) : batch<uint8_t, A>(vdupq_n_u8(0));
+        }
+
+        /*******
+         * get *
+         *******/
+
+        template <class A, class T, size_t I, detail::enable_sized_unsigned_t<T, 1> = 0>
+        T get(batch<T, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_u8(arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_signed_t<T, 1> = 0>
+        T get(batch<T, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_s8(arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_unsigned_t<T, 2> = 0>
+        T get(batch<T, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_u16(arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_signed_t<T, 2> = 0>
+        T get(batch<T, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_s16(arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_unsigned_t<T, 4> = 0>
+        T get(batch<T, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_u32(arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_signed_t<T, 4> = 0>
+        T get(batch<T, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_s32(arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_unsigned_t<T, 8> = 0>
+        T get(batch<T, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_u64(arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_signed_t<T, 8> = 0>
+        T get(batch<T, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_s64(arg, I);
+        }
+
+        template <class A, size_t I>
+        float get(batch<float, A> const& arg, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vgetq_lane_f32(arg, I);
+        }
+
+        /**********
+         * insert *
+         **********/
+
+        template <class A, class T, size_t I, detail::enable_sized_unsigned_t<T, 1> = 0>
+        batch<T, A> insert(batch<T, A> const& arg, T val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_u8(val, arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_signed_t<T, 1> = 0>
+        batch<T, A> insert(batch<T, A> const& arg, T val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_s8(val, arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_unsigned_t<T, 2> = 0>
+        batch<T, A> insert(batch<T, A> const& arg, T val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_u16(val, arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_signed_t<T, 2> = 0>
+        batch<T, A> insert(batch<T, A> const& arg, T val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_s16(val, arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_unsigned_t<T, 4> = 0>
+        batch<T, A> insert(batch<T, A> const& arg, T val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_u32(val, arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_signed_t<T, 4> = 0>
+        batch<T, A> insert(batch<T, A> const& arg, T val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_s32(val, arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_unsigned_t<T, 8> = 0>
+        batch<T, A> insert(batch<T, A> const& arg, T val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_u64(val, arg, I);
+        }
+
+        template <class A, class T, size_t I, detail::enable_sized_signed_t<T, 8> = 0>
+        batch<T, A> insert(batch<T, A> const& arg, T val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_s64(val, arg, I);
+        }
+
+        template <class A, size_t I>
+        batch<float, A> insert(batch<float, A> const& arg, float val, ::xsimd::index<I>, requires_arch<neon>)
+        {
+            return vsetq_lane_f32(val, arg, I);
+        }
+
         /******************
          * bitwise_lshift *
          ******************/
@@ -2289,10 +2492,28 @@ namespace xsimd
 
         namespace detail
         {
-            template <class Tin, class Tout, class A>
-            batch<Tout, A> fast_cast(batch<Tin, A> const& in, batch<Tout, A> const& out, requires_arch<neon>)
+            template <class A>
+            batch<float, A> fast_cast(batch<int32_t, A> const& self, batch<float, A> const&, requires_arch<neon>)
+            {
+                return vcvtq_f32_s32(self);
+            }
+
+            template <class A>
+            batch<float, A> fast_cast(batch<uint32_t, A> const& self, batch<float, A> const&, requires_arch<neon>)
+            {
+                return vcvtq_f32_u32(self);
+            }
+
+            template <class A>
+            batch<int32_t, A> fast_cast(batch<float, A> const& self, batch<int32_t, A> const&, requires_arch<neon>)
+            {
+                return vcvtq_s32_f32(self);
+            }
+
+            template <class A>
+            batch<uint32_t, A> fast_cast(batch<float, A> const& self, batch<uint32_t, A> const&, requires_arch<neon>)
             {
-                return bitwise_cast(in, out, A{});
+                return vcvtq_u32_f32(self);
             }
         }
 
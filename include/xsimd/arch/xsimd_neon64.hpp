@@ -536,6 +536,85 @@ namespace xsimd
             return vmaxq_f64(lhs, rhs);
         }
 
+        /*********************
+         * min_propagate_nan *
+         *********************/
+
+        template <class A>
+        batch<double, A> min_propagate_nan(batch<double, A> const& lhs, batch<double, A> const& rhs, requires_arch<neon64>)
+        {
+            return vminq_f64(lhs, rhs);
+        }
+
+        /*********************
+         * max_propagate_nan *
+         *********************/
+
+        template <class A>
+        batch<double, A> max_propagate_nan(batch<double, A> const& lhs, batch<double, A> const& rhs, requires_arch<neon64>)
+        {
+            return vmaxq_f64(lhs, rhs);
+        }
+
+        /**********************
+         * clip_propagate_nan *
+         **********************/
+
+        template <class A>
+        batch<double, A> clip_propagate_nan(batch<double, A> const& self, batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<neon64>)
+        {
+            return vminq_f64(vmaxq_f64(self, lo), hi);
+        }
+
+        /******************
+         * min_ignore_nan *
+         ******************/
+
+        // vminnmq and vmaxnmq return the other operand when one is a quiet NaN
+        template <class A>
+        batch<float, A> min_ignore_nan(batch<float, A> const& lhs, batch<float, A> const& rhs, requires_arch<neon64>)
+        {
+            return vminnmq_f32(lhs, rhs);
+        }
+
+        template <class A>
+        batch<double, A> min_ignore_nan(batch<double, A> const& lhs, batch<double, A> const& rhs, requires_arch<neon64>)
+        {
+            return vminnmq_f64(lhs, rhs);
+        }
+
+        /******************
+         * max_ignore_nan *
+         ******************/
+
+        template <class A>
+        batch<float, A> max_ignore_nan(batch<float, A> const& lhs, batch<float, A> const& rhs, requires_arch<neon64>)
+        {
+            return vmaxnmq_f32(lhs, rhs);
+        }
+
+        template <class A>
+        batch<double, A> max_ignore_nan(batch<double, A> const& lhs, batch<double, A> const& rhs, requires_arch<neon64>)
+        {
+            return vmaxnmq_f64(lhs, rhs);
+        }
+
+        /*******************
+         * clip_ignore_nan *
+         *******************/
+
+        template <class A>
+        batch<float, A> clip_ignore_nan(batch<float, A> const& self, batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<neon64>)
+        {
+            return vminnmq_f32(vmaxnmq_f32(self, lo), hi);
+        }
+
+        template <class A>
+        batch<double, A> clip_ignore_nan(batch<double, A> const& self, batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<neon64>)
+        {
+            return vminnmq_f64(vmaxnmq_f64(self, lo), hi);
+        }
+
         /*******
          * abs *
          *******/
@@ -568,6 +647,40 @@ namespace xsimd
             return vsqrtq_f64(rhs);
         }
 
+        /**************
+         * reciprocal *
+         **************/
+
+        template <class A>
+        batch<double, A> reciprocal(batch<double, A> const& rhs, std::integral_constant<std::size_t, 0>, requires_arch<neon64>)
+        {
+            return vrecpeq_f64(rhs);
+        }
+
+        template <class A, std::size_t Steps>
+        batch<double, A> reciprocal(batch<double, A> const& rhs, std::integral_constant<std::size_t, Steps>, requires_arch<neon64>)
+        {
+            float64x2_t y = reciprocal(rhs, std::integral_constant<std::size_t, Steps - 1>(), A{});
+            return vmulq_f64(vrecpsq_f64(rhs, y), y);
+        }
+
+        /*********
+         * rsqrt *
+         *********/
+
+        template <class A>
+        batch<double, A> rsqrt(batch<double, A> const& rhs, std::integral_constant<std::size_t, 0>, requires_arch<neon64>)
+        {
+            return vrsqrteq_f64(rhs);
+        }
+
+        template <class A, std::size_t Steps>
+        batch<double, A> rsqrt(batch<double, A> const& rhs, std::integral_constant<std::size_t, Steps>, requires_arch<neon64>)
+        {
+            float64x2_t y = rsqrt(rhs, std::integral_constant<std::size_t, Steps - 1>(), A{});
+            return vmulq_f64(vrsqrtsq_f64(vmulq_f64(rhs, y), y), y);
+        }
+
         /********************
          * Fused operations *
          ********************/
@@ -745,6 +858,26 @@ namespace xsimd
             return detail::extract_pair(lhs, rhs, n, ::xsimd::detail::make_index_sequence<size>());
         }
 
+        /*******
+         * get *
+         *******/
+
+        template <class A, size_t I>
+        double get(batch<double, A> const& arg, ::xsimd::index<I>, requires_arch<neon64>)
+        {
+            return vgetq_lane_f64(arg, I);
+        }
+
+        /**********
+         * insert *
+         **********/
+
+        template <class A, size_t I>
+        batch<double, A> insert(batch<double, A> const& arg, double val, ::xsimd::index<I>, requires_arch<neon64>)
+        {
+            return vsetq_lane_f64(val, arg, I);
+        }
+
         /******************
          * bitwise_rshift *
          ******************/
@@ -894,6 +1027,37 @@ namespace xsimd
             return vcvtq_f64_s64(x);
         }
 
+        /*************
+         * fast_cast *
+         *************/
+
+        namespace detail
+        {
+            template <class A>
+            batch<double, A> fast_cast(batch<int64_t, A> const& self, batch<double, A> const&, requires_arch<neon64>)
+            {
+                return vcvtq_f64_s64(self);
+            }
+
+            template <class A>
+            batch<double, A> fast_cast(batch<uint64_t, A> const& self, batch<double, A> const&, requires_arch<neon64>)
+            {
+                return vcvtq_f64_u64(self);
+            }
+
+            template <class A>
+            batch<int64_t, A> fast_cast(batch<double, A> const& self, batch<int64_t, A> const&, requires_arch<neon64>)
+            {
+                return vcvtq_s64_f64(self);
+            }
+
+            template <class A>
+            batch<uint64_t, A> fast_cast(batch<double, A> const& self, batch<uint64_t, A> const&, requires_arch<neon64>)
+            {
+                return vcvtq_u64_f64(self);
+            }
+        }
+
         /*********
          * isnan *
          *********/
@@ -12,6 +12,7 @@
 #ifndef XSIMD_SSE2_HPP
 #define XSIMD_SSE2_HPP
 
+#include <array>
 #include <complex>
 #include <limits>
 #include <type_traits>
@@ -321,6 +322,22 @@ namespace xsimd {
       }
     }
 
+    // clip_ignore_nan
+    template<class A> batch<float, A> clip_ignore_nan(batch<float, A> const& self, batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<sse2>) {
+      return _mm_min_ps(_mm_max_ps(self, lo), hi);
+    }
+    template<class A> batch<double, A> clip_ignore_nan(batch<double, A> const& self, batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<sse2>) {
+      return _mm_min_pd(_mm_max_pd(self, lo), hi);
+    }
+
+    // clip_propagate_nan
+    template<class A> batch<float, A> clip_propagate_nan(batch<float, A> const& self, batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<sse2>) {
+      return _mm_min_ps(hi, _mm_max_ps(lo, self));
+    }
+    template<class A> batch<double, A> clip_propagate_nan(batch<double, A> const& self, batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<sse2>) {
+      return _mm_min_pd(hi, _mm_max_pd(lo, self));
+    }
+
     // div
     template<class A> batch<float, A> div(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
       return _mm_div_ps(self, other);
@@ -380,6 +397,30 @@ namespace xsimd {
     template<class A> batch_bool<double, A> ge(batch<double, A> const& self, batch<double, A> const& other, requires_arch<sse2>) {
       return _mm_cmpge_pd(self, other);
     }
+    // get
+    template<class A, std::size_t I> float get(batch<float, A> const& self, ::xsimd::index<I>, requires_arch<sse2>) {
+      return _mm_cvtss_f32(_mm_shuffle_ps(self, self, _MM_SHUFFLE(I, I, I, I)));
+    }
+    template<class A, std::size_t I> double get(batch<double, A> const& self, ::xsimd::index<I>, requires_arch<sse2>) {
+      return _mm_cvtsd_f64(_mm_shuffle_pd(self, self, I));
+    }
+    template<class A, class T, std::size_t I, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    T get(batch<T, A> const& self, ::xsimd::index<I>, requires_arch<sse2>) {
+      switch(sizeof(T)) {
+        case 1: return static_cast<T>(_mm_cvtsi128_si32(_mm_srli_si128(self, I)));
+        case 2: return static_cast<T>(_mm_extract_epi16(self, I & 7));
+        case 4: return static_cast<T>(_mm_cvtsi128_si32(_mm_shuffle_epi32(self, I & 3)));
+        case 8: {
+#if defined(__x86_64__)
+                  return static_cast<T>(_mm_cvtsi128_si64(_mm_srli_si128(self, 8 * (I & 1))));
+#else
+                  return get(self, ::xsimd::index<I>{}, generic{});
+#endif
+                }
+        default: assert(false && "unsupported arch/op combination"); return {};
+      }
+    }
+
     // gt
 
     template<class A> batch_bool<float, A> gt(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
@@ -474,6 +515,18 @@ namespace xsimd {
           _mm_unpackhi_pd(row[0], row[1]));
     }
 
+    // insert
+    template<class A, std::size_t I> batch<double, A> insert(batch<double, A> const& self, double val, ::xsimd::index<I>, requires_arch<sse2>) {
+      return I == 0 ? _mm_move_sd(self, _mm_set_sd(val)) : _mm_unpacklo_pd(self, _mm_set_sd(val));
+    }
+    template<class A, class T, std::size_t I, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> insert(batch<T, A> const& self, T val, ::xsimd::index<I>, requires_arch<sse2>) {
+      switch(sizeof(T)) {
+        case 2: return _mm_insert_epi16(self, val, I & 7);
+        default: return insert(self, val, ::xsimd::index<I>{}, generic{});
+      }
+    }
+
     // isnan
     template<class A> batch_bool<float, A> isnan(batch<float, A> const& self, requires_arch<sse2>) {
       return _mm_cmpunord_ps(self, self);
@@ -573,6 +626,24 @@ namespace xsimd {
       return _mm_cmplt_pd(self, other);
     }
 
+    // mask
+    template<class A> uint64_t mask(batch_bool<float, A> const& self, requires_arch<sse2>) {
+      return _mm_movemask_ps(self);
+    }
+    template<class A> uint64_t mask(batch_bool<double, A> const& self, requires_arch<sse2>) {
+      return _mm_movemask_pd(self);
+    }
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    uint64_t mask(batch_bool<T, A> const& self, requires_arch<sse2>) {
+      switch(sizeof(T)) {
+        case 1: return _mm_movemask_epi8(self);
+        case 2: return _mm_movemask_epi8(_mm_packs_epi16(self, _mm_setzero_si128()));
+        case 4: return _mm_movemask_ps(_mm_castsi128_ps(self));
+        case 8: return _mm_movemask_pd(_mm_castsi128_pd(self));
+        default: assert(false && "unsupported arch/op combination"); return {};
+      }
+    }
+
     // max
     template<class A> batch<float, A> max(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
       return _mm_max_ps(self, other);
@@ -585,6 +656,23 @@ namespace xsimd {
       return _mm_max_pd(self, other);
     }
 
+    // max_ignore_nan
+    // maxps and minps return their second operand when either one is NaN
+    template<class A> batch<float, A> max_ignore_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
+      return select(isnan(other), self, batch<float, A>(_mm_max_ps(self, other)));
+    }
+    template<class A> batch<double, A> max_ignore_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<sse2>) {
+      return select(isnan(other), self, batch<double, A>(_mm_max_pd(self, other)));
+    }
+
+    // max_propagate_nan
+    template<class A> batch<float, A> max_propagate_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
+      return _mm_or_ps(_mm_max_ps(self, other), _mm_cmpunord_ps(self, self));
+    }
+    template<class A> batch<double, A> max_propagate_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<sse2>) {
+      return _mm_or_pd(_mm_max_pd(self, other), _mm_cmpunord_pd(self, self));
+    }
+
     // min
     template<class A> batch<float, A> min(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
       return _mm_min_ps(self, other);
@@ -597,6 +685,22 @@ namespace xsimd {
       return _mm_min_pd(self, other);
     }
 
+    // min_ignore_nan
+    template<class A> batch<float, A> min_ignore_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
+      return select(isnan(other), self, batch<float, A>(_mm_min_ps(self, other)));
+    }
+    template<class A> batch<double, A> min_ignore_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<sse2>) {
+      return select(isnan(other), self, batch<double, A>(_mm_min_pd(self, other)));
+    }
+
+    // min_propagate_nan
+    template<class A> batch<float, A> min_propagate_nan(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
+      return _mm_or_ps(_mm_min_ps(self, other), _mm_cmpunord_ps(self, self));
+    }
+    template<class A> batch<double, A> min_propagate_nan(batch<double, A> const& self, batch<double, A> const& other, requires_arch<sse2>) {
+      return _mm_or_pd(_mm_min_pd(self, other), _mm_cmpunord_pd(self, self));
+    }
+
     // mul
     template<class A> batch<float, A> mul(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
       return _mm_mul_ps(self, other);
@@ -605,6 +709,24 @@ namespace xsimd {
       return _mm_mul_pd(self, other);
     }
 
+    // narrow
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<narrow_type_t<T>, A> narrow(batch<T, A> const& lo, batch<T, A> const& hi, requires_arch<sse2>) {
+      switch(sizeof(T)) {
+        case 2: {
+          __m128i mask = _mm_set1_epi16(0xFF);
+          return _mm_packus_epi16(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+        }
+        // sign-extending the low half makes the saturation of packs a no-op
+        case 4: return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+        case 8: return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi), _MM_SHUFFLE(2, 0, 2, 0)));
+        default: assert(false && "unsupported arch/op combination"); return {};
+      }
+    }
+    template<class A> batch<float, A> narrow(batch<double, A> const& lo, batch<double, A> const& hi, requires_arch<sse2>) {
+      return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+    }
+
     // neg
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> neg(batch<T, A> const& self, requires_arch<sse2>) {
@@ -645,6 +767,16 @@ namespace xsimd {
       return _mm_cmpneq_pd(self, other);
     }
 
+    // reciprocal
+    template<class A> batch<float, A> reciprocal(batch<float, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<sse2>) {
+      return _mm_rcp_ps(self);
+    }
+
+    // rsqrt
+    template<class A> batch<float, A> rsqrt(batch<float, A> const& self, std::integral_constant<std::size_t, 0>, requires_arch<sse2>) {
+      return _mm_rsqrt_ps(self);
+    }
+
     // select
     template<class A> batch<float, A> select(batch_bool<float, A> const& cond, batch<float, A> const& true_br, batch<float, A> const& false_br, requires_arch<sse2>) {
       return _mm_or_ps(_mm_and_ps(cond, true_br), _mm_andnot_ps(cond, false_br));
@@ -663,6 +795,16 @@ namespace xsimd {
       return _mm_or_pd(_mm_and_pd(cond, true_br), _mm_andnot_pd(cond, false_br));
     }
 
+    // slide_left
+    template<size_t N, class A> batch<uint8_t, A> slide_left(batch<uint8_t, A> const& self, requires_arch<sse2>) {
+      return _mm_slli_si128(self, N < 16 ? N : 16);
+    }
+
+    // slide_right
+    template<size_t N, class A> batch<uint8_t, A> slide_right(batch<uint8_t, A> const& self, requires_arch<sse2>) {
+      return _mm_srli_si128(self, N < 16 ? N : 16);
+    }
+
     // sqrt
     template<class A> batch<float, A> sqrt(batch<float, A> const& val, requires_arch<sse2>) {
       return _mm_sqrt_ps(val);
@@ -854,6 +996,28 @@ namespace xsimd {
       return _mm_sub_pd(self, other);
     }
 
+    // swizzle
+    template<class A, uint32_t V0, uint32_t V1, uint32_t V2, uint32_t V3>
+    batch<float, A> swizzle(batch<float, A> const& self, batch_constant<batch<uint32_t, A>, V0, V1, V2, V3>, requires_arch<sse2>) {
+      constexpr uint32_t index = _MM_SHUFFLE(V3, V2, V1, V0);
+      return _mm_shuffle_ps(self, self, index);
+    }
+    template<class A, uint64_t V0, uint64_t V1>
+    batch<double, A> swizzle(batch<double, A> const& self, batch_constant<batch<uint64_t, A>, V0, V1>, requires_arch<sse2>) {
+      constexpr uint32_t index = _MM_SHUFFLE2(V1, V0);
+      return _mm_shuffle_pd(self, self, index);
+    }
+    template<class A, class T, uint32_t V0, uint32_t V1, uint32_t V2, uint32_t V3, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> swizzle(batch<T, A> const& self, batch_constant<batch<uint32_t, A>, V0, V1, V2, V3>, requires_arch<sse2>) {
+      constexpr uint32_t index = _MM_SHUFFLE(V3, V2, V1, V0);
+      return _mm_shuffle_epi32(self, index);
+    }
+    template<class A, class T, uint64_t V0, uint64_t V1, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> swizzle(batch<T, A> const& self, batch_constant<batch<uint64_t, A>, V0, V1>, requires_arch<sse2>) {
+      constexpr uint32_t index = _MM_SHUFFLE(2 * V1 + 1, 2 * V1, 2 * V0 + 1, 2 * V0);
+      return _mm_shuffle_epi32(self, index);
+    }
+
     // to_float
     template<class A>
     batch<float, A> to_float(batch<int32_t, A> const& self, requires_arch<sse2>) {
@@ -881,6 +1045,31 @@ namespace xsimd {
       return {(int64_t)buffer[0], (int64_t)buffer[1]};
     }
 
+    // widen
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& self, requires_arch<sse2>) {
+      using batch_type = batch<widen_type_t<T>, A>;
+      __m128i const zero = _mm_setzero_si128();
+      switch(sizeof(T)) {
+        case 1: {
+          __m128i sign = std::is_signed<T>::value ? _mm_cmpgt_epi8(zero, self) : zero;
+          return {{ batch_type(_mm_unpacklo_epi8(self, sign)), batch_type(_mm_unpackhi_epi8(self, sign)) }};
+        }
+        case 2: {
+          __m128i sign = std::is_signed<T>::value ? _mm_srai_epi16(self, 15) : zero;
+          return {{ batch_type(_mm_unpacklo_epi16(self, sign)), batch_type(_mm_unpackhi_epi16(self, sign)) }};
+        }
+        case 4: {
+          __m128i sign = std::is_signed<T>::value ? _mm_srai_epi32(self, 31) : zero;
+          return {{ batch_type(_mm_unpacklo_epi32(self, sign)), batch_type(_mm_unpackhi_epi32(self, sign)) }};
+        }
+        default: assert(false && "unsupported arch/op combination"); return {};
+      }
+    }
+    template<class A> std::array<batch<double, A>, 2> widen(batch<float, A> const& self, requires_arch<sse2>) {
+      return {{ batch<double, A>(_mm_cvtps_pd(self)), batch<double, A>(_mm_cvtps_pd(_mm_movehl_ps(self, self))) }};
+    }
+
     // zip_hi
     template<class A> batch<float, A> zip_hi(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) {
       return _mm_unpackhi_ps(self, other);
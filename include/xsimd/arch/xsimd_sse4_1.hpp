@@ -12,6 +12,7 @@
 #ifndef XSIMD_SSE4_1_HPP
 #define XSIMD_SSE4_1_HPP
 
+#include <array>
 #include <type_traits>
 
 #include "../types/xsimd_sse4_1_register.hpp"
@@ -50,6 +51,37 @@ namespace xsimd {
       return _mm_floor_pd(self);
     }
 
+    // get
+    template<class A, class T, std::size_t I, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    T get(batch<T, A> const& self, ::xsimd::index<I>, requires_arch<sse4_1>) {
+      switch(sizeof(T)) {
+        case 1: return static_cast<T>(_mm_extract_epi8(self, I & 15));
+        case 2: return static_cast<T>(_mm_extract_epi16(self, I & 7));
+        case 4: return static_cast<T>(_mm_extract_epi32(self, I & 3));
+#if defined(__x86_64__)
+        case 8: return static_cast<T>(_mm_extract_epi64(self, I & 1));
+#endif
+        default: return get(self, ::xsimd::index<I>{}, sse2{});
+      }
+    }
+
+    // insert
+    template<class A, std::size_t I> batch<float, A> insert(batch<float, A> const& self, float val, ::xsimd::index<I>, requires_arch<sse4_1>) {
+      return _mm_insert_ps(self, _mm_set_ss(val), I << 4);
+    }
+    template<class A, class T, std::size_t I, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> insert(batch<T, A> const& self, T val, ::xsimd::index<I>, requires_arch<sse4_1>) {
+      switch(sizeof(T)) {
+        case 1: return _mm_insert_epi8(self, val, I & 15);
+        case 2: return _mm_insert_epi16(self, val, I & 7);
+        case 4: return _mm_insert_epi32(self, val, I & 3);
+#if defined(__x86_64__)
+        case 8: return _mm_insert_epi64(self, val, I & 1);
+#endif
+        default: return insert(self, val, ::xsimd::index<I>{}, sse2{});
+      }
+    }
+
     // max
     template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
     batch<T, A> max(batch<T, A> const& self, batch<T, A> const& other, requires_arch<sse4_1>) {
@@ -177,6 +209,30 @@ namespace xsimd {
       return _mm_round_pd(self, _MM_FROUND_TO_ZERO);
     }
 
+    // widen
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& self, requires_arch<sse4_1>) {
+      using batch_type = batch<widen_type_t<T>, A>;
+      __m128i const high = _mm_unpackhi_epi64(self, self);
+      switch(sizeof(T)) {
+        case 1:
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm_cvtepi8_epi16(self)), batch_type(_mm_cvtepi8_epi16(high)) }};
+          else
+            return {{ batch_type(_mm_cvtepu8_epi16(self)), batch_type(_mm_cvtepu8_epi16(high)) }};
+        case 2:
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm_cvtepi16_epi32(self)), batch_type(_mm_cvtepi16_epi32(high)) }};
+          else
+            return {{ batch_type(_mm_cvtepu16_epi32(self)), batch_type(_mm_cvtepu16_epi32(high)) }};
+        case 4:
+          if(std::is_signed<T>::value)
+            return {{ batch_type(_mm_cvtepi32_epi64(self)), batch_type(_mm_cvtepi32_epi64(high)) }};
+          else
+            return {{ batch_type(_mm_cvtepu32_epi64(self)), batch_type(_mm_cvtepu32_epi64(high)) }};
+        default: assert(false && "unsupported arch/op combination"); return {};
+      }
+    }
 
   }
 
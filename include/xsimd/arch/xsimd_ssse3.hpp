@@ -34,6 +34,61 @@ namespace xsimd {
       }
     }
 
+    // compress
+    namespace detail {
+
+      // index of the k-th set bit of m, 32 if there is none
+      constexpr uint32_t nth_set_bit(uint32_t m, uint32_t k, uint32_t i = 0) {
+        return i == 32 ? 32 : (((m >> i) & 1) ? (k == 0 ? i : nth_set_bit(m, k - 1, i + 1)) : nth_set_bit(m, k, i + 1));
+      }
+
+      // byte b of the control packing the 32-bit lanes selected by the
+      // 4-bit mask m in front, 0x80 zeroing the bytes past them
+      constexpr uint64_t compress_byte(uint32_t m, uint32_t b) {
+        return nth_set_bit(m, b / 4) < 4 ? 4 * nth_set_bit(m, b / 4) + b % 4 : 0x80;
+      }
+
+      constexpr uint64_t compress_bytes(uint32_t m, uint32_t b, uint32_t end) {
+        return b == end ? 0 : (compress_byte(m, b) << (8 * (b % 8))) | compress_bytes(m, b + 1, end);
+      }
+
+      template<std::size_t... Ms>
+      struct compress_table_epi8 {
+        static constexpr uint64_t low[sizeof...(Ms)] = {compress_bytes(Ms, 0, 8)...};
+        static constexpr uint64_t high[sizeof...(Ms)] = {compress_bytes(Ms, 8, 16)...};
+      };
+
+      template<std::size_t... Ms>
+      constexpr uint64_t compress_table_epi8<Ms...>::low[sizeof...(Ms)];
+      template<std::size_t... Ms>
+      constexpr uint64_t compress_table_epi8<Ms...>::high[sizeof...(Ms)];
+
+      template<std::size_t... Ms>
+      compress_table_epi8<Ms...> make_compress_table_epi8(::xsimd::detail::index_sequence<Ms...>);
+
+      // mask holds one bit per 32-bit lane
+      inline __m128i compress_epi32(__m128i self, int mask) {
+        using table = decltype(make_compress_table_epi8(::xsimd::detail::make_index_sequence<16>()));
+        __m128i control = _mm_set_epi64x(static_cast<long long>(table::high[mask]), static_cast<long long>(table::low[mask]));
+        return _mm_shuffle_epi8(self, control);
+      }
+    }
+
+    template<class A> batch<float, A> compress(batch<float, A> const& self, batch_bool<float, A> const& mask, requires_arch<ssse3>) {
+      return _mm_castsi128_ps(detail::compress_epi32(_mm_castps_si128(self), _mm_movemask_ps(mask)));
+    }
+    template<class A> batch<double, A> compress(batch<double, A> const& self, batch_bool<double, A> const& mask, requires_arch<ssse3>) {
+      return _mm_castsi128_pd(detail::compress_epi32(_mm_castpd_si128(self), _mm_movemask_ps(_mm_castpd_ps(mask))));
+    }
+    template<class A, class T, class=typename std::enable_if<std::is_integral<T>::value, void>::type>
+    batch<T, A> compress(batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<ssse3>) {
+      switch(sizeof(T)) {
+        case 4:
+        case 8: return detail::compress_epi32(self, _mm_movemask_ps(_mm_castsi128_ps(mask)));
+        default: return compress(self, mask, generic{});
+      }
+    }
+
     // extract_pair
     namespace detail {
 
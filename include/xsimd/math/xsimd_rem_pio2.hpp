@@ -630,6 +630,115 @@ namespace xsimd
             }
             return n;
         }
+
+        /*
+         * Bits of 2/pi for the vectorized Payne-Hanek reduction of the
+         * generic trigonometric functions. The arguments are grouped by
+         * the top bits of their exponent field, 8 binades per group in
+         * single precision and 16 in double precision. The first group
+         * holds [2, 2^9) and [2^17, 2^33) respectively and is also used
+         * for the smaller arguments.
+         *
+         * For an argument x = M * 2^E, M being an integer of p bits, the
+         * group of lowest exponent E' <= E holds the four p-bit chunks
+         * following the bit of weight 2^(2 - E') of 2/pi, each chunk
+         * scaled by 2^E'. The bits of higher weight only contribute
+         * multiples of 4 to x * 2/pi, and x * 2^-E' times the chunks
+         * gives the remaining part, the integer part in [0, 2^(p+2+E-E'))
+         * followed by about 3p - E + E' fractional bits.
+         */
+        inline float const* two_over_pi_chunks(float)
+        {
+            static const float chunks[] = {
+                0.f, 1.5178198e-07f, 6.1231978e-15f, 7.0025807e-23f,
+                3.862381e-05f, 2.3237746e-07f, 4.3446327e-15f, 1.3891661e-22f,
+                0.009947062f, 1.2240454e-07f, 3.7793467e-15f, 8.343065e-22f,
+                2.546479f, 1.0273021e-07f, 1.1748381e-15f, 1.3017518e-22f,
+                3.8986468f, 7.289084e-08f, 2.330634e-15f, 2.9057248e-22f,
+                2.0536075f, 6.3406915e-08f, 1.3997341e-14f, 6.9469217e-22f,
+                1.723527f, 1.9710512e-08f, 2.183977e-15f, 8.1132024e-22f,
+                1.2229054f, 3.910155e-08f, 4.8749973e-15f, 1.7491962e-22f,
+                1.0637915f, 2.348364e-07f, 1.16550006e-14f, 7.3372026e-22f,
+                0.33068752f, 3.6641055e-08f, 1.3611695e-14f, 6.3811017e-22f,
+                0.65601516f, 8.178888e-08f, 2.9346642e-15f, 7.2588436e-22f,
+                3.939901f, 1.9553846e-07f, 1.2309783e-14f, 3.261883e-22f,
+                0.6147349f, 2.2836635e-07f, 1.0705712e-14f, 4.9498015e-22f,
+                1.3721898f, 4.9235496e-08f, 1.2178319e-14f, 5.070134e-22f,
+                3.280591f, 2.065239e-07f, 5.4725316e-15f, 1.9939657e-22f,
+                3.8313515f, 1.7961204e-07f, 8.304389e-15f, 2.2354884e-22f
+            };
+            return chunks;
+        }
+
+        inline double const* two_over_pi_chunks(double)
+        {
+            static const double chunks[] = {
+                1.8527845924154462e-11, 2.279962360289377e-16, 2.559905270305599e-32, 7.329559254404545e-50,
+                1.2142558523109415e-06, 1.3576977725601358e-16, 4.81953818432455e-32, 2.957948228841579e-48,
+                0.07957747154594763, 3.6713694254647716e-17, 3.2087587158633235e-32, 2.1583456778902414e-48,
+                3.189175235226362, 4.3741691480565566e-16, 3.545774185192947e-32, 3.0478130239445785e-49,
+                1.7882157948911472, 1.5234367206003325e-16, 2.0862259830451762e-32, 1.7049496831483584e-49,
+                0.5103339862352887, 4.253654870826111e-16, 3.450388732063305e-32, 1.4872837664620503e-48,
+                1.2481219159077686, 3.846807378729746e-16, 2.627843555365973e-32, 3.7521385144100336e-48,
+                0.9178809315451133, 3.805724749108984e-16, 1.5887340227454862e-33, 5.1121241281868537e-48,
+                2.2447297405700946, 2.5951216142066247e-16, 3.8937232051271757e-32, 2.8836265707213886e-48,
+                2.6082780017338334, 1.0454123669016002e-16, 2.2626548478095758e-32, 3.115851492332572e-48,
+                0.10712162851226159, 2.502473694127119e-16, 4.149827786317788e-32, 4.982803175497093e-48,
+                0.32304617959201254, 4.4117127852705725e-16, 3.3167291787541593e-32, 1.1823225587231503e-48,
+                3.154425742162666, 1.7290226089968797e-16, 4.4017864980512254e-32, 2.739011145275897e-48,
+                0.44543837247734563, 3.863809976060606e-16, 3.8380389340011755e-32, 7.8543006789305e-49,
+                0.24917867534881344, 3.4240267007100075e-16, 1.4199489814269176e-32, 3.5954761332594166e-48,
+                2.173667659859959, 3.177012592921605e-16, 1.7719146608934434e-32, 1.5027997954152476e-48,
+                1.4837565823026058, 1.9121436069721362e-16, 3.873967779781276e-32, 2.4796965051304288e-48,
+                3.4713777835839013, 1.1501910352729023e-16, 4.2612123359637206e-32, 2.558875559186264e-48,
+                0.2144249545602066, 3.658099793822584e-16, 1.1208208225983804e-32, 2.4539864595510845e-48,
+                0.5538220577239912, 1.0904249905917652e-17, 1.3023924160109389e-32, 3.5625433620439445e-48,
+                3.2823749994866245, 8.138318546931773e-17, 3.7698114370662344e-32, 5.3804452944026247e-48,
+                1.7279663554271467, 1.7032617957191412e-17, 1.917966324766787e-32, 1.8908398580150458e-49,
+                0.003069273488315094, 2.5346608929030836e-16, 7.165742631901172e-33, 4.5486217410900705e-48,
+                1.1479073302346148, 4.4082249790676595e-16, 4.4655291468209016e-32, 5.069071731652386e-48,
+                1.2547942557428216, 4.078544416925748e-16, 3.1347103215194135e-33, 4.2016231630752775e-49,
+                2.1963443615799303, 3.0732830901234695e-16, 3.671743417536405e-32, 2.432266398020413e-48,
+                3.62408050233184, 2.901251032823108e-16, 4.1486159690866e-32, 3.3103437178675997e-48,
+                3.7398008194767547, 4.0333818894136355e-16, 2.785165637737355e-32, 2.6935637590376014e-48,
+                3.5865052286217756, 9.360176577627237e-17, 9.929085860795639e-33, 1.0476224520656295e-49,
+                1.206662956689565, 8.106625487187335e-17, 9.317789208910476e-34, 1.525555516237526e-48,
+                3.8635296073387884, 1.1886184679269004e-16, 2.695081804001018e-32, 4.918997968841163e-48,
+                0.27634655484195214, 4.0525063563804476e-16, 3.854808683827439e-32, 1.6444036250610156e-48,
+                2.6478181222020805, 1.9455130175945967e-16, 9.673869436462498e-33, 4.499772144560882e-48,
+                3.4084566355577577, 3.12897312652063e-16, 3.836242977095426e-32, 3.740353357519718e-49,
+                0.614067913228197, 2.1901713896226046e-16, 2.049252989369422e-32, 1.004282409484044e-48,
+                3.5547613231317716, 9.98674668290314e-17, 1.2051780948162049e-32, 4.888563816336474e-48,
+                0.8380727637915659, 3.7162054702951937e-16, 2.783867278659594e-32, 5.0568611658845474e-48,
+                3.9366478440886365, 2.2781273929960126e-16, 4.65049990331141e-32, 4.8403767167599626e-48,
+                0.15311019289985373, 1.00536789416407e-16, 3.6813119363077e-32, 5.4624701767526084e-48,
+                2.229601884820335, 2.7151385812273734e-16, 1.4233798788963734e-33, 4.784456783539065e-49,
+                3.189123585488746, 1.6574565940573385e-16, 4.912550754442426e-32, 1.3628373338594585e-48,
+                2.403298590459547, 3.2955109149510116e-16, 4.930061128658754e-32, 4.0256996114699134e-48,
+                2.576424356891718, 6.978958485733502e-17, 3.711252541840691e-32, 9.70895387846203e-49,
+                0.5466532556211212, 5.5460964515409344e-17, 3.8360460680850275e-34, 8.917421400478699e-49,
+                1.4677603858035546, 2.636770689543735e-16, 4.427396445865667e-32, 2.6878701313345976e-48,
+                3.1446440217723644, 3.8514651803881004e-16, 9.517746489741221e-33, 4.660903813689338e-48,
+                3.390610873695325, 2.637859434462422e-16, 1.2576954742180193e-32, 1.2962217656987654e-48,
+                3.074218496843066, 4.14917859541508e-16, 3.1571447292814447e-32, 9.440592685273575e-49,
+                3.9834091071951643, 3.043458308716672e-17, 3.2126806902604583e-32, 4.730551118747817e-48,
+                0.6992491422881293, 1.5619576392910513e-16, 4.19649407900762e-32, 5.343527700181074e-49,
+                1.991788994851281, 1.8929781389305454e-16, 4.8028791681425663e-32, 3.302994165093773e-48,
+                1.8835665735656586, 1.894541337262863e-16, 1.0575995499036839e-32, 2.7296202851666393e-48,
+                1.4189651990142478, 2.1997889784876756e-16, 4.483198164327999e-32, 3.8879222159821815e-48,
+                1.3032825977569256, 6.903005425122802e-17, 4.561128491547907e-32, 3.398013047406657e-48,
+                3.928326597878344, 1.6854665894597815e-17, 3.928691869394093e-32, 6.7751184841085196e-49,
+                2.8119185551488175, 1.375191712592649e-16, 1.3420304459274733e-32, 3.245231287246045e-48,
+                1.8944302329126996, 1.0998295001402873e-16, 3.177133475357706e-32, 5.066569034504169e-48,
+                1.3797441666901475, 2.747362528728851e-16, 1.7138886142360313e-32, 6.180657988145131e-49,
+                2.91370820552747, 4.062333263117435e-16, 2.4024610733645098e-32, 4.750278844965364e-48,
+                0.7809574482937678, 2.0323186501923195e-16, 9.129832178538934e-33, 1.588596363701829e-48,
+                0.8273313803789679, 3.2401328715749993e-16, 3.098884916652274e-32, 3.6282720564727984e-48,
+                3.98934451606269, 4.0921817317335457e-16, 1.2122292315824263e-32, 5.078150010214356e-48,
+                1.682204684473151, 4.1890345353426013e-16, 1.43138457240637e-32, 4.20143651653232e-48
+            };
+            return chunks;
+        }
     }
 
 #undef XSIMD_LITTLE_ENDIAN
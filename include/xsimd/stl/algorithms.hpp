@@ -12,17 +12,98 @@
 #ifndef XSIMD_ALGORITHMS_HPP
 #define XSIMD_ALGORITHMS_HPP
 
+#include <algorithm>
 #include <array>
+#include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "../types/xsimd_api.hpp"
+#include "./execution.hpp"
+#include "./iterator.hpp"
 
 namespace xsimd
 {
+    namespace detail
+    {
+        template <class Iterator>
+        using iterator_value_type = typename std::decay<decltype(*std::declval<Iterator>())>::type;
+
+        // transform overloads for inputs and outputs of the same value type
+        template <class I, class O>
+        using same_value_transform = typename std::enable_if<std::is_same<iterator_value_type<I>, iterator_value_type<O>>::value>::type;
+
+        template <class I, class O>
+        using mixed_value_transform = typename std::enable_if<!std::is_same<iterator_value_type<I>, iterator_value_type<O>>::value>::type;
+
+        template <class... Iterators>
+        struct all_contiguous;
+
+        template <>
+        struct all_contiguous<> : std::true_type
+        {
+        };
+
+        template <class Iterator, class... Iterators>
+        struct all_contiguous<Iterator, Iterators...>
+            : std::integral_constant<bool, is_contiguous_iterator<Iterator>::value && all_contiguous<Iterators...>::value>
+        {
+        };
+
+        /*
+         * Transforms of ranges of which one at least is not contiguous,
+         * accessed through batch_access: whole batches from the first
+         * element, then a scalar tail.
+         */
+        template <class Arch, class I1, class O1, class UF>
+        void transform_access(I1 first, std::size_t size, O1 out_first, UF& f)
+        {
+            using value_type = iterator_value_type<I1>;
+            constexpr std::size_t simd_size = batch<value_type, Arch>::size;
+            auto const in = make_batch_access<Arch>(first);
+            auto const out = make_batch_access<Arch>(out_first);
+
+            std::size_t const end = size - size % simd_size;
+            for (std::size_t i = 0; i < end; i += simd_size)
+            {
+                out.store(i, f(in.load(i)));
+            }
+            for (std::size_t i = end; i < size; ++i)
+            {
+                out.set(i, f(in.get(i)));
+            }
+        }
+
+        template <class Arch, class I1, class I2, class O1, class UF>
+        void transform_access(I1 first_1, I2 first_2, std::size_t size, O1 out_first, UF& f)
+        {
+            using value_type = iterator_value_type<I1>;
+            constexpr std::size_t simd_size = batch<value_type, Arch>::size;
+            auto const in_1 = make_batch_access<Arch>(first_1);
+            auto const in_2 = make_batch_access<Arch>(first_2);
+            auto const out = make_batch_access<Arch>(out_first);
+
+            std::size_t const end = size - size % simd_size;
+            for (std::size_t i = 0; i < end; i += simd_size)
+            {
+                out.store(i, f(in_1.load(i), in_2.load(i)));
+            }
+            for (std::size_t i = end; i < size; ++i)
+            {
+                out.set(i, f(in_1.get(i), in_2.get(i)));
+            }
+        }
+    }
+
     template <class Arch=default_arch, class I1, class I2, class O1, class UF>
-    void transform(I1 first, I2 last, O1 out_first, UF&& f)
+    detail::same_value_transform<I1, O1> transform(I1 first, I2 last, O1 out_first, UF&& f)
     {
         using value_type = typename std::decay<decltype(*first)>::type;
         using batch_type = batch<value_type, Arch>;
@@ -30,6 +111,12 @@ namespace xsimd
         std::size_t size = static_cast<std::size_t>(std::distance(first, last));
         std::size_t simd_size = batch_type::size;
 
+        if (!detail::all_contiguous<I1, O1>::value)
+        {
+            detail::transform_access<Arch>(first, size, out_first, f);
+            return;
+        }
+
         const auto* ptr_begin = &(*first);
         auto* ptr_out = &(*out_first);
 
@@ -76,7 +163,7 @@ namespace xsimd
     }
 
     template <class Arch=default_arch, class I1, class I2, class I3, class O1, class UF>
-    void transform(I1 first_1, I2 last_1, I3 first_2, O1 out_first, UF&& f)
+    detail::same_value_transform<I1, O1> transform(I1 first_1, I2 last_1, I3 first_2, O1 out_first, UF&& f)
     {
         using value_type = typename std::decay<decltype(*first_1)>::type;
         using batch_type = batch<value_type, Arch>;
@@ -84,6 +171,12 @@ namespace xsimd
         std::size_t size = static_cast<std::size_t>(std::distance(first_1, last_1));
         std::size_t simd_size = batch_type::size;
 
+        if (!detail::all_contiguous<I1, I3, O1>::value)
+        {
+            detail::transform_access<Arch>(first_1, first_2, size, out_first, f);
+            return;
+        }
+
         const auto* ptr_begin_1 = &(*first_1);
         const auto* ptr_begin_2 = &(*first_2);
         auto* ptr_out = &(*out_first);
@@ -133,6 +226,68 @@ namespace xsimd
     }
 
 
+    // Overloads converting between the input and output value types,
+    // defined along with convert.
+    template <class Arch=default_arch, class I1, class I2, class O1, class UF>
+    detail::mixed_value_transform<I1, O1> transform(I1 first, I2 last, O1 out_first, UF&& f);
+
+    template <class Arch=default_arch, class I1, class I2, class I3, class O1, class UF>
+    detail::mixed_value_transform<I1, O1> transform(I1 first_1, I2 last_1, I3 first_2, O1 out_first, UF&& f);
+
+    template <class Arch=default_arch, class I1, class I2, class O1, class UF>
+    void transform(parallel_policy const& policy, I1 first, I2 last, O1 out_first, UF&& f)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return;
+        }
+
+        std::size_t head = detail::parallel_chunk_offset(&(*first), size);
+        std::size_t chunk = detail::parallel_chunk_size<value_type>(size - head, policy);
+        std::size_t count = (size - head + chunk - 1) / chunk;
+
+        if (head != 0)
+        {
+            transform<Arch>(first, first + head, out_first, f);
+        }
+        detail::thread_pool::instance().parallel_for(count, policy.threads, [&](std::size_t i)
+        {
+            std::size_t chunk_begin = head + i * chunk;
+            std::size_t chunk_end = std::min(chunk_begin + chunk, size);
+            transform<Arch>(first + chunk_begin, first + chunk_end, out_first + chunk_begin, f);
+        });
+    }
+
+    template <class Arch=default_arch, class I1, class I2, class I3, class O1, class UF>
+    void transform(parallel_policy const& policy, I1 first_1, I2 last_1, I3 first_2, O1 out_first, UF&& f)
+    {
+        using value_type = typename std::decay<decltype(*first_1)>::type;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first_1, last_1));
+        if (size == 0)
+        {
+            return;
+        }
+
+        std::size_t head = detail::parallel_chunk_offset(&(*first_1), size);
+        std::size_t chunk = detail::parallel_chunk_size<value_type>(size - head, policy);
+        std::size_t count = (size - head + chunk - 1) / chunk;
+
+        if (head != 0)
+        {
+            transform<Arch>(first_1, first_1 + head, first_2, out_first, f);
+        }
+        detail::thread_pool::instance().parallel_for(count, policy.threads, [&](std::size_t i)
+        {
+            std::size_t chunk_begin = head + i * chunk;
+            std::size_t chunk_end = std::min(chunk_begin + chunk, size);
+            transform<Arch>(first_1 + chunk_begin, first_1 + chunk_end, first_2 + chunk_begin, out_first + chunk_begin, f);
+        });
+    }
+
     // TODO: Remove this once we drop C++11 support
     namespace detail
     {
@@ -141,10 +296,138 @@ namespace xsimd
             template <class X, class Y>
             auto operator()(X&& x, Y&& y) -> decltype(x + y) { return x + y; }
         };
-    }
 
+        /**
+         * Number of independent accumulators used by default when reducing
+         * with the given architecture. Enough of them are needed to cover
+         * the latency of the reduction operation times its throughput,
+         * without spilling registers.
+         */
+        template <class Arch>
+        struct reduce_accumulators
+            : std::integral_constant<std::size_t, std::is_base_of<avx512f, Arch>::value ? 8 : 4>
+        {
+        };
+
+        template <class B, class Step, std::size_t... Is>
+        void reduce_step(std::array<B, sizeof...(Is)>& acc, std::size_t i, Step& step, index_sequence<Is...>)
+        {
+            (void)std::initializer_list<int>{(step(acc[Is], i + Is), 0)...};
+        }
+
+        /**
+         * Reduces the batches 0 to \c count - 1, \c count being non-zero,
+         * into a single one. Batch \c i is computed by \c make(i), or folded
+         * into an accumulator \c acc by \c step(acc, i). Batches are
+         * dispatched round-robin over K independent accumulators so that
+         * consecutive operations do not depend on each other, and the
+         * accumulators are combined pairwise with \c binfun at the end.
+         */
+        template <std::size_t K, class B, class Make, class Step, class F>
+        B reduce_indexed(std::size_t count, Make& make, Step& step, F& binfun)
+        {
+            static_assert(K > 0, "at least one accumulator");
+
+            B res;
+            std::size_t i = 0;
+            if (count >= K)
+            {
+                std::array<B, K> acc;
+                for (std::size_t k = 0; k < K; ++k)
+                {
+                    acc[k] = make(k);
+                }
+                for (i = K; i + K <= count; i += K)
+                {
+                    reduce_step(acc, i, step, make_index_sequence<K>());
+                }
+                for (std::size_t s = 1; s < K; s *= 2)
+                {
+                    for (std::size_t k = 0; k + s < K; k += 2 * s)
+                    {
+                        acc[k] = binfun(acc[k], acc[k + s]);
+                    }
+                }
+                res = acc[0];
+            }
+            else
+            {
+                res = make(0);
+                i = 1;
+            }
+
+            for (; i < count; ++i)
+            {
+                step(res, i);
+            }
+            return res;
+        }
+
+        /**
+         * Reduces the aligned range [\c ptr, \c end), which holds a non-zero
+         * multiple of B::size elements, into a single batch.
+         */
+        template <std::size_t K, class B, class T, class F>
+        B reduce_batches(T const* ptr, T const* end, F& binfun)
+        {
+            auto load = [ptr](std::size_t i) { return B::load_aligned(ptr + i * B::size); };
+            auto step = [ptr, &binfun](B& acc, std::size_t i) { acc = binfun(acc, B::load_aligned(ptr + i * B::size)); };
+            return reduce_indexed<K, B>(static_cast<std::size_t>(end - ptr) / B::size, load, step, binfun);
+        }
+
+        /**
+         * Reduces the \c size elements of a range into \c init. The first
+         * \c align_begin elements and the tail are folded one element at
+         * a time with \c fold(init, i), and the body one batch at a time
+         * with reduce_indexed, \c make and \c step receiving the index of
+         * the first element of the batch.
+         */
+        template <class B, std::size_t K, class Init, class Fold, class Make, class Step, class F>
+        Init reduce_range(std::size_t align_begin, std::size_t size, Init init, Fold& fold, Make& make, Step& step, F& binfun)
+        {
+            constexpr std::size_t simd_size = B::size;
+            std::size_t align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                init = static_cast<Init>(fold(init, i));
+            }
+
+            if (align_begin != align_end)
+            {
+                auto body_make = [&](std::size_t k) { return make(align_begin + k * simd_size); };
+                auto body_step = [&](B& acc, std::size_t k) { step(acc, align_begin + k * simd_size); };
+                B batch_init = reduce_indexed<K, B>((align_end - align_begin) / simd_size, body_make, body_step, binfun);
+
+                alignas(B) std::array<typename B::value_type, simd_size> arr;
+                xsimd::store_aligned(arr.data(), batch_init);
+                for (auto x : arr) init = static_cast<Init>(binfun(init, x));
+            }
+
+            for (std::size_t i = align_end; i < size; ++i)
+            {
+                init = static_cast<Init>(fold(init, i));
+            }
+            return init;
+        }
+
+        // the body of a contiguous range starts at its first aligned element
+        template <class B, std::size_t K, class T, class Init, class Fold, class Make, class Step, class F>
+        Init reduce_range(T const* ptr, std::size_t size, Init init, Fold& fold, Make& make, Step& step, F& binfun)
+        {
+            std::size_t align_begin = size < B::size ? size : xsimd::get_alignment_offset(ptr, size, B::size);
+            return reduce_range<B, K>(align_begin, size, init, fold, make, step, binfun);
+        }
+    }
 
-    template <class Arch=default_arch, class Iterator1, class Iterator2, class Init, class BinaryFunction = detail::plus>
+    /**
+     * Reduces [\c first, \c last) into \c init with \c binfun, which must be
+     * associative and commutative. The bulk of the range is processed with
+     * \c Accumulators independent batch accumulators, hiding the latency
+     * of \c binfun.
+     */
+    template <class Arch=default_arch, std::size_t Accumulators = detail::reduce_accumulators<Arch>::value,
+              class Iterator1, class Iterator2, class Init, class BinaryFunction = detail::plus>
     Init reduce(Iterator1 first, Iterator2 last, Init init, BinaryFunction&& binfun = detail::plus{})
     {
         using value_type = typename std::decay<decltype(*first)>::type;
@@ -153,11 +436,20 @@ namespace xsimd
         std::size_t size = static_cast<std::size_t>(std::distance(first, last));
         constexpr std::size_t simd_size = batch_type::size;
 
+        if (!is_contiguous_iterator<Iterator1>::value)
+        {
+            auto const in = detail::make_batch_access<Arch>(first);
+            auto fold = [&](Init acc, std::size_t i) { return binfun(acc, in.get(i)); };
+            auto make = [&](std::size_t i) { return in.load(i); };
+            auto step = [&](batch_type& acc, std::size_t i) { acc = binfun(acc, in.load(i)); };
+            return detail::reduce_range<batch_type, Accumulators>(0, size, init, fold, make, step, binfun);
+        }
+
         if(size < simd_size)
         {
             while(first != last)
             {
-                init = binfun(init, *first++);
+                init = static_cast<Init>(binfun(init, *first++));
             }
             return init;
         }
@@ -170,33 +462,3379 @@ namespace xsimd
         // reduce initial unaligned part
         for (std::size_t i = 0; i < align_begin; ++i)
         {
-            init = binfun(init, first[i]);
+            init = static_cast<Init>(binfun(init, first[i]));
         }
 
-        // reduce aligned part
-        auto ptr = ptr_begin + align_begin;
-        batch_type batch_init = batch_type::load_aligned(ptr);
-        ptr += simd_size;
-        for (auto const end = ptr_begin + align_end; ptr < end; ptr += simd_size)
+        if (align_begin != align_end)
         {
-            batch_type batch = batch_type::load_aligned(ptr);
-            batch_init = binfun(batch_init, batch);
-        }
+            // reduce aligned part
+            batch_type batch_init = detail::reduce_batches<Accumulators, batch_type>(ptr_begin + align_begin, ptr_begin + align_end, binfun);
 
-        // reduce across batch
-        alignas(batch_type) std::array<value_type, simd_size> arr;
-        xsimd::store_aligned(arr.data(), batch_init);
-        for (auto x : arr) init = binfun(init, x);
+            // reduce across batch
+            alignas(batch_type) std::array<value_type, simd_size> arr;
+            xsimd::store_aligned(arr.data(), batch_init);
+            for (auto x : arr) init = static_cast<Init>(binfun(init, x));
+        }
 
         // reduce final unaligned part
         for (std::size_t i = align_end; i < size; ++i)
         {
-            init = binfun(init, first[i]);
+            init = static_cast<Init>(binfun(init, first[i]));
         }
 
         return init;
     }
 
+    /**
+     * Parallel version of reduce. Each chunk is reduced independently,
+     * starting from its first element, and the partial results are then
+     * folded into \c init in chunk order: \c binfun must be associative.
+     */
+    template <class Arch=default_arch, std::size_t Accumulators = detail::reduce_accumulators<Arch>::value,
+              class Iterator1, class Iterator2, class Init, class BinaryFunction = detail::plus>
+    Init reduce(parallel_policy const& policy, Iterator1 first, Iterator2 last, Init init, BinaryFunction&& binfun = detail::plus{})
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return init;
+        }
+
+        std::size_t head = detail::parallel_chunk_offset(&(*first), size);
+        std::size_t chunk = detail::parallel_chunk_size<value_type>(size - head, policy);
+        std::size_t count = (size - head + chunk - 1) / chunk;
+
+        init = reduce<Arch, Accumulators>(first, first + head, init, binfun);
+
+        // wrapped to prevent the std::vector<bool> specialization, which
+        // cannot be written concurrently
+        struct partial { Init value; };
+        std::vector<partial> partials(count, partial{init});
+        detail::thread_pool::instance().parallel_for(count, policy.threads, [&](std::size_t i)
+        {
+            std::size_t chunk_begin = head + i * chunk;
+            std::size_t chunk_end = std::min(chunk_begin + chunk, size);
+            auto chunk_first = first + chunk_begin;
+            partials[i].value = reduce<Arch, Accumulators>(std::next(chunk_first), first + chunk_end, Init(*chunk_first), binfun);
+        });
+
+        for (auto const& p : partials)
+        {
+            init = binfun(init, p.value);
+        }
+        return init;
+    }
+
+    namespace detail
+    {
+        struct multiplies
+        {
+            template <class X, class Y>
+            auto operator()(X&& x, Y&& y) -> decltype(x * y) { return x * y; }
+        };
+
+        // Folds transform_op(x, y) into acc, with a single multiply-add
+        // for sums of products.
+        template <class ReduceOp, class TransformOp>
+        struct transform_reduce_step
+        {
+            template <class B, class R, class T>
+            static void apply(B& acc, B const& x, B const& y, R& reduce_op, T& transform_op)
+            {
+                acc = reduce_op(acc, transform_op(x, y));
+            }
+        };
+
+        template <>
+        struct transform_reduce_step<plus, multiplies>
+        {
+            template <class B, class R, class T>
+            static void apply(B& acc, B const& x, B const& y, R&, T&)
+            {
+                acc = fma(x, y, acc);
+            }
+        };
+    }
+
+    /**
+     * Reduces with \c reduce_op the results of \c transform_op on the
+     * pairs of elements of [\c first_1, \c last_1) and of the range
+     * starting at \c first_2, in a single pass and without intermediate
+     * buffer. \c reduce_op must be associative and commutative; sums of
+     * products are accumulated with fma. The second range is read with
+     * unaligned loads.
+     */
+    template <class Arch=default_arch, std::size_t Accumulators = detail::reduce_accumulators<Arch>::value,
+              class Iterator1, class Iterator2, class Iterator3, class Init, class ReduceOp, class TransformOp>
+    Init transform_reduce(Iterator1 first_1, Iterator2 last_1, Iterator3 first_2, Init init, ReduceOp&& reduce_op, TransformOp&& transform_op)
+    {
+        using value_type = typename std::decay<decltype(*first_1)>::type;
+        using batch_type = batch<value_type, Arch>;
+        using step_type = detail::transform_reduce_step<typename std::decay<ReduceOp>::type, typename std::decay<TransformOp>::type>;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first_1, last_1));
+        if (size == 0)
+        {
+            return init;
+        }
+
+        if (!detail::all_contiguous<Iterator1, Iterator3>::value)
+        {
+            auto const in_1 = detail::make_batch_access<Arch>(first_1);
+            auto const in_2 = detail::make_batch_access<Arch>(first_2);
+            auto fold = [&](Init acc, std::size_t i) { return reduce_op(acc, transform_op(in_1.get(i), in_2.get(i))); };
+            auto make = [&](std::size_t i) { return transform_op(in_1.load(i), in_2.load(i)); };
+            auto step = [&](batch_type& acc, std::size_t i) { step_type::apply(acc, in_1.load(i), in_2.load(i), reduce_op, transform_op); };
+            return detail::reduce_range<batch_type, Accumulators>(0, size, init, fold, make, step, reduce_op);
+        }
+
+        const auto* const ptr_1 = &(*first_1);
+        const auto* const ptr_2 = &(*first_2);
+        auto fold = [&](Init acc, std::size_t i) { return reduce_op(acc, transform_op(ptr_1[i], ptr_2[i])); };
+        auto make = [&](std::size_t i)
+        {
+            return transform_op(batch_type::load_aligned(ptr_1 + i), batch_type::load_unaligned(ptr_2 + i));
+        };
+        auto step = [&](batch_type& acc, std::size_t i)
+        {
+            step_type::apply(acc, batch_type::load_aligned(ptr_1 + i), batch_type::load_unaligned(ptr_2 + i), reduce_op, transform_op);
+        };
+        return detail::reduce_range<batch_type, Accumulators>(ptr_1, size, init, fold, make, step, reduce_op);
+    }
+
+    /**
+     * Reduces with \c reduce_op the results of \c transform_op on the
+     * elements of [\c first, \c last), in a single pass.
+     */
+    template <class Arch=default_arch, std::size_t Accumulators = detail::reduce_accumulators<Arch>::value,
+              class Iterator1, class Iterator2, class Init, class ReduceOp, class TransformOp>
+    Init transform_reduce(Iterator1 first, Iterator2 last, Init init, ReduceOp&& reduce_op, TransformOp&& transform_op)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        using batch_type = batch<value_type, Arch>;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return init;
+        }
+
+        if (!is_contiguous_iterator<Iterator1>::value)
+        {
+            auto const in = detail::make_batch_access<Arch>(first);
+            auto fold = [&](Init acc, std::size_t i) { return reduce_op(acc, transform_op(in.get(i))); };
+            auto make = [&](std::size_t i) { return transform_op(in.load(i)); };
+            auto step = [&](batch_type& acc, std::size_t i) { acc = reduce_op(acc, transform_op(in.load(i))); };
+            return detail::reduce_range<batch_type, Accumulators>(0, size, init, fold, make, step, reduce_op);
+        }
+
+        const auto* const ptr = &(*first);
+        auto fold = [&](Init acc, std::size_t i) { return reduce_op(acc, transform_op(ptr[i])); };
+        auto make = [&](std::size_t i) { return transform_op(batch_type::load_aligned(ptr + i)); };
+        auto step = [&](batch_type& acc, std::size_t i) { acc = reduce_op(acc, transform_op(batch_type::load_aligned(ptr + i))); };
+        return detail::reduce_range<batch_type, Accumulators>(ptr, size, init, fold, make, step, reduce_op);
+    }
+
+    /**
+     * Sum of \c init and of the products of the pairs of elements of
+     * [\c first_1, \c last_1) and of the range starting at \c first_2,
+     * computed with fma over independent accumulators.
+     */
+    template <class Arch=default_arch, std::size_t Accumulators = detail::reduce_accumulators<Arch>::value,
+              class Iterator1, class Iterator2, class Iterator3, class Init>
+    Init transform_reduce(Iterator1 first_1, Iterator2 last_1, Iterator3 first_2, Init init)
+    {
+        return transform_reduce<Arch, Accumulators>(first_1, last_1, first_2, init, detail::plus{}, detail::multiplies{});
+    }
+
+    template <class Arch=default_arch, std::size_t Accumulators = detail::reduce_accumulators<Arch>::value,
+              class Iterator1, class Iterator2, class Iterator3, class Init>
+    Init inner_product(Iterator1 first_1, Iterator2 last_1, Iterator3 first_2, Init init)
+    {
+        return transform_reduce<Arch, Accumulators>(first_1, last_1, first_2, init, detail::plus{}, detail::multiplies{});
+    }
+
+    template <class Arch=default_arch, std::size_t Accumulators = detail::reduce_accumulators<Arch>::value,
+              class Iterator1, class Iterator2, class Iterator3, class Init, class ReduceOp, class TransformOp>
+    Init inner_product(Iterator1 first_1, Iterator2 last_1, Iterator3 first_2, Init init, ReduceOp&& reduce_op, TransformOp&& transform_op)
+    {
+        return transform_reduce<Arch, Accumulators>(first_1, last_1, first_2, init, std::forward<ReduceOp>(reduce_op), std::forward<TransformOp>(transform_op));
+    }
+
+    namespace detail
+    {
+        /**
+         * Writes the running sums of [\c in, \c in + \c size), starting
+         * from \c init, to \c out, which may alias \c in. Element \c i of
+         * an inclusive scan includes \c in[i], the one of an exclusive scan
+         * stops right before it. Returns the sum of \c init and of the
+         * whole range.
+         *
+         * Each batch is scanned in registers independently of the previous
+         * ones, so that the only loop-carried dependency is the addition of
+         * the broadcast running total.
+         */
+        template <class Arch, bool Inclusive, class T>
+        T scan(T const* in, std::size_t size, T* out, T init)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            std::size_t align_begin = xsimd::get_alignment_offset(in, size, simd_size);
+            std::size_t align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+            auto scan_scalar = [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    T const x = in[i];
+                    if (!Inclusive)
+                    {
+                        out[i] = init;
+                    }
+                    init += x;
+                    if (Inclusive)
+                    {
+                        out[i] = init;
+                    }
+                }
+            };
+
+            scan_scalar(0, align_begin);
+
+            if (align_begin != align_end)
+            {
+                batch_type carry(init);
+                for (std::size_t i = align_begin; i < align_end; i += simd_size)
+                {
+                    batch_type const sums = xsimd::inclusive_scan(batch_type::load_aligned(in + i));
+                    batch_type const res = Inclusive ? sums : xsimd::slide_left<sizeof(T)>(sums);
+                    (res + carry).store_unaligned(out + i);
+                    carry += batch_type(sums.template get<simd_size - 1>());
+                }
+                init = carry.template get<0>();
+            }
+
+            scan_scalar(align_end, size);
+            return init;
+        }
+
+        /**
+         * Two-pass parallel scan: the totals of the chunks are computed
+         * concurrently, prefixed sequentially into the starting value of
+         * each chunk, and the chunks are then scanned concurrently.
+         */
+        template <class Arch, bool Inclusive, class T>
+        void parallel_scan(parallel_policy const& policy, T const* in, std::size_t size, T* out, T init)
+        {
+            std::size_t head = detail::parallel_chunk_offset(in, size);
+            std::size_t chunk = detail::parallel_chunk_size<T>(size - head, policy);
+            std::size_t count = (size - head + chunk - 1) / chunk;
+
+            init = scan<Arch, Inclusive>(in, head, out, init);
+
+            std::vector<T> offsets(count);
+            detail::thread_pool::instance().parallel_for(count, policy.threads, [&](std::size_t i)
+            {
+                std::size_t chunk_begin = head + i * chunk;
+                std::size_t chunk_end = std::min(chunk_begin + chunk, size);
+                offsets[i] = reduce<Arch>(in + chunk_begin, in + chunk_end, T(0));
+            });
+
+            for (auto& offset : offsets)
+            {
+                T const total = offset;
+                offset = init;
+                init += total;
+            }
+
+            detail::thread_pool::instance().parallel_for(count, policy.threads, [&](std::size_t i)
+            {
+                std::size_t chunk_begin = head + i * chunk;
+                std::size_t chunk_end = std::min(chunk_begin + chunk, size);
+                scan<Arch, Inclusive>(in + chunk_begin, chunk_end - chunk_begin, out + chunk_begin, offsets[i]);
+            });
+        }
+    }
+
+    /**
+     * Writes the running sums of [\c first, \c last), starting from
+     * \c init, to the range beginning at \c d_first, element \c i being
+     * the sum of \c init and of the elements up to and including the
+     * \c i-th one. The output may be the input range. Returns the end of
+     * the output range.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator, class T>
+    OutputIterator inclusive_scan(Iterator first, Iterator last, OutputIterator d_first, T init)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        static_assert(detail::all_contiguous<Iterator, OutputIterator>::value, "scans require contiguous ranges");
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        detail::scan<Arch, true>(&(*first), size, &(*d_first), value_type(init));
+        return d_first + size;
+    }
+
+    template <class Arch=default_arch, class Iterator, class OutputIterator>
+    OutputIterator inclusive_scan(Iterator first, Iterator last, OutputIterator d_first)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        return inclusive_scan<Arch>(first, last, d_first, value_type(0));
+    }
+
+    /**
+     * Writes the running sums of [\c first, \c last), starting from
+     * \c init, to the range beginning at \c d_first, element \c i being
+     * the sum of \c init and of the elements before the \c i-th one. The
+     * output may be the input range. Returns the end of the output range.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator, class T>
+    OutputIterator exclusive_scan(Iterator first, Iterator last, OutputIterator d_first, T init)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        static_assert(detail::all_contiguous<Iterator, OutputIterator>::value, "scans require contiguous ranges");
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        detail::scan<Arch, false>(&(*first), size, &(*d_first), value_type(init));
+        return d_first + size;
+    }
+
+    /**
+     * Parallel version of inclusive_scan, reading the input twice: once
+     * to sum each chunk, once to scan it from the sum of the previous
+     * chunks.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator, class T>
+    OutputIterator inclusive_scan(parallel_policy const& policy, Iterator first, Iterator last, OutputIterator d_first, T init)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        static_assert(detail::all_contiguous<Iterator, OutputIterator>::value, "scans require contiguous ranges");
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        detail::parallel_scan<Arch, true>(policy, &(*first), size, &(*d_first), value_type(init));
+        return d_first + size;
+    }
+
+    template <class Arch=default_arch, class Iterator, class OutputIterator>
+    OutputIterator inclusive_scan(parallel_policy const& policy, Iterator first, Iterator last, OutputIterator d_first)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        return inclusive_scan<Arch>(policy, first, last, d_first, value_type(0));
+    }
+
+    /**
+     * Parallel version of exclusive_scan.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator, class T>
+    OutputIterator exclusive_scan(parallel_policy const& policy, Iterator first, Iterator last, OutputIterator d_first, T init)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        static_assert(detail::all_contiguous<Iterator, OutputIterator>::value, "scans require contiguous ranges");
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        detail::parallel_scan<Arch, false>(policy, &(*first), size, &(*d_first), value_type(init));
+        return d_first + size;
+    }
+
+    /**
+     * Compensated summation algorithms of accurate_sum and accurate_dot,
+     * from the fastest to the most accurate.
+     */
+    enum class summation
+    {
+        /// Kahan summation: the rounding error of each addition is fed
+        /// back into the next term.
+        kahan,
+        /// Kahan-Babuska-Neumaier summation, which also handles terms
+        /// larger than the running sum.
+        neumaier,
+        /// Sum2 and Dot2 of Ogita, Rump and Oishi: sums and products are
+        /// computed with error-free transformations, giving a result as
+        /// accurate as if computed in twice the working precision.
+        ogita_rump_oishi
+    };
+
+    namespace detail
+    {
+        template <class Arch>
+        using has_fused_fma = kernel::detail::has_fused_fma<Arch>;
+
+        // Rounded sum and correction to add to it.
+        template <class T>
+        struct compensated
+        {
+            T sum;
+            T error;
+        };
+
+        // s.sum + s.error == a + b exactly.
+        template <class T>
+        compensated<T> two_sum(T const& a, T const& b)
+        {
+            T error;
+            T const s = kernel::detail::two_sum(a, b, error);
+            return { s, error };
+        }
+
+        // p.sum + p.error == a * b exactly.
+        template <class T>
+        compensated<T> two_product(T const& a, T const& b)
+        {
+            T const p = a * b;
+            return { p, std::fma(a, b, -p) };
+        }
+
+        template <class T, class A>
+        compensated<batch<T, A>> two_product(batch<T, A> const& a, batch<T, A> const& b)
+        {
+            batch<T, A> error;
+            batch<T, A> const p = kernel::detail::two_product(a, b, error, has_fused_fma<A> {});
+            return { p, error };
+        }
+
+        template <class T>
+        compensated<T> merge_compensated(compensated<T> const& a, compensated<T> const& b)
+        {
+            compensated<T> const s = two_sum(a.sum, b.sum);
+            return { s.sum, s.error + (a.error + b.error) };
+        }
+
+        template <class T>
+        T choose(bool cond, T const& a, T const& b)
+        {
+            return cond ? a : b;
+        }
+
+        template <class T, class A>
+        batch<T, A> choose(batch_bool<T, A> const& cond, batch<T, A> const& a, batch<T, A> const& b)
+        {
+            return select(cond, a, b);
+        }
+
+        template <summation Method>
+        struct compensated_add;
+
+        template <>
+        struct compensated_add<summation::kahan>
+        {
+            template <class T>
+            static void apply(compensated<T>& acc, T const& x)
+            {
+                T const y = x + acc.error;
+                T const t = acc.sum + y;
+                acc.error = y - (t - acc.sum);
+                acc.sum = t;
+            }
+
+            template <class T>
+            static void apply(compensated<T>& acc, T const& x, T const& y)
+            {
+                apply(acc, T(x * y));
+            }
+        };
+
+        template <>
+        struct compensated_add<summation::neumaier>
+        {
+            template <class T>
+            static void apply(compensated<T>& acc, T const& x)
+            {
+                using std::abs;
+                T const t = acc.sum + x;
+                acc.error += choose(abs(acc.sum) >= abs(x), T((acc.sum - t) + x), T((x - t) + acc.sum));
+                acc.sum = t;
+            }
+
+            template <class T>
+            static void apply(compensated<T>& acc, T const& x, T const& y)
+            {
+                apply(acc, T(x * y));
+            }
+        };
+
+        template <>
+        struct compensated_add<summation::ogita_rump_oishi>
+        {
+            template <class T>
+            static void apply(compensated<T>& acc, T const& x)
+            {
+                compensated<T> const s = two_sum(acc.sum, x);
+                acc.sum = s.sum;
+                acc.error += s.error;
+            }
+
+            template <class T>
+            static void apply(compensated<T>& acc, T const& x, T const& y)
+            {
+                compensated<T> const p = two_product(x, y);
+                compensated<T> const s = two_sum(acc.sum, p.sum);
+                acc.sum = s.sum;
+                acc.error += s.error + p.error;
+            }
+        };
+
+        /**
+         * Sums the \c size terms of a range starting at \c ptr. The
+         * unaligned head and tail terms are added one at a time with
+         * \c scalar_add(acc, i), the aligned body with \c batch_add(acc, i)
+         * over independent batch accumulators. The accumulators, then their
+         * lanes, are merged with error-free additions.
+         */
+        template <class Arch, class T, class ScalarAdd, class BatchAdd>
+        T compensated_reduce(T const* ptr, std::size_t size, ScalarAdd& scalar_add, BatchAdd& batch_add)
+        {
+            using batch_type = batch<T, Arch>;
+            using state_type = compensated<batch_type>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            compensated<T> res = { T(0), T(0) };
+            std::size_t align_begin = size < simd_size ? size : xsimd::get_alignment_offset(ptr, size, simd_size);
+            std::size_t align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                scalar_add(res, i);
+            }
+
+            if (align_begin != align_end)
+            {
+                auto make = [&](std::size_t k)
+                {
+                    state_type acc = { batch_type(T(0)), batch_type(T(0)) };
+                    batch_add(acc, align_begin + k * simd_size);
+                    return acc;
+                };
+                auto step = [&](state_type& acc, std::size_t k) { batch_add(acc, align_begin + k * simd_size); };
+                auto merge = [](state_type const& a, state_type const& b) { return merge_compensated(a, b); };
+                state_type acc = reduce_indexed<reduce_accumulators<Arch>::value, state_type>((align_end - align_begin) / simd_size, make, step, merge);
+
+                alignas(batch_type) std::array<T, simd_size> sums;
+                alignas(batch_type) std::array<T, simd_size> errors;
+                acc.sum.store_aligned(sums.data());
+                acc.error.store_aligned(errors.data());
+                for (std::size_t i = 0; i < simd_size; ++i)
+                {
+                    res = merge_compensated(res, compensated<T> { sums[i], errors[i] });
+                }
+            }
+
+            for (std::size_t i = align_end; i < size; ++i)
+            {
+                scalar_add(res, i);
+            }
+            return res.sum + res.error;
+        }
+
+        template <class Arch, summation Method, class T>
+        T accurate_sum(T const* ptr, std::size_t size)
+        {
+            using batch_type = batch<T, Arch>;
+            using add_type = compensated_add<Method>;
+            auto scalar_add = [ptr](compensated<T>& acc, std::size_t i) { add_type::apply(acc, ptr[i]); };
+            auto batch_add = [ptr](compensated<batch_type>& acc, std::size_t i) { add_type::apply(acc, batch_type::load_aligned(ptr + i)); };
+            return compensated_reduce<Arch>(ptr, size, scalar_add, batch_add);
+        }
+
+        template <class Arch, summation Method, class T>
+        T accurate_dot(T const* ptr_1, T const* ptr_2, std::size_t size)
+        {
+            using batch_type = batch<T, Arch>;
+            using add_type = compensated_add<Method>;
+            auto scalar_add = [ptr_1, ptr_2](compensated<T>& acc, std::size_t i) { add_type::apply(acc, ptr_1[i], ptr_2[i]); };
+            auto batch_add = [ptr_1, ptr_2](compensated<batch_type>& acc, std::size_t i)
+            {
+                add_type::apply(acc, batch_type::load_aligned(ptr_1 + i), batch_type::load_unaligned(ptr_2 + i));
+            };
+            return compensated_reduce<Arch>(ptr_1, size, scalar_add, batch_add);
+        }
+    }
+
+    /**
+     * Sum of the floating point values of [\c first, \c last), with a
+     * compensated summation \c method.
+     */
+    template <class Arch=default_arch, class Iterator1, class Iterator2>
+    typename std::decay<decltype(*std::declval<Iterator1>())>::type
+    accurate_sum(Iterator1 first, Iterator2 last, summation method = summation::ogita_rump_oishi)
+    {
+        static_assert(detail::all_contiguous<Iterator1>::value, "accurate_sum requires a contiguous range");
+        using value_type = typename std::decay<decltype(*first)>::type;
+        static_assert(std::is_floating_point<value_type>::value, "compensated summation of floating point values");
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return value_type(0);
+        }
+        switch (method)
+        {
+        case summation::kahan:
+            return detail::accurate_sum<Arch, summation::kahan>(&(*first), size);
+        case summation::neumaier:
+            return detail::accurate_sum<Arch, summation::neumaier>(&(*first), size);
+        default:
+            return detail::accurate_sum<Arch, summation::ogita_rump_oishi>(&(*first), size);
+        }
+    }
+
+    /**
+     * Dot product of the floating point values of [\c first_1, \c last_1)
+     * and of the range starting at \c first_2, with a compensated
+     * summation \c method. Only summation::ogita_rump_oishi also
+     * compensates the rounding of the products.
+     */
+    template <class Arch=default_arch, class Iterator1, class Iterator2, class Iterator3>
+    typename std::decay<decltype(*std::declval<Iterator1>())>::type
+    accurate_dot(Iterator1 first_1, Iterator2 last_1, Iterator3 first_2, summation method = summation::ogita_rump_oishi)
+    {
+        static_assert(detail::all_contiguous<Iterator1, Iterator3>::value, "accurate_dot requires contiguous ranges");
+        using value_type = typename std::decay<decltype(*first_1)>::type;
+        static_assert(std::is_floating_point<value_type>::value, "compensated dot product of floating point values");
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first_1, last_1));
+        if (size == 0)
+        {
+            return value_type(0);
+        }
+        switch (method)
+        {
+        case summation::kahan:
+            return detail::accurate_dot<Arch, summation::kahan>(&(*first_1), &(*first_2), size);
+        case summation::neumaier:
+            return detail::accurate_dot<Arch, summation::neumaier>(&(*first_1), &(*first_2), size);
+        default:
+            return detail::accurate_dot<Arch, summation::ogita_rump_oishi>(&(*first_1), &(*first_2), size);
+        }
+    }
+
+    /**
+     * Evaluation schemes of polyval.
+     */
+    enum class polynomial_scheme
+    {
+        /// Horner's scheme, or Estrin's scheme from degree 12 on
+        /// architectures without fused multiply-add.
+        automatic,
+        /// Horner's scheme: one multiply-add per coefficient, in a chain
+        /// as long as the degree.
+        horner,
+        /// Estrin's scheme on blocks of four coefficients, the blocks
+        /// being combined with Horner's scheme in x^4: two more
+        /// multiplications, a chain four times shorter, and fewer
+        /// interleaved batches as it needs more registers.
+        estrin
+    };
+
+    namespace detail
+    {
+        template <class F, std::size_t... Is>
+        void polyval_unroll(F&& f, index_sequence<Is...>)
+        {
+            (void)std::initializer_list<int>{(f(Is), 0)...};
+        }
+
+        /**
+         * Functors evaluating a series with \c n coefficients at the \c K
+         * batches of \c x, in place, one step of the recurrence at a time
+         * for all the batches so that their dependency chains overlap.
+         */
+        template <class T>
+        struct horner_eval
+        {
+            T const* c;
+            std::size_t n;
+
+            template <class B, std::size_t K>
+            void operator()(std::array<B, K>& x) const
+            {
+                auto const lanes = make_index_sequence<K>();
+                std::array<B, K> acc;
+                polyval_unroll([&](std::size_t b) { acc[b] = B(c[n - 1]); }, lanes);
+                for (std::size_t k = n - 1; k-- > 0;)
+                {
+                    B const ck(c[k]);
+                    polyval_unroll([&](std::size_t b) { acc[b] = fma(acc[b], x[b], ck); }, lanes);
+                }
+                x = acc;
+            }
+        };
+
+        template <class T>
+        struct estrin_eval
+        {
+            T const* c;
+            std::size_t n;
+
+            // p[0] + p[1] x + p[2] x^2 + p[3] x^3
+            template <class B>
+            static B block(T const* p, B const& x, B const& x2)
+            {
+                return fma(fma(B(p[3]), x, B(p[2])), x2, fma(B(p[1]), x, B(p[0])));
+            }
+
+            template <class B, std::size_t K>
+            void operator()(std::array<B, K>& x) const
+            {
+                auto const lanes = make_index_sequence<K>();
+                std::size_t const blocks = n / 4;
+                std::size_t const top = n % 4;
+                std::array<B, K> x2, x4, acc;
+                polyval_unroll([&](std::size_t b)
+                {
+                    x2[b] = x[b] * x[b];
+                    x4[b] = x2[b] * x2[b];
+                }, lanes);
+
+                // highest coefficients, then blocks of four from the top
+                std::size_t j = blocks;
+                if (top != 0)
+                {
+                    T const* ct = c + 4 * blocks;
+                    polyval_unroll([&](std::size_t b)
+                    {
+                        acc[b] = B(ct[top - 1]);
+                        for (std::size_t k = top - 1; k-- > 0;)
+                        {
+                            acc[b] = fma(acc[b], x[b], B(ct[k]));
+                        }
+                    }, lanes);
+                }
+                else
+                {
+                    --j;
+                    polyval_unroll([&](std::size_t b) { acc[b] = block(c + 4 * j, x[b], x2[b]); }, lanes);
+                }
+                while (j-- > 0)
+                {
+                    polyval_unroll([&](std::size_t b) { acc[b] = fma(acc[b], x4[b], block(c + 4 * j, x[b], x2[b])); }, lanes);
+                }
+                x = acc;
+            }
+        };
+
+        // Clenshaw's recurrence b_k = c_k + 2 x b_{k+1} - b_{k+2}, the
+        // result being c_0 + x b_1 - b_2, after mapping x from the domain
+        // of the series to [-1, 1] with x * scale + offset.
+        template <class T>
+        struct clenshaw_eval
+        {
+            T const* c;
+            std::size_t n;
+            T scale;
+            T offset;
+
+            template <class B, std::size_t K>
+            void operator()(std::array<B, K>& x) const
+            {
+                auto const lanes = make_index_sequence<K>();
+                std::array<B, K> u, two_u, b1, b2;
+                polyval_unroll([&](std::size_t b)
+                {
+                    u[b] = fma(x[b], B(scale), B(offset));
+                    two_u[b] = u[b] + u[b];
+                    b1[b] = B(T(0));
+                    b2[b] = B(T(0));
+                }, lanes);
+                for (std::size_t k = n - 1; k > 0; --k)
+                {
+                    B const ck(c[k]);
+                    polyval_unroll([&](std::size_t b)
+                    {
+                        B const t = fma(two_u[b], b1[b], ck - b2[b]);
+                        b2[b] = b1[b];
+                        b1[b] = t;
+                    }, lanes);
+                }
+                B const c0(c[0]);
+                polyval_unroll([&](std::size_t b) { x[b] = fma(u[b], b1[b], c0 - b2[b]); }, lanes);
+            }
+        };
+
+        /**
+         * Applies \c eval to the values of \c in from \c i on, \c K
+         * batches at a time then batch by batch, loaded with \c Mode, and
+         * returns the index of the first element left.
+         */
+        template <class Arch, std::size_t K, class T, class Eval, class Mode>
+        std::size_t polyval_body(T const* in, std::size_t i, std::size_t size, T* out, Eval const& eval, Mode)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            for (; i + K * simd_size <= size; i += K * simd_size)
+            {
+                std::array<batch_type, K> x;
+                polyval_unroll([&](std::size_t b) { x[b] = batch_type::load(in + i + b * simd_size, Mode()); }, make_index_sequence<K>());
+                eval(x);
+                polyval_unroll([&](std::size_t b) { x[b].store_unaligned(out + i + b * simd_size); }, make_index_sequence<K>());
+            }
+            for (; i + simd_size <= size; i += simd_size)
+            {
+                std::array<batch_type, 1> x = {{ batch_type::load(in + i, Mode()) }};
+                eval(x);
+                x[0].store_unaligned(out + i);
+            }
+            return i;
+        }
+
+        /**
+         * Applies \c eval to the \c size values of \c in and writes the
+         * results to \c out, which may alias \c in. The body is processed
+         * \c K aligned batches at a time, and the elements before and after
+         * it are padded into a batch, so that all of them go through the
+         * same operations. Inputs that are not aligned on their element
+         * size have no aligned body and are read with unaligned loads.
+         */
+        template <class Arch, std::size_t K, class T, class Eval>
+        void polyval_range(T const* in, std::size_t size, T* out, Eval const& eval)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            auto partial = [&](std::size_t begin, std::size_t end)
+            {
+                alignas(batch_type) std::array<T, simd_size> buffer;
+                buffer.fill(T(0));
+                std::copy(in + begin, in + end, buffer.begin());
+                std::array<batch_type, 1> x = {{ batch_type::load_aligned(buffer.data()) }};
+                eval(x);
+                x[0].store_aligned(buffer.data());
+                std::copy(buffer.begin(), buffer.begin() + (end - begin), out + begin);
+            };
+
+            std::size_t i = 0;
+            std::size_t const align_begin = xsimd::get_alignment_offset(in, size, simd_size);
+            if (align_begin >= simd_size)
+            {
+                i = polyval_body<Arch, K>(in, 0, size, out, eval, unaligned_mode());
+            }
+            else
+            {
+                if (align_begin != 0)
+                {
+                    partial(0, align_begin);
+                }
+                i = polyval_body<Arch, K>(in, align_begin, size, out, eval, aligned_mode());
+            }
+            if (i < size)
+            {
+                partial(i, size);
+            }
+        }
+
+        template <class T, class Iterator>
+        std::vector<T> polyval_coefficients(Iterator first, Iterator last)
+        {
+            std::vector<T> res;
+            for (; first != last; ++first)
+            {
+                res.push_back(static_cast<T>(*first));
+            }
+            return res;
+        }
+    }
+
+    /**
+     * Evaluates the polynomial c[0] + c[1] x + ... + c[n - 1] x^(n - 1),
+     * whose coefficients are [\c c_first, \c c_last) in increasing degree
+     * order, at each element of [\c first, \c last) and writes the results
+     * to the range beginning at \c d_first, which may be the input range.
+     * The evaluation uses multiply-adds and interleaves several batches
+     * to hide their latency. Returns the end of the output range.
+     */
+    template <class Arch=default_arch, class CoeffIterator, class Iterator, class OutputIterator>
+    OutputIterator polyval(CoeffIterator c_first, CoeffIterator c_last, Iterator first, Iterator last, OutputIterator d_first,
+                           polynomial_scheme scheme = polynomial_scheme::automatic)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        static_assert(std::is_floating_point<value_type>::value, "polynomials of floating point values");
+        static_assert(detail::all_contiguous<Iterator, OutputIterator>::value, "polyval requires contiguous ranges");
+        constexpr std::size_t interleave = detail::reduce_accumulators<Arch>::value;
+
+        std::size_t const size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        auto const coeffs = detail::polyval_coefficients<value_type>(c_first, c_last);
+        if (coeffs.empty())
+        {
+            std::fill(d_first, d_first + size, value_type(0));
+            return d_first + size;
+        }
+
+        // With enough interleaved batches, the multiply-add chains of
+        // Horner's scheme only limit architectures without fused
+        // multiply-add, on high degrees.
+        if (scheme == polynomial_scheme::automatic)
+        {
+            scheme = !detail::has_fused_fma<Arch>::value && coeffs.size() > 12 ? polynomial_scheme::estrin : polynomial_scheme::horner;
+        }
+        if (scheme == polynomial_scheme::estrin)
+        {
+            detail::estrin_eval<value_type> const eval { coeffs.data(), coeffs.size() };
+            detail::polyval_range<Arch, 4>(&(*first), size, &(*d_first), eval);
+        }
+        else
+        {
+            detail::horner_eval<value_type> const eval { coeffs.data(), coeffs.size() };
+            detail::polyval_range<Arch, interleave>(&(*first), size, &(*d_first), eval);
+        }
+        return d_first + size;
+    }
+
+    template <class Arch=default_arch, class Coefficients, class Iterator, class OutputIterator>
+    OutputIterator polyval(Coefficients const& coeffs, Iterator first, Iterator last, OutputIterator d_first,
+                           polynomial_scheme scheme = polynomial_scheme::automatic)
+    {
+        return polyval<Arch>(std::begin(coeffs), std::end(coeffs), first, last, d_first, scheme);
+    }
+
+    /**
+     * Evaluates the Chebyshev series c[0] T_0(u) + ... + c[n - 1] T_(n - 1)(u),
+     * whose coefficients are [\c c_first, \c c_last), at each element \c x
+     * of [\c first, \c last), \c u being \c x mapped from [\c lo, \c hi] to
+     * [-1, 1], and writes the results to the range beginning at \c d_first,
+     * which may be the input range. The series is computed with Clenshaw's
+     * recurrence. Returns the end of the output range.
+     */
+    template <class Arch=default_arch, class CoeffIterator, class Iterator, class OutputIterator>
+    OutputIterator chebval(CoeffIterator c_first, CoeffIterator c_last, Iterator first, Iterator last, OutputIterator d_first,
+                           double lo = -1., double hi = 1.)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        static_assert(std::is_floating_point<value_type>::value, "Chebyshev series of floating point values");
+        static_assert(detail::all_contiguous<Iterator, OutputIterator>::value, "chebval requires contiguous ranges");
+        constexpr std::size_t interleave = detail::reduce_accumulators<Arch>::value;
+        assert(lo < hi && "non-empty domain");
+
+        std::size_t const size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        auto const coeffs = detail::polyval_coefficients<value_type>(c_first, c_last);
+        if (coeffs.empty())
+        {
+            std::fill(d_first, d_first + size, value_type(0));
+            return d_first + size;
+        }
+
+        value_type const scale = static_cast<value_type>(2. / (hi - lo));
+        value_type const offset = static_cast<value_type>(-(lo + hi) / (hi - lo));
+        detail::clenshaw_eval<value_type> const eval { coeffs.data(), coeffs.size(), scale, offset };
+        detail::polyval_range<Arch, interleave>(&(*first), size, &(*d_first), eval);
+        return d_first + size;
+    }
+
+    template <class Arch=default_arch, class Coefficients, class Iterator, class OutputIterator>
+    OutputIterator chebval(Coefficients const& coeffs, Iterator first, Iterator last, OutputIterator d_first,
+                           double lo = -1., double hi = 1.)
+    {
+        return chebval<Arch>(std::begin(coeffs), std::end(coeffs), first, last, d_first, lo, hi);
+    }
+
+    namespace detail
+    {
+        // Index of the lowest set bit of a non-zero mask.
+        inline std::size_t countr_zero(uint64_t mask) noexcept
+        {
+#if defined(__GNUC__)
+            return static_cast<std::size_t>(__builtin_ctzll(mask));
+#else
+            std::size_t res = 0;
+            for (; (mask & 1) == 0; mask >>= 1)
+            {
+                ++res;
+            }
+            return res;
+#endif
+        }
+
+        inline std::size_t popcount(uint64_t mask) noexcept
+        {
+#if defined(__GNUC__)
+            return static_cast<std::size_t>(__builtin_popcountll(mask));
+#else
+            std::size_t res = 0;
+            for (; mask != 0; mask &= mask - 1)
+            {
+                ++res;
+            }
+            return res;
+#endif
+        }
+
+        template <class T>
+        struct equal_to
+        {
+            T value;
+
+            template <class X>
+            auto operator()(X const& x) const -> decltype(x == X(value))
+            {
+                return x == X(value);
+            }
+        };
+
+        template <class Predicate>
+        struct negation
+        {
+            Predicate& pred;
+
+            template <class X>
+            auto operator()(X const& x) const -> decltype(!pred(x))
+            {
+                return !pred(x);
+            }
+        };
+
+        // Whether the elements equal to value, if any, are exactly the
+        // elements equal to static_cast<T>(value).
+        template <class T, class U>
+        bool is_representable(U const& value)
+        {
+            return static_cast<U>(static_cast<T>(value)) == value;
+        }
+
+        /**
+         * Returns the index of the first element of [\c ptr, \c ptr + \c size)
+         * satisfying \c pred, or \c size if there is none. The aligned part is
+         * scanned four batches at a time, and the matching lane is only looked
+         * for once a block holds a match.
+         */
+        template <class Arch, class T, class Predicate>
+        std::size_t find_if_index(T const* ptr, std::size_t size, Predicate& pred)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+            constexpr std::size_t block = 4 * simd_size;
+
+            std::size_t align_begin = xsimd::get_alignment_offset(ptr, size, simd_size);
+            std::size_t align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                if (pred(ptr[i]))
+                {
+                    return i;
+                }
+            }
+
+            std::size_t i = align_begin;
+            for (; i + block <= align_end; i += block)
+            {
+                auto c0 = pred(batch_type::load_aligned(ptr + i));
+                auto c1 = pred(batch_type::load_aligned(ptr + i + simd_size));
+                auto c2 = pred(batch_type::load_aligned(ptr + i + 2 * simd_size));
+                auto c3 = pred(batch_type::load_aligned(ptr + i + 3 * simd_size));
+                if (xsimd::any((c0 | c1) | (c2 | c3)))
+                {
+                    if (xsimd::any(c0))
+                    {
+                        return i + countr_zero(c0.mask());
+                    }
+                    if (xsimd::any(c1))
+                    {
+                        return i + simd_size + countr_zero(c1.mask());
+                    }
+                    if (xsimd::any(c2))
+                    {
+                        return i + 2 * simd_size + countr_zero(c2.mask());
+                    }
+                    return i + 3 * simd_size + countr_zero(c3.mask());
+                }
+            }
+            for (; i < align_end; i += simd_size)
+            {
+                auto c = pred(batch_type::load_aligned(ptr + i));
+                if (xsimd::any(c))
+                {
+                    return i + countr_zero(c.mask());
+                }
+            }
+
+            for (i = align_end; i < size; ++i)
+            {
+                if (pred(ptr[i]))
+                {
+                    return i;
+                }
+            }
+            return size;
+        }
+
+        template <class Arch, class T, class Predicate>
+        std::size_t count_if(T const* ptr, std::size_t size, Predicate& pred)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            std::size_t align_begin = xsimd::get_alignment_offset(ptr, size, simd_size);
+            std::size_t align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+            std::size_t res = 0;
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                res += pred(ptr[i]) ? 1 : 0;
+            }
+            for (std::size_t i = align_begin; i < align_end; i += simd_size)
+            {
+                res += popcount(pred(batch_type::load_aligned(ptr + i)).mask());
+            }
+            for (std::size_t i = align_end; i < size; ++i)
+            {
+                res += pred(ptr[i]) ? 1 : 0;
+            }
+            return res;
+        }
+
+        // the same scans over strided, indirect or buffered ranges
+        template <class Access, class Predicate>
+        std::size_t find_if_index(Access const& in, std::size_t size, Predicate& pred)
+        {
+            constexpr std::size_t simd_size = Access::batch_type::size;
+            std::size_t i = 0;
+            for (; i + simd_size <= size; i += simd_size)
+            {
+                auto c = pred(in.load(i));
+                if (xsimd::any(c))
+                {
+                    return i + countr_zero(c.mask());
+                }
+            }
+            for (; i < size; ++i)
+            {
+                if (pred(in.get(i)))
+                {
+                    return i;
+                }
+            }
+            return size;
+        }
+
+        template <class Access, class Predicate>
+        std::size_t count_if(Access const& in, std::size_t size, Predicate& pred)
+        {
+            constexpr std::size_t simd_size = Access::batch_type::size;
+            std::size_t res = 0;
+            std::size_t i = 0;
+            for (; i + simd_size <= size; i += simd_size)
+            {
+                res += popcount(pred(in.load(i)).mask());
+            }
+            for (; i < size; ++i)
+            {
+                res += pred(in.get(i)) ? 1 : 0;
+            }
+            return res;
+        }
+    }
+
+    /**
+     * Returns an iterator to the first element of [\c first, \c last)
+     * satisfying \c pred, or \c last if there is none. \c pred is called
+     * both with scalars, returning a bool, and with batches, returning a
+     * batch_bool. The scan stops at the first batch holding a match.
+     * Strided and indirect ranges are read with gathers, the other
+     * non-contiguous ones through a buffer.
+     */
+    template <class Arch=default_arch, class Iterator, class Predicate>
+    Iterator find_if(Iterator first, Iterator last, Predicate&& pred)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return last;
+        }
+        if (!is_contiguous_iterator<Iterator>::value)
+        {
+            return first + detail::find_if_index(detail::make_batch_access<Arch>(first), size, pred);
+        }
+        return first + detail::find_if_index<Arch, value_type>(&(*first), size, pred);
+    }
+
+    /**
+     * Returns an iterator to the first element of [\c first, \c last)
+     * equal to \c value, or \c last if there is none.
+     */
+    template <class Arch=default_arch, class Iterator, class T>
+    Iterator find(Iterator first, Iterator last, T const& value)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+
+        if (!detail::is_representable<value_type>(value))
+        {
+            return last;
+        }
+        return find_if<Arch>(first, last, detail::equal_to<value_type>{static_cast<value_type>(value)});
+    }
+
+    /**
+     * Returns the number of elements of [\c first, \c last) satisfying
+     * \c pred, which is called both with scalars and with batches.
+     */
+    template <class Arch=default_arch, class Iterator, class Predicate>
+    typename std::iterator_traits<Iterator>::difference_type
+    count_if(Iterator first, Iterator last, Predicate&& pred)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return 0;
+        }
+        if (!is_contiguous_iterator<Iterator>::value)
+        {
+            return static_cast<difference_type>(detail::count_if(detail::make_batch_access<Arch>(first), size, pred));
+        }
+        return static_cast<difference_type>(detail::count_if<Arch, value_type>(&(*first), size, pred));
+    }
+
+    template <class Arch=default_arch, class Iterator, class T>
+    typename std::iterator_traits<Iterator>::difference_type
+    count(Iterator first, Iterator last, T const& value)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+
+        if (!detail::is_representable<value_type>(value))
+        {
+            return 0;
+        }
+        return count_if<Arch>(first, last, detail::equal_to<value_type>{static_cast<value_type>(value)});
+    }
+
+    template <class Arch=default_arch, class Iterator, class Predicate>
+    bool any_of(Iterator first, Iterator last, Predicate&& pred)
+    {
+        return find_if<Arch>(first, last, pred) != last;
+    }
+
+    template <class Arch=default_arch, class Iterator, class Predicate>
+    bool none_of(Iterator first, Iterator last, Predicate&& pred)
+    {
+        return find_if<Arch>(first, last, pred) == last;
+    }
+
+    template <class Arch=default_arch, class Iterator, class Predicate>
+    bool all_of(Iterator first, Iterator last, Predicate&& pred)
+    {
+        return find_if<Arch>(first, last, detail::negation<typename std::remove_reference<Predicate>::type>{pred}) == last;
+    }
+
+    namespace detail
+    {
+        /**
+         * Destination of the elements selected by the stream compaction
+         * algorithms. The compressed lanes of each batch are appended to a
+         * buffer of two batches, written out one whole batch at a time, so
+         * that nothing is stored past the selected elements.
+         */
+        template <class B>
+        class compress_sink
+        {
+        public:
+
+            using value_type = typename B::value_type;
+
+            explicit compress_sink(value_type* out) noexcept
+                : m_out(out)
+            {
+            }
+
+            void push(value_type value)
+            {
+                m_buffer[m_fill++] = value;
+                flush();
+            }
+
+            void push(B const& x, typename B::batch_bool_type const& mask)
+            {
+                compress(x, mask).store_unaligned(m_buffer + m_fill);
+                m_fill += popcount(mask.mask());
+                flush();
+            }
+
+            value_type* finish()
+            {
+                return std::copy(m_buffer, m_buffer + m_fill, m_out);
+            }
+
+        private:
+
+            void flush()
+            {
+                if (m_fill >= B::size)
+                {
+                    B::load_aligned(m_buffer).store_unaligned(m_out);
+                    B::load_aligned(m_buffer + B::size).store_aligned(m_buffer);
+                    m_out += B::size;
+                    m_fill -= B::size;
+                }
+            }
+
+            alignas(B::arch_type::alignment()) value_type m_buffer[2 * B::size];
+            value_type* m_out;
+            std::size_t m_fill = 0;
+        };
+
+        /**
+         * Destination of remove_if, writing back to the range being read.
+         * Whole compressed batches are stored: the lanes past the selected
+         * ones land on elements that have already been read.
+         */
+        template <class B>
+        class in_place_sink
+        {
+        public:
+
+            using value_type = typename B::value_type;
+
+            explicit in_place_sink(value_type* out) noexcept
+                : m_out(out)
+            {
+            }
+
+            void push(value_type value)
+            {
+                *m_out++ = value;
+            }
+
+            void push(B const& x, typename B::batch_bool_type const& mask)
+            {
+                compress(x, mask).store_unaligned(m_out);
+                m_out += popcount(mask.mask());
+            }
+
+            value_type* finish() const noexcept
+            {
+                return m_out;
+            }
+
+        private:
+
+            value_type* m_out;
+        };
+
+        template <class B>
+        struct discard_sink
+        {
+            void push(typename B::value_type) const noexcept
+            {
+            }
+
+            void push(B const&, typename B::batch_bool_type const&) const noexcept
+            {
+            }
+        };
+
+        /**
+         * Pushes the elements of [\c ptr, \c ptr + \c size) satisfying
+         * \c pred to \c selected and the other ones to \c rejected, in
+         * order, reading aligned batches.
+         */
+        template <class Arch, class T, class Predicate, class Selected, class Rejected>
+        void compact(T const* ptr, std::size_t size, Predicate& pred, Selected& selected, Rejected& rejected)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            std::size_t align_begin = xsimd::get_alignment_offset(ptr, size, simd_size);
+            std::size_t align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+            auto scalar_step = [&](std::size_t i)
+            {
+                T const value = ptr[i];
+                if (pred(value))
+                {
+                    selected.push(value);
+                }
+                else
+                {
+                    rejected.push(value);
+                }
+            };
+
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                scalar_step(i);
+            }
+            for (std::size_t i = align_begin; i < align_end; i += simd_size)
+            {
+                batch_type const x = batch_type::load_aligned(ptr + i);
+                auto const mask = pred(x);
+                selected.push(x, mask);
+                rejected.push(x, !mask);
+            }
+            for (std::size_t i = align_end; i < size; ++i)
+            {
+                scalar_step(i);
+            }
+        }
+    }
+
+    /**
+     * Copies the elements of [\c first, \c last) satisfying \c pred to the
+     * range starting at \c d_first, in order, and returns the end of the
+     * copied range, like std::copy_if. \c pred is called both with scalars
+     * and with batches. The selected lanes of each batch are packed with
+     * compress: native on avx512, table-driven shuffles on ssse3 and avx2.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator, class Predicate>
+    OutputIterator copy_if(Iterator first, Iterator last, OutputIterator d_first, Predicate&& pred)
+    {
+        static_assert(detail::all_contiguous<Iterator, OutputIterator>::value, "copy_if requires contiguous ranges");
+        using value_type = typename std::decay<decltype(*first)>::type;
+        using batch_type = batch<value_type, Arch>;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        value_type* out = &(*d_first);
+        detail::compress_sink<batch_type> selected(out);
+        detail::discard_sink<batch_type> rejected;
+        detail::compact<Arch>(&(*first), size, pred, selected, rejected);
+        return d_first + (selected.finish() - out);
+    }
+
+    /**
+     * Moves the elements of [\c first, \c last) not satisfying \c pred to
+     * the front of the range, in order, and returns its new end, like
+     * std::remove_if.
+     */
+    template <class Arch=default_arch, class Iterator, class Predicate>
+    Iterator remove_if(Iterator first, Iterator last, Predicate&& pred)
+    {
+        static_assert(detail::all_contiguous<Iterator>::value, "remove_if requires a contiguous range");
+        using value_type = typename std::decay<decltype(*first)>::type;
+        using batch_type = batch<value_type, Arch>;
+        using predicate_type = typename std::remove_reference<Predicate>::type;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return last;
+        }
+        value_type* ptr = &(*first);
+        detail::negation<predicate_type> keep { pred };
+        detail::in_place_sink<batch_type> selected(ptr);
+        detail::discard_sink<batch_type> rejected;
+        detail::compact<Arch>(ptr, size, keep, selected, rejected);
+        return first + (selected.finish() - ptr);
+    }
+
+    /**
+     * Copies the elements of [\c first, \c last) satisfying \c pred to the
+     * range starting at \c d_first_true and the other ones to the range
+     * starting at \c d_first_false, in order, and returns the ends of both
+     * ranges, like std::partition_copy.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator1, class OutputIterator2, class Predicate>
+    std::pair<OutputIterator1, OutputIterator2>
+    partition_copy(Iterator first, Iterator last, OutputIterator1 d_first_true, OutputIterator2 d_first_false, Predicate&& pred)
+    {
+        static_assert(detail::all_contiguous<Iterator, OutputIterator1, OutputIterator2>::value, "partition_copy requires contiguous ranges");
+        using value_type = typename std::decay<decltype(*first)>::type;
+        using batch_type = batch<value_type, Arch>;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return { d_first_true, d_first_false };
+        }
+        value_type* out_true = &(*d_first_true);
+        value_type* out_false = &(*d_first_false);
+        detail::compress_sink<batch_type> selected(out_true);
+        detail::compress_sink<batch_type> rejected(out_false);
+        detail::compact<Arch>(&(*first), size, pred, selected, rejected);
+        return { d_first_true + (selected.finish() - out_true), d_first_false + (rejected.finish() - out_false) };
+    }
+
+    /**
+     * Handling of NaN values by min_element, max_element and
+     * minmax_element.
+     */
+    enum class nan_policy
+    {
+        // NaNs are skipped; the first element is returned if all of them are NaN
+        ignore,
+        // the first NaN is returned, if any
+        propagate,
+        // the range is assumed to hold no NaN
+        fast
+    };
+
+    namespace detail
+    {
+        // Orders of min_element, max_element and of the maximum of
+        // minmax_element: whether x, coming after best in the range,
+        // replaces it.
+        struct first_min
+        {
+            template <class X>
+            static auto better(X const& x, X const& best) -> decltype(x < best)
+            {
+                return x < best;
+            }
+        };
+
+        struct first_max
+        {
+            template <class X>
+            static auto better(X const& x, X const& best) -> decltype(x < best)
+            {
+                return best < x;
+            }
+        };
+
+        struct last_max
+        {
+            template <class X>
+            static auto better(X const& x, X const& best) -> decltype(x < best)
+            {
+                return best <= x;
+            }
+        };
+
+        template <class Order, nan_policy Policy, bool Floating>
+        struct extremum_order : Order
+        {
+        };
+
+        template <class Order>
+        struct extremum_order<Order, nan_policy::ignore, true>
+        {
+            template <class X>
+            static auto better(X const& x, X const& best) -> decltype(x < best)
+            {
+                return Order::better(x, best) || (best != best && x == x);
+            }
+        };
+
+        template <class Order>
+        struct extremum_order<Order, nan_policy::propagate, true>
+        {
+            template <class X>
+            static auto better(X const& x, X const& best) -> decltype(x < best)
+            {
+                return best == best && (Order::better(x, best) || x != x);
+            }
+        };
+
+        /**
+         * Best element seen so far. Candidates may be submitted in any
+         * order: on ties, the outcome is the one of a sequential scan of
+         * the range.
+         */
+        template <class T, class Order>
+        struct extremum
+        {
+            T value = T();
+            std::size_t index = 0;
+            bool found = false;
+
+            void update(T const& v, std::size_t i)
+            {
+                if (!found || (i < index ? !Order::better(value, v) : Order::better(v, value)))
+                {
+                    value = v;
+                    index = i;
+                    found = true;
+                }
+            }
+        };
+
+        // Number of consecutive batch indices exactly representable in T.
+        template <class T, bool Floating = std::is_floating_point<T>::value>
+        struct max_batch_count
+            : std::integral_constant<std::size_t,
+                                     (static_cast<uintmax_t>(std::numeric_limits<T>::max()) < std::numeric_limits<std::size_t>::max()
+                                      ? static_cast<std::size_t>(std::numeric_limits<T>::max())
+                                      : std::numeric_limits<std::size_t>::max())>
+        {
+        };
+
+        template <class T>
+        struct max_batch_count<T, true>
+            : std::integral_constant<std::size_t,
+                                     (std::numeric_limits<T>::digits < std::numeric_limits<std::size_t>::digits
+                                      ? std::size_t(1) << (std::numeric_limits<T>::digits % std::numeric_limits<std::size_t>::digits)
+                                      : std::numeric_limits<std::size_t>::max())>
+        {
+        };
+
+        /**
+         * Per-lane best values and the index of the batch they come from,
+         * stored in a batch of T so that both are updated with the same
+         * mask. Two sets are updated alternately to hide the latency of
+         * the comparison and selection.
+         */
+        template <class B, class Order>
+        struct lane_extremum
+        {
+            using value_type = typename B::value_type;
+
+            explicit lane_extremum(extremum<value_type, Order>& r)
+                : res(r)
+            {
+            }
+
+            void init(B const& x0, B const& x1)
+            {
+                value[0] = x0;
+                value[1] = x1;
+                index[0] = B(value_type(0));
+                index[1] = B(value_type(1));
+            }
+
+            void update(B const& x, B const& i, std::size_t k)
+            {
+                auto better = Order::better(x, value[k]);
+                value[k] = select(better, x, value[k]);
+                index[k] = select(better, i, index[k]);
+            }
+
+            // Submits the lanes to res, ptr_index being the index of the
+            // first element of batch 0 in the range.
+            void resolve(std::size_t ptr_index) const
+            {
+                constexpr std::size_t size = B::size;
+                alignas(B::arch_type::alignment()) value_type values[size];
+                alignas(B::arch_type::alignment()) value_type indices[size];
+                for (std::size_t k = 0; k < 2; ++k)
+                {
+                    value[k].store_aligned(values);
+                    index[k].store_aligned(indices);
+                    for (std::size_t l = 0; l < size; ++l)
+                    {
+                        res.update(values[l], ptr_index + static_cast<std::size_t>(indices[l]) * size + l);
+                    }
+                }
+            }
+
+            extremum<value_type, Order>& res;
+            B value[2];
+            B index[2];
+        };
+
+        // Processes count >= 2 batches from ptr, whose batch indices are
+        // representable in T.
+        template <class B, class... Lanes>
+        void extremum_block(typename B::value_type const* ptr, std::size_t count, std::size_t ptr_index, Lanes&&... lanes)
+        {
+            using value_type = typename B::value_type;
+            constexpr std::size_t size = B::size;
+
+            B x0 = B::load_aligned(ptr);
+            B x1 = B::load_aligned(ptr + size);
+            (void)std::initializer_list<int>{(lanes.init(x0, x1), 0)...};
+
+            B i0(value_type(2)), i1(value_type(3));
+            B const two(value_type(2));
+            std::size_t b = 2;
+            for (; b + 1 < count; b += 2)
+            {
+                x0 = B::load_aligned(ptr + b * size);
+                x1 = B::load_aligned(ptr + (b + 1) * size);
+                (void)std::initializer_list<int>{(lanes.update(x0, i0, 0), lanes.update(x1, i1, 1), 0)...};
+                i0 += two;
+                i1 += two;
+            }
+            if (b < count)
+            {
+                x0 = B::load_aligned(ptr + b * size);
+                (void)std::initializer_list<int>{(lanes.update(x0, i0, 0), 0)...};
+            }
+            (void)std::initializer_list<int>{(lanes.resolve(ptr_index), 0)...};
+        }
+
+        /**
+         * Submits to each of \c res the elements of the aligned range
+         * [\c ptr, \c ptr + \c count * B::size), \c ptr_index being the
+         * index of \c ptr in the whole range. The range is split in blocks
+         * short enough for the batch indices to be represented in T.
+         */
+        template <class B, class... Orders>
+        void extremum_batches(typename B::value_type const* ptr, std::size_t count, std::size_t ptr_index,
+                              extremum<typename B::value_type, Orders>&... res)
+        {
+            using value_type = typename B::value_type;
+            constexpr std::size_t size = B::size;
+            constexpr std::size_t max_count = max_batch_count<value_type>::value;
+
+            for (std::size_t block = 0; block < count; block += std::min(max_count, count - block))
+            {
+                std::size_t const block_count = std::min(max_count, count - block);
+                value_type const* block_ptr = ptr + block * size;
+                std::size_t const block_index = ptr_index + block * size;
+                if (block_count == 1)
+                {
+                    for (std::size_t l = 0; l < size; ++l)
+                    {
+                        (void)std::initializer_list<int>{(res.update(block_ptr[l], block_index + l), 0)...};
+                    }
+                }
+                else
+                {
+                    extremum_block<B>(block_ptr, block_count, block_index, lane_extremum<B, Orders>(res)...);
+                }
+            }
+        }
+
+        /**
+         * Submits each element of [\c ptr, \c ptr + \c size) to each of
+         * \c res: the aligned part with batches, the rest one by one.
+         */
+        template <class Arch, class T, class... Orders>
+        void extremum_elements(T const* ptr, std::size_t size, extremum<T, Orders>&... res)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            std::size_t align_begin = xsimd::get_alignment_offset(ptr, size, simd_size);
+            std::size_t align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                (void)std::initializer_list<int>{(res.update(ptr[i], i), 0)...};
+            }
+            if (align_begin != align_end)
+            {
+                extremum_batches<batch_type>(ptr + align_begin, (align_end - align_begin) / simd_size, align_begin, res...);
+            }
+            for (std::size_t i = align_end; i < size; ++i)
+            {
+                (void)std::initializer_list<int>{(res.update(ptr[i], i), 0)...};
+            }
+        }
+
+        template <class Arch, class Order, nan_policy Policy, class T>
+        std::size_t extremum_index(T const* ptr, std::size_t size)
+        {
+            extremum<T, extremum_order<Order, Policy, std::is_floating_point<T>::value>> res;
+            extremum_elements<Arch>(ptr, size, res);
+            return res.index;
+        }
+
+        template <class Arch, class Order, class T>
+        std::size_t extremum_index(T const* ptr, std::size_t size, nan_policy policy)
+        {
+            switch (policy)
+            {
+            case nan_policy::propagate:
+                return extremum_index<Arch, Order, nan_policy::propagate>(ptr, size);
+            case nan_policy::fast:
+                return extremum_index<Arch, Order, nan_policy::fast>(ptr, size);
+            default:
+                return extremum_index<Arch, Order, nan_policy::ignore>(ptr, size);
+            }
+        }
+
+        template <class Arch, nan_policy Policy, class T>
+        std::pair<std::size_t, std::size_t> minmax_index(T const* ptr, std::size_t size)
+        {
+            constexpr bool floating = std::is_floating_point<T>::value;
+            extremum<T, extremum_order<first_min, Policy, floating>> min_res;
+            extremum<T, extremum_order<last_max, Policy, floating>> max_res;
+            extremum_elements<Arch>(ptr, size, min_res, max_res);
+            return { min_res.index, max_res.index };
+        }
+    }
+
+    /**
+     * Returns an iterator to the first smallest element of
+     * [\c first, \c last), or \c last if the range is empty. Each lane
+     * tracks its smallest value and where it comes from, and the lanes
+     * are resolved at the end. For ranges without NaN, the result is the
+     * one of std::min_element whatever the \c policy.
+     */
+    template <class Arch=default_arch, class Iterator>
+    Iterator min_element(Iterator first, Iterator last, nan_policy policy = nan_policy::ignore)
+    {
+        static_assert(detail::all_contiguous<Iterator>::value, "min_element requires a contiguous range");
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return last;
+        }
+        return first + detail::extremum_index<Arch, detail::first_min>(&(*first), size, policy);
+    }
+
+    /**
+     * Returns an iterator to the first largest element of
+     * [\c first, \c last), or \c last if the range is empty.
+     */
+    template <class Arch=default_arch, class Iterator>
+    Iterator max_element(Iterator first, Iterator last, nan_policy policy = nan_policy::ignore)
+    {
+        static_assert(detail::all_contiguous<Iterator>::value, "max_element requires a contiguous range");
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return last;
+        }
+        return first + detail::extremum_index<Arch, detail::first_max>(&(*first), size, policy);
+    }
+
+    /**
+     * Returns iterators to the first smallest and to the last largest
+     * elements of [\c first, \c last), like std::minmax_element, in a
+     * single pass. Both are \c first if the range is empty.
+     */
+    template <class Arch=default_arch, class Iterator>
+    std::pair<Iterator, Iterator> minmax_element(Iterator first, Iterator last, nan_policy policy = nan_policy::ignore)
+    {
+        static_assert(detail::all_contiguous<Iterator>::value, "minmax_element requires a contiguous range");
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return { first, first };
+        }
+        std::pair<std::size_t, std::size_t> res;
+        switch (policy)
+        {
+        case nan_policy::propagate:
+            res = detail::minmax_index<Arch, nan_policy::propagate>(&(*first), size);
+            break;
+        case nan_policy::fast:
+            res = detail::minmax_index<Arch, nan_policy::fast>(&(*first), size);
+            break;
+        default:
+            res = detail::minmax_index<Arch, nan_policy::ignore>(&(*first), size);
+            break;
+        }
+        return { first + res.first, first + res.second };
+    }
+
+    namespace detail
+    {
+        template <class T>
+        struct less_than
+        {
+            T value;
+
+            template <class X>
+            auto operator()(X const& x) const -> decltype(x < X(value))
+            {
+                return x < X(value);
+            }
+        };
+
+        template <class T>
+        struct less_equal
+        {
+            T value;
+
+            template <class X>
+            auto operator()(X const& x) const -> decltype(x <= X(value))
+            {
+                return x <= X(value);
+            }
+        };
+
+        struct not_nan
+        {
+            template <class X>
+            auto operator()(X const& x) const -> decltype(x == x)
+            {
+                return x == x;
+            }
+        };
+
+        // Compare-exchange: lo receives the lane-wise smallest values of a
+        // and b, hi the largest ones. For floating point values, select
+        // keeps -0. and +0. apart where min and max may return either.
+        template <class B>
+        void sort_exchange(B const& a, B const& b, B& lo, B& hi, std::true_type)
+        {
+            lo = min(a, b);
+            hi = max(a, b);
+        }
+
+        template <class B>
+        void sort_exchange(B const& a, B const& b, B& lo, B& hi, std::false_type)
+        {
+            auto const swap = b < a;
+            lo = select(swap, b, a);
+            hi = select(swap, a, b);
+        }
+
+        template <class B>
+        void sort_exchange(B const& a, B const& b, B& lo, B& hi)
+        {
+            sort_exchange(a, b, lo, hi, std::is_integral<typename B::value_type>{});
+        }
+
+        /**
+         * Bitonic sorting network over the K * B::size lanes of K batches,
+         * lane i of batch r holding element r * B::size + i. Each stage
+         * merges runs of Kk elements, alternately ascending and descending,
+         * by exchanging elements J apart for J = Kk / 2 down to 1. Exchanges
+         * between batches are lane-wise min and max, exchanges within a
+         * batch compare it to a swizzled copy of itself.
+         */
+        template <class B, std::size_t K>
+        struct bitonic_sort
+        {
+            using value_type = typename B::value_type;
+            using index_type = as_unsigned_integer_t<value_type>;
+            using index_batch = batch<index_type, typename B::arch_type>;
+            static constexpr std::size_t size = B::size;
+
+            template <std::size_t J>
+            struct partner
+            {
+                static constexpr index_type get(std::size_t i, std::size_t)
+                {
+                    return static_cast<index_type>(i ^ J);
+                }
+            };
+
+            // whether lane i keeps the largest value of its exchange, for
+            // runs of Kk lanes (descending when i & Kk is set)
+            template <std::size_t J, std::size_t Kk>
+            struct upper
+            {
+                static constexpr bool get(std::size_t i, std::size_t)
+                {
+                    return ((i & J) != 0) != ((i & Kk) != 0);
+                }
+            };
+
+            static void apply(B* regs)
+            {
+                stages<2>(regs, std::true_type{});
+            }
+
+            template <std::size_t Kk>
+            static void stages(B* regs, std::true_type)
+            {
+                steps<Kk, Kk / 2>(regs, std::true_type{});
+                stages<2 * Kk>(regs, std::integral_constant<bool, (2 * Kk <= K * size)>{});
+            }
+
+            template <std::size_t Kk>
+            static void stages(B*, std::false_type)
+            {
+            }
+
+            template <std::size_t Kk, std::size_t J>
+            static void steps(B* regs, std::true_type)
+            {
+                step<Kk, J>(regs, std::integral_constant<bool, (J >= size)>{});
+                steps<Kk, J / 2>(regs, std::integral_constant<bool, (J / 2 > 0)>{});
+            }
+
+            template <std::size_t Kk, std::size_t J>
+            static void steps(B*, std::false_type)
+            {
+            }
+
+            // exchanges between batches
+            template <std::size_t Kk, std::size_t J>
+            static void step(B* regs, std::true_type)
+            {
+                for (std::size_t r = 0; r < K; ++r)
+                {
+                    std::size_t const p = r ^ (J / size);
+                    if (p > r)
+                    {
+                        B lo, hi;
+                        sort_exchange(regs[r], regs[p], lo, hi);
+                        bool const descending = ((r * size) & Kk) != 0;
+                        regs[r] = descending ? hi : lo;
+                        regs[p] = descending ? lo : hi;
+                    }
+                }
+            }
+
+            // exchanges within batches
+            template <std::size_t Kk, std::size_t J>
+            static void step(B* regs, std::false_type)
+            {
+                typename B::batch_bool_type const take_hi = xsimd::make_batch_bool_constant<B, upper<J, (Kk < size ? Kk : 0)>>();
+                for (std::size_t r = 0; r < K; ++r)
+                {
+                    B lo, hi;
+                    sort_exchange(regs[r], swizzle(regs[r], xsimd::make_batch_constant<index_batch, partner<J>>()), lo, hi);
+                    bool const descending = ((r * size) & Kk) != 0;
+                    regs[r] = descending ? select(take_hi, lo, hi) : select(take_hi, hi, lo);
+                }
+            }
+        };
+
+        template <class T>
+        constexpr T sort_padding()
+        {
+            return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : (std::numeric_limits<T>::max)();
+        }
+
+        // Sorts n <= K * batch size elements with a sorting network, the
+        // missing elements being padded with the largest value.
+        template <class Arch, std::size_t K, class T>
+        void sort_network(T* ptr, std::size_t n)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t size = K * batch_type::size;
+
+            alignas(Arch::alignment()) T buffer[size];
+            std::copy(ptr, ptr + n, buffer);
+            std::fill(buffer + n, buffer + size, sort_padding<T>());
+            batch_type regs[K];
+            for (std::size_t k = 0; k < K; ++k)
+            {
+                regs[k] = batch_type::load_aligned(buffer + k * batch_type::size);
+            }
+            bitonic_sort<batch_type, K>::apply(regs);
+            for (std::size_t k = 0; k < K; ++k)
+            {
+                regs[k].store_aligned(buffer + k * batch_type::size);
+            }
+            std::copy(buffer, buffer + n, ptr);
+        }
+
+        constexpr std::size_t sort_network_batches = 8;
+
+        template <class Arch, class T>
+        void sort_small(T* ptr, std::size_t n)
+        {
+            constexpr std::size_t size = batch<T, Arch>::size;
+            if (n <= size)
+            {
+                sort_network<Arch, 1>(ptr, n);
+            }
+            else if (n <= 2 * size)
+            {
+                sort_network<Arch, 2>(ptr, n);
+            }
+            else if (n <= 4 * size)
+            {
+                sort_network<Arch, 4>(ptr, n);
+            }
+            else
+            {
+                sort_network<Arch, sort_network_batches>(ptr, n);
+            }
+        }
+
+        template <class T>
+        struct iota_index
+        {
+            static constexpr T get(std::size_t i, std::size_t)
+            {
+                return static_cast<T>(i);
+            }
+        };
+
+        template <class T>
+        struct reverse_index
+        {
+            static constexpr T get(std::size_t i, std::size_t n)
+            {
+                return static_cast<T>(n - 1 - i);
+            }
+        };
+
+        // Writes the lanes of x selected by mask at left, and the other
+        // ones, in reverse order, right before right. Both ends need room
+        // for a whole batch.
+        template <class B>
+        void partition_store(B const& x, typename B::batch_bool_type const& mask, typename B::value_type*& left, typename B::value_type*& right)
+        {
+            using value_type = typename B::value_type;
+            using index_type = as_unsigned_integer_t<value_type>;
+            using index_batch = batch<index_type, typename B::arch_type>;
+            constexpr std::size_t size = B::size;
+
+            std::size_t const count = popcount(mask.mask());
+            compress(x, mask).store_unaligned(left);
+            swizzle(compress(x, !mask), xsimd::make_batch_constant<index_batch, reverse_index<index_type>>()).store_unaligned(right - size);
+            left += count;
+            right -= size - count;
+        }
+
+        /**
+         * Reorders the n >= 2 * B::size elements at ptr so that the ones
+         * satisfying pred come first, and returns their number. The first
+         * and last batches are set aside to make room, then each batch is
+         * read from the end with the least room left and its lanes are
+         * compressed to either end of the free space.
+         */
+        template <class B, class Predicate>
+        std::size_t partition_batches(typename B::value_type* ptr, std::size_t n, Predicate const& pred)
+        {
+            using value_type = typename B::value_type;
+            constexpr std::size_t size = B::size;
+
+            B const first = B::load_unaligned(ptr);
+            B const last = B::load_unaligned(ptr + n - size);
+            value_type* left = ptr;
+            value_type* right = ptr + n;
+            value_type* read_left = ptr + size;
+            value_type* read_right = ptr + n - size;
+
+            // the remaining elements then fill whole batches
+            for (std::size_t i = (n - 2 * size) % size; i > 0; --i)
+            {
+                value_type const v = *read_left++;
+                if (pred(v))
+                {
+                    *left++ = v;
+                }
+                else
+                {
+                    *--right = v;
+                }
+            }
+            while (read_left != read_right)
+            {
+                B x;
+                if (read_left - left <= right - read_right)
+                {
+                    x = B::load_unaligned(read_left);
+                    read_left += size;
+                }
+                else
+                {
+                    read_right -= size;
+                    x = B::load_unaligned(read_right);
+                }
+                partition_store(x, pred(x), left, right);
+            }
+            partition_store(first, pred(first), left, right);
+
+            // exactly one batch of room is left
+            using index_type = as_unsigned_integer_t<value_type>;
+            using index_batch = batch<index_type, typename B::arch_type>;
+            auto const mask = pred(last);
+            std::size_t const count = popcount(mask.mask());
+            index_batch const lanes = xsimd::make_batch_constant<index_batch, iota_index<index_type>>();
+            index_batch const lo = bitwise_cast<index_batch>(compress(last, mask));
+            index_batch const hi = bitwise_cast<index_batch>(swizzle(compress(last, !mask), xsimd::make_batch_constant<index_batch, reverse_index<index_type>>()));
+            bitwise_cast<B>(select(lanes < index_batch(static_cast<index_type>(count)), lo, hi)).store_unaligned(left);
+            return static_cast<std::size_t>(left - ptr) + count;
+        }
+
+        template <class T>
+        T median_of_three(T a, T b, T c)
+        {
+            if (b < a)
+            {
+                std::swap(a, b);
+            }
+            if (c < b)
+            {
+                b = a < c ? c : a;
+            }
+            return b;
+        }
+
+        /**
+         * Introsort: partitions around a median of three until the ranges
+         * fit a sorting network, recursing on the smallest side. Falls back
+         * to std::sort past depth partitions.
+         */
+        template <class Arch, class T>
+        void sort_partitions(T* ptr, std::size_t n, std::size_t depth)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t small = sort_network_batches * batch_type::size;
+
+            while (n > small)
+            {
+                if (depth == 0)
+                {
+                    std::sort(ptr, ptr + n);
+                    return;
+                }
+                --depth;
+                T const pivot = median_of_three(ptr[n / 4], ptr[n / 2], ptr[n - n / 4 - 1]);
+                std::size_t mid = partition_batches<batch_type>(ptr, n, less_than<T> { pivot });
+                if (mid == 0)
+                {
+                    // the pivot is the smallest element: set aside the
+                    // elements equal to it, already in place
+                    mid = partition_batches<batch_type>(ptr, n, less_equal<T> { pivot });
+                    ptr += mid;
+                    n -= mid;
+                }
+                else if (mid < n - mid)
+                {
+                    sort_partitions<Arch>(ptr, mid, depth);
+                    ptr += mid;
+                    n -= mid;
+                }
+                else
+                {
+                    sort_partitions<Arch>(ptr + mid, n - mid, depth);
+                    n = mid;
+                }
+            }
+            sort_small<Arch>(ptr, n);
+        }
+
+        template <class Arch, class T>
+        void sort(T* ptr, std::size_t n, std::true_type)
+        {
+            using batch_type = batch<T, Arch>;
+            if (std::is_floating_point<T>::value)
+            {
+                // NaN are not ordered: move them to the end
+                n = n >= 2 * batch_type::size
+                    ? partition_batches<batch_type>(ptr, n, not_nan {})
+                    : static_cast<std::size_t>(std::partition(ptr, ptr + n, not_nan {}) - ptr);
+            }
+            std::size_t depth = 0;
+            for (std::size_t i = n; i > 1; i >>= 1)
+            {
+                depth += 2;
+            }
+            sort_partitions<Arch>(ptr, n, depth);
+        }
+
+        template <class Arch, class T>
+        void sort(T* ptr, std::size_t n, std::false_type)
+        {
+            std::sort(ptr, ptr + n);
+        }
+
+        // The networks and the partitions need a swizzle and a compress
+        // working on 32 and 64 bit lanes.
+        template <class Arch, class T>
+        struct sort_batches
+            : std::integral_constant<bool, std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8) && (batch<T, Arch>::size > 1)>
+        {
+        };
+    }
+
+    /**
+     * Sorts [\c first, \c last) in ascending order, for contiguous ranges
+     * of arithmetic values. Ranges are partitioned with compress until
+     * they fit a few batches, which are then sorted in registers by a
+     * bitonic network. NaN values end up, in any order, after all the
+     * other ones. Elements of 8 or 16 bits are sorted by std::sort.
+     */
+    template <class Arch=default_arch, class Iterator>
+    void sort(Iterator first, Iterator last)
+    {
+        static_assert(detail::all_contiguous<Iterator>::value, "sort requires a contiguous range");
+        using value_type = typename std::decay<decltype(*first)>::type;
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size < 2)
+        {
+            return;
+        }
+        detail::sort<Arch>(&(*first), size, detail::sort_batches<Arch, value_type>{});
+    }
+
+    namespace detail
+    {
+        template <std::size_t N>
+        struct equal_to_any
+        {
+            std::array<uint8_t, N> values;
+
+            template <class X>
+            auto operator()(X const& x) const -> decltype(x == x)
+            {
+                auto res = x == X(values[0]);
+                for (std::size_t i = 1; i < N; ++i)
+                {
+                    res = res | (x == X(values[i]));
+                }
+                return res;
+            }
+        };
+
+        template <class Iterator>
+        uint8_t const* byte_pointer(Iterator it)
+        {
+            using value_type = typename std::decay<decltype(*it)>::type;
+            static_assert(std::is_integral<value_type>::value && sizeof(value_type) == 1, "byte search requires a range of bytes");
+            static_assert(is_contiguous_iterator<Iterator>::value, "byte search requires a contiguous range");
+            return reinterpret_cast<uint8_t const*>(&(*it));
+        }
+
+        /**
+         * Returns the index of the first byte of [ptr, ptr + size) for
+         * which match holds, or size. Every load is an aligned batch: the
+         * bytes read out of the range share their batch, thus their memory
+         * page, with bytes of the range, and are masked out of the result.
+         */
+        template <class Arch, class Match>
+        std::size_t find_byte_index(uint8_t const* ptr, std::size_t size, Match const& match)
+        {
+            using batch_type = batch<uint8_t, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+            if (size == 0)
+            {
+                return 0;
+            }
+
+            // indices are relative to the aligned batch holding ptr
+            std::size_t const offset = reinterpret_cast<std::uintptr_t>(ptr) % Arch::alignment();
+            uint8_t const* block = ptr - offset;
+            std::size_t const end = offset + size;
+
+            uint64_t bits = match(batch_type::load_aligned(block)).mask() & (~uint64_t(0) << offset);
+            std::size_t i = 0;
+            while (true)
+            {
+                if (end - i < simd_size)
+                {
+                    bits &= (uint64_t(1) << (end - i)) - 1;
+                }
+                if (bits != 0)
+                {
+                    return i + countr_zero(bits) - offset;
+                }
+                i += simd_size;
+                for (; i + 4 * simd_size <= end; i += 4 * simd_size)
+                {
+                    auto c0 = match(batch_type::load_aligned(block + i));
+                    auto c1 = match(batch_type::load_aligned(block + i + simd_size));
+                    auto c2 = match(batch_type::load_aligned(block + i + 2 * simd_size));
+                    auto c3 = match(batch_type::load_aligned(block + i + 3 * simd_size));
+                    if (xsimd::any((c0 | c1) | (c2 | c3)))
+                    {
+                        if (xsimd::any(c0))
+                        {
+                            return i - offset + countr_zero(c0.mask());
+                        }
+                        if (xsimd::any(c1))
+                        {
+                            return i - offset + simd_size + countr_zero(c1.mask());
+                        }
+                        if (xsimd::any(c2))
+                        {
+                            return i - offset + 2 * simd_size + countr_zero(c2.mask());
+                        }
+                        return i - offset + 3 * simd_size + countr_zero(c3.mask());
+                    }
+                }
+                if (i >= end)
+                {
+                    return size;
+                }
+                bits = match(batch_type::load_aligned(block + i)).mask();
+            }
+        }
+
+        /**
+         * Substring search of the "generic SIMD" kind: the candidate
+         * positions are those where both the first and the last bytes of
+         * the needle match, tested a batch of positions at a time, and only
+         * those are compared to the whole needle.
+         */
+        template <class Arch>
+        std::size_t search_index(uint8_t const* ptr, std::size_t size, uint8_t const* needle, std::size_t needle_size)
+        {
+            using batch_type = batch<uint8_t, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            if (needle_size == 0)
+            {
+                return 0;
+            }
+            if (needle_size > size)
+            {
+                return size;
+            }
+            if (needle_size == 1)
+            {
+                return find_byte_index<Arch>(ptr, size, equal_to<uint8_t> { needle[0] });
+            }
+
+            batch_type const first(needle[0]);
+            batch_type const last(needle[needle_size - 1]);
+            std::size_t i = 0;
+            for (; i + needle_size - 1 + simd_size <= size; i += simd_size)
+            {
+                auto const candidates = (batch_type::load_unaligned(ptr + i) == first)
+                    & (batch_type::load_unaligned(ptr + i + needle_size - 1) == last);
+                for (uint64_t bits = candidates.mask(); bits != 0; bits &= bits - 1)
+                {
+                    std::size_t const pos = i + countr_zero(bits);
+                    if (std::equal(needle + 1, needle + needle_size - 1, ptr + pos + 1))
+                    {
+                        return pos;
+                    }
+                }
+            }
+            for (; i + needle_size <= size; ++i)
+            {
+                if (ptr[i] == needle[0] && std::equal(needle + 1, needle + needle_size, ptr + i + 1))
+                {
+                    return i;
+                }
+            }
+            return size;
+        }
+    }
+
+    /**
+     * Returns an iterator to the first byte of [\c first, \c last) equal
+     * to \c value, or \c last, like memchr. The range is read by aligned
+     * batches, which may extend past its ends but never to another
+     * memory page.
+     */
+    template <class Arch=default_arch, class Iterator>
+    Iterator find_byte(Iterator first, Iterator last, uint8_t value)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return last;
+        }
+        return first + detail::find_byte_index<Arch>(detail::byte_pointer(first), size, detail::equal_to<uint8_t> { value });
+    }
+
+    /**
+     * Returns an iterator to the first byte of [\c first, \c last) equal
+     * to any of \c bytes, or \c last.
+     */
+    template <class Arch=default_arch, class Iterator, class... Bytes>
+    Iterator find_any_of(Iterator first, Iterator last, Bytes... bytes)
+    {
+        static_assert(sizeof...(Bytes) > 0, "at least one byte to search for");
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return last;
+        }
+        detail::equal_to_any<sizeof...(Bytes)> match { { { static_cast<uint8_t>(bytes)... } } };
+        return first + detail::find_byte_index<Arch>(detail::byte_pointer(first), size, match);
+    }
+
+    /**
+     * Returns the length of the null-terminated string \c str. As for
+     * find_byte, the reads past the terminator stay within its memory page.
+     */
+    template <class Arch=default_arch>
+    std::size_t strlen(char const* str)
+    {
+        using batch_type = batch<uint8_t, Arch>;
+        constexpr std::size_t simd_size = batch_type::size;
+        batch_type const zero(uint8_t(0));
+
+        uint8_t const* ptr = reinterpret_cast<uint8_t const*>(str);
+        std::size_t const offset = reinterpret_cast<std::uintptr_t>(ptr) % Arch::alignment();
+        uint64_t bits = (batch_type::load_aligned(ptr - offset) == zero).mask() >> offset;
+        if (bits != 0)
+        {
+            return detail::countr_zero(bits);
+        }
+        for (std::size_t i = simd_size - offset;; i += simd_size)
+        {
+            bits = (batch_type::load_aligned(ptr + i) == zero).mask();
+            if (bits != 0)
+            {
+                return i + detail::countr_zero(bits);
+            }
+        }
+    }
+
+    /**
+     * Returns an iterator to the first occurrence of the bytes of
+     * [\c s_first, \c s_last) in [\c first, \c last), or \c last, like
+     * std::search.
+     */
+    template <class Arch=default_arch, class Iterator1, class Iterator2>
+    Iterator1 search(Iterator1 first, Iterator1 last, Iterator2 s_first, Iterator2 s_last)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t needle_size = static_cast<std::size_t>(std::distance(s_first, s_last));
+        if (needle_size == 0)
+        {
+            return first;
+        }
+        if (needle_size > size)
+        {
+            return last;
+        }
+        return first + detail::search_index<Arch>(detail::byte_pointer(first), size, detail::byte_pointer(s_first), needle_size);
+    }
+
+    namespace detail
+    {
+        // Number of tables the counts are spread over, so that consecutive
+        // increments of the same bin do not wait for each other. Blocks
+        // whose bins seldom repeat are counted in the first table only,
+        // which keeps large tables in cache.
+        constexpr std::size_t histogram_tables = 4;
+
+        // Number of values binned at once, before being counted.
+        constexpr std::size_t histogram_block = 1024;
+
+        // Number of bins at the start of a block checked for repeats.
+        constexpr std::size_t histogram_sample = 256;
+
+        /**
+         * Bins of bincount: keys in [0, last] are their own bin, the other
+         * ones go to the extra bin \c overflow. Negative keys compare
+         * greater than \c last once reinterpreted as unsigned.
+         */
+        template <class T>
+        struct key_bins
+        {
+            using index_type = as_unsigned_integer_t<T>;
+
+            index_type last;
+            index_type overflow;
+
+            index_type operator()(T key) const
+            {
+                return static_cast<index_type>(key) <= last ? static_cast<index_type>(key) : overflow;
+            }
+
+            template <class A>
+            batch<index_type, A> operator()(batch<T, A> const& key) const
+            {
+                using index_batch = batch<index_type, A>;
+                index_batch const index = bitwise_cast<index_batch>(key);
+                return select(index <= index_batch(last), index, index_batch(overflow));
+            }
+        };
+
+        /**
+         * Bins of histogram: values in [lo, hi] fall in one of the equal
+         * width bins up to \c last, the other ones and NaNs go to the extra
+         * bin \c overflow.
+         */
+        template <class T>
+        struct value_bins
+        {
+            using index_type = as_unsigned_integer_t<T>;
+
+            T lo;
+            T hi;
+            T scale;
+            T last;
+            index_type overflow;
+
+            index_type operator()(T x) const
+            {
+                return x >= lo && x <= hi ? static_cast<index_type>(std::min((x - lo) * scale, last)) : overflow;
+            }
+
+            template <class A>
+            batch<index_type, A> operator()(batch<T, A> const& x) const
+            {
+                using batch_type = batch<T, A>;
+                batch_type const bin = select((x >= batch_type(lo)) & (x <= batch_type(hi)),
+                                              xsimd::min((x - lo) * scale, batch_type(last)),
+                                              batch_type(static_cast<T>(overflow)));
+                return bitwise_cast<batch<index_type, A>>(to_int(bin));
+            }
+        };
+
+        // Whether more than one in 16 of the bins of \c index is repeated
+        // one or two places further, \c index being aligned.
+        template <class Arch, class Index>
+        bool frequent_repeats(Index const* index, std::size_t size)
+        {
+            using index_batch = batch<Index, Arch>;
+            constexpr std::size_t simd_size = index_batch::size;
+            // at most histogram_block / simd_size per lane, which fits Index
+            index_batch repeats(Index(0));
+            std::size_t j = 0;
+            for (; j + simd_size + 2 <= size; j += simd_size)
+            {
+                index_batch const bin = index_batch::load_aligned(index + j);
+                auto const repeated = (bin == index_batch::load_unaligned(index + j + 1)) | (bin == index_batch::load_unaligned(index + j + 2));
+                repeats += select(repeated, index_batch(Index(1)), index_batch(Index(0)));
+            }
+            alignas(Arch::alignment()) Index lanes[simd_size];
+            repeats.store_aligned(lanes);
+            std::size_t count = 0;
+            for (std::size_t k = 0; k < simd_size; ++k)
+            {
+                count += lanes[k];
+            }
+            return count * 16 > j;
+        }
+
+        // Increments the bins of \c index in the table \c counts.
+        template <class Index>
+        void count_bins(Index const* index, std::size_t size, uint32_t* counts)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ++counts[index[i]];
+            }
+        }
+
+        // Increments the bins of \c index, spread over the tables of
+        // \c stride counts starting at \c counts.
+        template <class Index>
+        void count_bins(Index const* index, std::size_t size, uint32_t* counts, std::size_t stride)
+        {
+            static_assert(histogram_tables == 4, "one increment per table");
+            uint32_t* const counts_1 = counts + stride;
+            uint32_t* const counts_2 = counts + 2 * stride;
+            uint32_t* const counts_3 = counts + 3 * stride;
+            std::size_t i = 0;
+            for (; i + histogram_tables <= size; i += histogram_tables)
+            {
+                // the bins are read before any increment, which could alias them
+                Index const bin_0 = index[i];
+                Index const bin_1 = index[i + 1];
+                Index const bin_2 = index[i + 2];
+                Index const bin_3 = index[i + 3];
+                ++counts[bin_0];
+                ++counts_1[bin_1];
+                ++counts_2[bin_2];
+                ++counts_3[bin_3];
+            }
+            for (; i < size; ++i)
+            {
+                ++counts[index[i]];
+            }
+        }
+
+        /**
+         * Adds to the \c num_bins elements starting at \c out the number of
+         * values of [\c ptr, \c ptr + \c size) in each bin, as computed by
+         * \c bins. The values are binned by blocks, in batches, then counted
+         * in 32 bit tables flushed to the output every 2^31 values: spread
+         * over histogram_tables tables when the bins of the block often
+         * repeat, in a single one otherwise.
+         */
+        template <class Arch, class T, class Bins, class OutputIterator>
+        void histogram(T const* ptr, std::size_t size, Bins const& bins, std::size_t num_bins, OutputIterator out)
+        {
+            using index_type = typename Bins::index_type;
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+            constexpr std::size_t segment_size = std::size_t(1) << 31;
+
+            // one extra bin for the values out of range, the other tables
+            // being only allocated once a block needs them
+            std::size_t const stride = num_bins + 1;
+            std::vector<uint32_t> counts(stride);
+            alignas(Arch::alignment()) index_type index[histogram_block];
+
+            for (std::size_t segment = 0; segment < size; segment += segment_size)
+            {
+                std::size_t const segment_end = std::min(size, segment + segment_size);
+                std::fill(counts.begin(), counts.end(), uint32_t(0));
+                for (std::size_t block = segment; block < segment_end; block += histogram_block)
+                {
+                    std::size_t const block_size = std::min(histogram_block, segment_end - block);
+                    std::size_t j = 0;
+                    for (; j + simd_size <= block_size; j += simd_size)
+                    {
+                        bins(batch_type::load_unaligned(ptr + block + j)).store_aligned(index + j);
+                    }
+                    for (; j < block_size; ++j)
+                    {
+                        index[j] = bins(ptr[block + j]);
+                    }
+                    if (frequent_repeats<Arch>(index, std::min(histogram_sample, block_size)))
+                    {
+                        counts.resize(histogram_tables * stride);
+                        count_bins(index, block_size, counts.data(), stride);
+                    }
+                    else
+                    {
+                        count_bins(index, block_size, counts.data());
+                    }
+                }
+
+                bool const spread = counts.size() > stride;
+                OutputIterator it = out;
+                for (std::size_t b = 0; b < num_bins; ++b, ++it)
+                {
+                    std::size_t count = counts[b];
+                    for (std::size_t k = 1; k < histogram_tables && spread; ++k)
+                    {
+                        count += counts[k * stride + b];
+                    }
+                    *it += static_cast<typename std::iterator_traits<OutputIterator>::value_type>(count);
+                }
+            }
+        }
+    }
+
+    /**
+     * Adds to the k-th element of [\c counts_first, \c counts_last) the
+     * number of elements of [\c first, \c last) equal to k, like numpy's
+     * bincount. Negative keys and keys past the last bin are ignored.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator>
+    void bincount(Iterator first, Iterator last, OutputIterator counts_first, OutputIterator counts_last)
+    {
+        static_assert(detail::all_contiguous<Iterator>::value, "bincount requires a contiguous range of keys");
+        using value_type = typename std::decay<decltype(*first)>::type;
+        using index_type = as_unsigned_integer_t<value_type>;
+        static_assert(std::is_integral<value_type>::value, "bincount counts integer keys");
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t num_bins = static_cast<std::size_t>(std::distance(counts_first, counts_last));
+        if (size == 0 || num_bins == 0)
+        {
+            return;
+        }
+        // the bins past the largest key are never reached
+        std::size_t const max_key = static_cast<std::size_t>(std::numeric_limits<value_type>::max());
+        num_bins = num_bins - 1 < max_key ? num_bins : max_key + 1;
+        detail::key_bins<value_type> bins { static_cast<index_type>(num_bins - 1), static_cast<index_type>(num_bins) };
+        detail::histogram<Arch>(&(*first), size, bins, num_bins, counts_first);
+    }
+
+    /**
+     * Adds to the elements of [\c counts_first, \c counts_last) the number
+     * of elements of [\c first, \c last) in each of the bins of equal width
+     * splitting [\c lo, \c hi], like numpy's histogram: the last bin
+     * includes \c hi, the values out of [\c lo, \c hi] and NaNs are ignored.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator, class T>
+    void histogram(Iterator first, Iterator last, OutputIterator counts_first, OutputIterator counts_last, T lo, T hi)
+    {
+        static_assert(detail::all_contiguous<Iterator>::value, "histogram requires a contiguous range of values");
+        using value_type = typename std::decay<decltype(*first)>::type;
+        using index_type = as_unsigned_integer_t<value_type>;
+        static_assert(std::is_floating_point<value_type>::value, "histogram of floating point values");
+        assert(lo < hi && "non-empty range of values");
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t num_bins = static_cast<std::size_t>(std::distance(counts_first, counts_last));
+        if (size == 0 || num_bins == 0)
+        {
+            return;
+        }
+        value_type const low = static_cast<value_type>(lo);
+        value_type const high = static_cast<value_type>(hi);
+        detail::value_bins<value_type> bins { low, high, static_cast<value_type>(num_bins) / (high - low),
+                                              static_cast<value_type>(num_bins - 1), static_cast<index_type>(num_bins) };
+        detail::histogram<Arch>(&(*first), size, bins, num_bins, counts_first);
+    }
+
+    /**
+     * Handling by convert of the values out of the range of the output
+     * type.
+     */
+    enum class conversion_policy
+    {
+        // static_cast semantics: integers keep their low bits, floating
+        // point values out of the range of an integer type are undefined
+        cast,
+        // values are clamped to the range of the output type, NaNs are
+        // converted to zero
+        saturate
+    };
+
+    namespace detail
+    {
+        template <class T, class A, std::size_t N>
+        using batch_block = std::array<batch<T, A>, N>;
+
+        /*
+         * A block of batches is converted step by step, each step changing
+         * either the width or the kind of the lanes, until the output type
+         * is reached:
+         * - integers are widened or narrowed one size at a time and
+         *   reinterpreted once they have the output width,
+         * - integers narrower than 32 bits heading to floating point are
+         *   widened to signed 32 bits integers, which hold them exactly,
+         * - 32 bits integers go to float with a cast, to double through
+         *   the exponent bits of 2^52,
+         * - float goes to integers through int32 (or double for 64 bits
+         *   integers), double through the mantissa of 1.5 * 2^52 for
+         *   integers up to 32 bits.
+         */
+        struct convert_done {};
+        struct convert_reinterpret {};
+        struct convert_widen {};
+        struct convert_widen_exact {};
+        struct convert_narrow {};
+        struct convert_cast {};
+        struct convert_uint32_float {};
+        struct convert_float_uint32 {};
+        struct convert_int32_double {};
+        struct convert_double_int64 {};
+
+        template <class T, class Out>
+        struct convert_step
+        {
+            static constexpr bool integral_in = std::is_integral<T>::value;
+            static constexpr bool integral_out = std::is_integral<Out>::value;
+            static constexpr bool wider = sizeof(T) < sizeof(Out);
+
+            using integer_step = typename std::conditional<sizeof(T) == sizeof(Out), convert_reinterpret,
+                                 typename std::conditional<wider, convert_widen, convert_narrow>::type>::type;
+            using floating_step = typename std::conditional<wider, convert_widen, convert_narrow>::type;
+            using to_floating_step = typename std::conditional<(sizeof(T) < 4), convert_widen_exact,
+                                     typename std::conditional<sizeof(T) == 8 || (std::is_same<T, int32_t>::value && sizeof(Out) == 4), convert_cast,
+                                     typename std::conditional<sizeof(Out) == 4, convert_uint32_float, convert_int32_double>::type>::type>::type;
+            using from_float_step = typename std::conditional<sizeof(Out) == 8, convert_widen,
+                                    typename std::conditional<std::is_same<Out, uint32_t>::value, convert_float_uint32, convert_cast>::type>::type;
+            using from_double_step = typename std::conditional<sizeof(Out) == 8, convert_cast, convert_double_int64>::type;
+            using to_integral_step = typename std::conditional<sizeof(T) == 4, from_float_step, from_double_step>::type;
+
+            using type = typename std::conditional<std::is_same<T, Out>::value, convert_done,
+                         typename std::conditional<integral_in && integral_out, integer_step,
+                         typename std::conditional<!integral_in && !integral_out, floating_step,
+                         typename std::conditional<integral_in, to_floating_step, to_integral_step>::type>::type>::type>::type;
+        };
+
+        // type reached by convert_cast
+        template <class T, class Out>
+        using convert_cast_type = typename std::conditional<std::is_integral<T>::value,
+                                  typename std::conditional<sizeof(T) == 4, float, double>::type,
+                                  typename std::conditional<sizeof(T) == 4, int32_t, Out>::type>::type;
+
+        /*
+         * The converted block is handed to a sink, which either stores it
+         * or keeps it in registers for further processing.
+         */
+        template <class Out, class T, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<T, A, N> const& x, Sink& sink)
+        {
+            convert_block<Out>(x, sink, typename convert_step<T, Out>::type{});
+        }
+
+        template <class Out, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<Out, A, N> const& x, Sink& sink, convert_done)
+        {
+            sink(x);
+        }
+
+        template <class Out, class T, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<T, A, N> const& x, Sink& sink, convert_reinterpret)
+        {
+            batch_block<Out, A, N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                res[i] = bitwise_cast<batch<Out, A>>(x[i]);
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        template <class Out, class T, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<T, A, N> const& x, Sink& sink, convert_widen)
+        {
+            batch_block<widen_type_t<T>, A, 2 * N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                auto const halves = widen(x[i]);
+                res[2 * i] = halves[0];
+                res[2 * i + 1] = halves[1];
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        template <class Out, class T, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<T, A, N> const& x, Sink& sink, convert_widen_exact)
+        {
+            using wide_type = typename std::make_signed<widen_type_t<T>>::type;
+            batch_block<wide_type, A, 2 * N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                auto const halves = widen(x[i]);
+                res[2 * i] = bitwise_cast<batch<wide_type, A>>(halves[0]);
+                res[2 * i + 1] = bitwise_cast<batch<wide_type, A>>(halves[1]);
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        template <class Out, class T, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<T, A, N> const& x, Sink& sink, convert_narrow)
+        {
+            batch_block<narrow_type_t<T>, A, N / 2> res;
+            for (std::size_t i = 0; i < N / 2; ++i)
+            {
+                res[i] = narrow(x[2 * i], x[2 * i + 1]);
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        template <class Out, class T, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<T, A, N> const& x, Sink& sink, convert_cast)
+        {
+            using cast_type = convert_cast_type<T, Out>;
+            batch_block<cast_type, A, N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                res[i] = batch_cast<cast_type>(x[i]);
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        // both 16 bits halves convert exactly, their sum is rounded once
+        template <class Out, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<uint32_t, A, N> const& x, Sink& sink, convert_uint32_float)
+        {
+            using int_batch = batch<int32_t, A>;
+            batch_block<float, A, N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                batch<float, A> const high = batch_cast<float>(bitwise_cast<int_batch>(x[i] >> 16));
+                batch<float, A> const low = batch_cast<float>(bitwise_cast<int_batch>(x[i] & uint32_t(0xFFFF)));
+                res[i] = fma(high, batch<float, A>(65536.f), low);
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        // values from 2^31 are shifted into the range of int32
+        template <class Out, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<float, A, N> const& x, Sink& sink, convert_float_uint32)
+        {
+            using uint_batch = batch<uint32_t, A>;
+            batch<float, A> const two31(2147483648.f);
+            batch_block<uint32_t, A, N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                auto const large = x[i] >= two31;
+                uint_batch const value = bitwise_cast<uint_batch>(batch_cast<int32_t>(select(large, x[i] - two31, x[i])));
+                res[i] = value | bitwise_cast<uint_batch>(select(large, batch<float, A>(-0.f), batch<float, A>(0.f)));
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        // the zero-extended integer fills the mantissa of 2^52 + x
+        template <class Out, class T, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<T, A, N> const& x, Sink& sink, convert_int32_double)
+        {
+            using uint_batch = batch<uint32_t, A>;
+            using double_batch = batch<double, A>;
+            // signed values are biased by 2^31
+            uint32_t const bias = std::is_signed<T>::value ? 0x80000000u : 0u;
+            double_batch const offset(std::is_signed<T>::value ? 4503601774854144. : 4503599627370496.);
+            batch<uint64_t, A> const exponent(0x4330000000000000ull);
+            batch_block<double, A, 2 * N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                auto const halves = widen(bitwise_cast<uint_batch>(x[i]) ^ bias);
+                res[2 * i] = bitwise_cast<double_batch>(halves[0] | exponent) - offset;
+                res[2 * i + 1] = bitwise_cast<double_batch>(halves[1] | exponent) - offset;
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        // adding 1.5 * 2^52 moves the integer to the low bits of the mantissa
+        template <class Out, class A, std::size_t N, class Sink>
+        void convert_block(batch_block<double, A, N> const& x, Sink& sink, convert_double_int64)
+        {
+            using int_batch = batch<int64_t, A>;
+            batch<double, A> const magic(6755399441055744.);
+            int_batch const magic_bits = bitwise_cast<int_batch>(magic);
+            batch_block<int64_t, A, N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                res[i] = bitwise_cast<int_batch>(trunc(x[i]) + magic) - magic_bits;
+            }
+            convert_block<Out>(res, sink);
+        }
+
+        template <class T>
+        struct store_sink
+        {
+            T* out;
+
+            template <class A, std::size_t N>
+            void operator()(batch_block<T, A, N> const& x)
+            {
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    x[i].store_unaligned(out + i * batch<T, A>::size);
+                }
+            }
+        };
+
+        template <class T, class A, std::size_t N>
+        struct collect_sink
+        {
+            batch_block<T, A, N>& res;
+
+            void operator()(batch_block<T, A, N> const& x)
+            {
+                res = x;
+            }
+        };
+
+        /*
+         * Clamping of the In values to the range of Out, applied before the
+         * conversion. When the maximum of Out is not representable in In,
+         * the values are clamped one ulp below its rounded value and the
+         * lanes above are reported as overflowing, to be set to the maximum
+         * once converted.
+         */
+        template <class In, class Out, bool Saturate = std::is_integral<Out>::value>
+        struct saturation
+        {
+            static constexpr bool rounded_high = false;
+
+            static Out cast(In x) noexcept
+            {
+                return static_cast<Out>(x);
+            }
+
+            template <class A>
+            static batch<In, A> apply(batch<In, A> const& x) noexcept
+            {
+                return x;
+            }
+
+            template <class A>
+            static batch_bool<In, A> overflow(batch<In, A> const&) noexcept
+            {
+                return batch_bool<In, A>(false);
+            }
+        };
+
+        template <class In, class Out>
+        struct saturation<In, Out, true>
+        {
+            static constexpr bool clamp_low = std::is_signed<In>::value && (std::is_unsigned<Out>::value || sizeof(Out) < sizeof(In) || std::is_floating_point<In>::value);
+            static constexpr bool clamp_high = sizeof(Out) < sizeof(In) || std::is_floating_point<In>::value
+                                               || (sizeof(Out) == sizeof(In) && std::is_signed<Out>::value && std::is_unsigned<In>::value);
+            static constexpr bool rounded_high = std::is_floating_point<In>::value && std::numeric_limits<Out>::digits > std::numeric_limits<In>::digits;
+
+            static In low() noexcept
+            {
+                return static_cast<In>(std::numeric_limits<Out>::min());
+            }
+
+            static In high() noexcept
+            {
+                In const res = static_cast<In>(std::numeric_limits<Out>::max());
+                return rounded_high ? static_cast<In>(std::nextafter(res, In(0))) : res;
+            }
+
+            static Out cast(In x) noexcept
+            {
+                if (x != x)
+                {
+                    return Out(0);
+                }
+                if (rounded_high && x > high())
+                {
+                    return std::numeric_limits<Out>::max();
+                }
+                x = clamp_low ? std::max(x, low()) : x;
+                return static_cast<Out>(clamp_high ? std::min(x, high()) : x);
+            }
+
+            template <class A>
+            static batch<In, A> apply(batch<In, A> x) noexcept
+            {
+                if (std::is_floating_point<In>::value)
+                {
+                    x = select(x == x, x, batch<In, A>(In(0)));
+                }
+                x = clamp_low ? max(x, batch<In, A>(low())) : x;
+                return clamp_high ? min(x, batch<In, A>(high())) : x;
+            }
+
+            template <class A>
+            static batch_bool<In, A> overflow(batch<In, A> const& x) noexcept
+            {
+                return x > batch<In, A>(high());
+            }
+        };
+
+        /**
+         * Converts [\c in, \c in + \c size) to \c out, a block of batches at
+         * a time. A block holds a whole batch of the narrowest of both
+         * types.
+         */
+        template <class Arch, class Saturation, class In, class Out>
+        void convert(In const* in, std::size_t size, Out* out)
+        {
+            using batch_type = batch<In, Arch>;
+            constexpr std::size_t block_batches = sizeof(In) > sizeof(Out) ? sizeof(In) / sizeof(Out) : 1;
+            constexpr std::size_t block_size = block_batches * batch_type::size;
+
+            std::size_t align_begin = xsimd::get_alignment_offset(in, size, batch_type::size);
+            std::size_t align_end = align_begin + (size - align_begin) / block_size * block_size;
+
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                out[i] = Saturation::cast(in[i]);
+            }
+            for (std::size_t i = align_begin; i < align_end; i += block_size)
+            {
+                batch_block<In, Arch, block_batches> x;
+                batch_bool<In, Arch> overflow(false);
+                for (std::size_t k = 0; k < block_batches; ++k)
+                {
+                    batch_type const value = batch_type::load_aligned(in + i + k * batch_type::size);
+                    x[k] = Saturation::apply(value);
+                    if (Saturation::rounded_high)
+                    {
+                        overflow = overflow || Saturation::overflow(value);
+                    }
+                }
+                store_sink<Out> sink { out + i };
+                convert_block<Out>(x, sink);
+                if (Saturation::rounded_high && any(overflow))
+                {
+                    for (std::size_t j = i; j < i + block_size; ++j)
+                    {
+                        out[j] = Saturation::cast(in[j]);
+                    }
+                }
+            }
+            for (std::size_t i = align_end; i < size; ++i)
+            {
+                out[i] = Saturation::cast(in[i]);
+            }
+        }
+    }
+
+    /**
+     * Converts the elements of [\c first, \c last) to the value type of
+     * \c d_first, storing them in the range starting at \c d_first, and
+     * returns the end of that range. Any pair of fixed width integer and
+     * floating point types is supported. Lanes are widened and narrowed
+     * with pack and unpack instructions, so that whole batches are read
+     * and written. The \c policy tells how values out of the range of the
+     * output type are handled.
+     */
+    template <class Arch=default_arch, class Iterator, class OutputIterator>
+    OutputIterator convert(Iterator first, Iterator last, OutputIterator d_first, conversion_policy policy = conversion_policy::cast)
+    {
+        static_assert(detail::all_contiguous<Iterator, OutputIterator>::value, "convert requires contiguous ranges");
+        using in_type = typename std::decay<decltype(*first)>::type;
+        using out_type = typename std::decay<decltype(*d_first)>::type;
+
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        if (policy == conversion_policy::saturate)
+        {
+            detail::convert<Arch, detail::saturation<in_type, out_type>>(&(*first), size, &(*d_first));
+        }
+        else
+        {
+            detail::convert<Arch, detail::saturation<in_type, out_type, false>>(&(*first), size, &(*d_first));
+        }
+        return d_first + size;
+    }
+
+    namespace detail
+    {
+        /*
+         * Type of the batches a mixed transform hands to its functor: the
+         * widest of the input and output types, so that every lane of the
+         * input is converted once and no precision is lost before the
+         * functor runs.
+         */
+        template <class In, class Out>
+        using transform_compute_type = typename std::conditional<(sizeof(In) >= sizeof(Out)), In, Out>::type;
+
+        template <class C, class T, class A, std::size_t N>
+        batch_block<C, A, N * sizeof(C) / sizeof(T)> convert_registers(batch_block<T, A, N> const& x)
+        {
+            batch_block<C, A, N * sizeof(C) / sizeof(T)> res;
+            collect_sink<C, A, N * sizeof(C) / sizeof(T)> sink { res };
+            convert_block<C>(x, sink);
+            return res;
+        }
+
+        template <class Out, class C, class A, std::size_t N, class F, class... Args>
+        void transform_block(Out* out, F& f, batch_block<C, A, N> const& x, Args const&... args)
+        {
+            using result_type = typename std::decay<decltype(f(x[0], args[0]...))>::type;
+            using value_type = typename result_type::value_type;
+            static_assert(batch<value_type, A>::size == batch<C, A>::size, "the functor keeps the number of lanes");
+
+            batch_block<value_type, A, N> res;
+            for (std::size_t k = 0; k < N; ++k)
+            {
+                res[k] = f(x[k], args[k]...);
+            }
+            store_sink<Out> sink { out };
+            convert_block<Out>(res, sink);
+        }
+
+        /**
+         * Applies \c f to [\c in, \c in + \c size) converted to the
+         * computation type, and converts its results to \c out. A block
+         * holds a whole batch of the narrowest of both types.
+         */
+        template <class Arch, class In, class Out, class F>
+        void transform_mixed(In const* in, std::size_t size, Out* out, F& f)
+        {
+            using compute_type = transform_compute_type<In, Out>;
+            using batch_type = batch<In, Arch>;
+            constexpr std::size_t block_batches = sizeof(In) > sizeof(Out) ? sizeof(In) / sizeof(Out) : 1;
+            constexpr std::size_t block_size = block_batches * batch_type::size;
+
+            std::size_t align_begin = xsimd::get_alignment_offset(in, size, batch_type::size);
+            std::size_t align_end = align_begin + (size - align_begin) / block_size * block_size;
+
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                out[i] = static_cast<Out>(f(static_cast<compute_type>(in[i])));
+            }
+            for (std::size_t i = align_begin; i < align_end; i += block_size)
+            {
+                batch_block<In, Arch, block_batches> x;
+                for (std::size_t k = 0; k < block_batches; ++k)
+                {
+                    x[k] = batch_type::load_aligned(in + i + k * batch_type::size);
+                }
+                transform_block(out + i, f, convert_registers<compute_type>(x));
+            }
+            for (std::size_t i = align_end; i < size; ++i)
+            {
+                out[i] = static_cast<Out>(f(static_cast<compute_type>(in[i])));
+            }
+        }
+
+        template <class Arch, class In, class Out, class F>
+        void transform_mixed(In const* in_1, In const* in_2, std::size_t size, Out* out, F& f)
+        {
+            using compute_type = transform_compute_type<In, Out>;
+            using batch_type = batch<In, Arch>;
+            constexpr std::size_t block_batches = sizeof(In) > sizeof(Out) ? sizeof(In) / sizeof(Out) : 1;
+            constexpr std::size_t block_size = block_batches * batch_type::size;
+
+            std::size_t align_begin = xsimd::get_alignment_offset(in_1, size, batch_type::size);
+            std::size_t align_end = align_begin + (size - align_begin) / block_size * block_size;
+
+            for (std::size_t i = 0; i < align_begin; ++i)
+            {
+                out[i] = static_cast<Out>(f(static_cast<compute_type>(in_1[i]), static_cast<compute_type>(in_2[i])));
+            }
+            for (std::size_t i = align_begin; i < align_end; i += block_size)
+            {
+                batch_block<In, Arch, block_batches> x_1, x_2;
+                for (std::size_t k = 0; k < block_batches; ++k)
+                {
+                    x_1[k] = batch_type::load_aligned(in_1 + i + k * batch_type::size);
+                    x_2[k] = batch_type::load_unaligned(in_2 + i + k * batch_type::size);
+                }
+                transform_block(out + i, f, convert_registers<compute_type>(x_1), convert_registers<compute_type>(x_2));
+            }
+            for (std::size_t i = align_end; i < size; ++i)
+            {
+                out[i] = static_cast<Out>(f(static_cast<compute_type>(in_1[i]), static_cast<compute_type>(in_2[i])));
+            }
+        }
+    }
+
+    /**
+     * Transform for input and output ranges of different value types, for
+     * instance computing \c float values from \c uint8_t ones. The functor
+     * is called on batches (and scalars) of the widest of both types: the
+     * input is converted to it in registers and the results of \c f, whose
+     * batches must have as many lanes, are converted to the output type
+     * with the \c conversion_policy::cast semantics. The functor should
+     * clamp its results when they may be out of the range of the output.
+     */
+    template <class Arch, class I1, class I2, class O1, class UF>
+    detail::mixed_value_transform<I1, O1> transform(I1 first, I2 last, O1 out_first, UF&& f)
+    {
+        static_assert(detail::all_contiguous<I1, O1>::value, "mixed transform of contiguous ranges");
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return;
+        }
+        detail::transform_mixed<Arch>(&(*first), size, &(*out_first), f);
+    }
+
+    /**
+     * Binary version of the mixed transform above, both inputs having the
+     * same value type.
+     */
+    template <class Arch, class I1, class I2, class I3, class O1, class UF>
+    detail::mixed_value_transform<I1, O1> transform(I1 first_1, I2 last_1, I3 first_2, O1 out_first, UF&& f)
+    {
+        static_assert(std::is_same<detail::iterator_value_type<I1>, detail::iterator_value_type<I3>>::value,
+                      "both inputs of a mixed transform have the same value type");
+        static_assert(detail::all_contiguous<I1, I3, O1>::value, "mixed transform of contiguous ranges");
+        std::size_t size = static_cast<std::size_t>(std::distance(first_1, last_1));
+        if (size == 0)
+        {
+            return;
+        }
+        detail::transform_mixed<Arch>(&(*first_1), &(*first_2), size, &(*out_first), f);
+    }
+
+    namespace detail
+    {
+        struct dispatched_transform
+        {
+            template <class Arch, class... Args>
+            void operator()(Arch, Args&&... args) const
+            {
+                ::xsimd::transform<Arch>(std::forward<Args>(args)...);
+            }
+        };
+
+        struct dispatched_reduce
+        {
+            template <class Arch, class Iterator1, class Iterator2, class Init, class BinaryFunction>
+            Init operator()(Arch, Iterator1 first, Iterator2 last, Init init, BinaryFunction&& binfun) const
+            {
+                return ::xsimd::reduce<Arch>(first, last, init, std::forward<BinaryFunction>(binfun));
+            }
+        };
+
+        // The dispatcher queries the cpu once, on first use.
+        template <class F, class ArchList>
+        detail::dispatcher<F, ArchList>& algorithm_dispatcher()
+        {
+            static detail::dispatcher<F, ArchList> dispatcher = ::xsimd::dispatch<F, ArchList>(F{});
+            return dispatcher;
+        }
+    }
+
+    /**
+     * Versions of the stl algorithms selecting, at runtime, the best
+     * architecture of \c ArchList available on the host. The functors must
+     * accept batches of any architecture of the list.
+     */
+    namespace dispatched
+    {
+        template <class ArchList = supported_architectures, class I1, class I2, class O1, class UF>
+        void transform(I1 first, I2 last, O1 out_first, UF&& f)
+        {
+            detail::algorithm_dispatcher<detail::dispatched_transform, ArchList>()(first, last, out_first, std::forward<UF>(f));
+        }
+
+        template <class ArchList = supported_architectures, class I1, class I2, class I3, class O1, class UF>
+        void transform(I1 first_1, I2 last_1, I3 first_2, O1 out_first, UF&& f)
+        {
+            detail::algorithm_dispatcher<detail::dispatched_transform, ArchList>()(first_1, last_1, first_2, out_first, std::forward<UF>(f));
+        }
+
+        template <class ArchList = supported_architectures, class Iterator1, class Iterator2, class Init, class BinaryFunction = detail::plus>
+        Init reduce(Iterator1 first, Iterator2 last, Init init, BinaryFunction&& binfun = detail::plus{})
+        {
+            return detail::algorithm_dispatcher<detail::dispatched_reduce, ArchList>()(first, last, init, std::forward<BinaryFunction>(binfun));
+        }
+    }
 }
 
 #endif
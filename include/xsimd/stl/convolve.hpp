@@ -0,0 +1,301 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_CONVOLVE_HPP
+#define XSIMD_CONVOLVE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "../memory/xsimd_aligned_allocator.hpp"
+#include "../types/xsimd_api.hpp"
+#include "./iterator.hpp"
+
+namespace xsimd
+{
+    namespace detail
+    {
+        template <class T>
+        using fir_vector = std::vector<T, aligned_allocator<T>>;
+
+        // Scalar outputs [begin, end) of correlate.
+        template <class T>
+        void correlate_scalar(T const* x, std::size_t begin, std::size_t end, T const* h, std::size_t m, T* out)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                T acc = T(0);
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    acc += h[j] * x[i + j];
+                }
+                out[i] = acc;
+            }
+        }
+
+        /**
+         * Register-blocked kernel for filters of \c M taps: the broadcast
+         * taps are kept in registers for the whole signal, and two batches
+         * of outputs are computed at once so that their multiply-add
+         * chains overlap.
+         */
+        template <class Arch, std::size_t M, class T>
+        void correlate_fixed(T const* x, std::size_t n, T const* h, T* out)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+
+            std::array<batch_type, M> taps;
+            for (std::size_t j = 0; j < M; ++j)
+            {
+                taps[j] = batch_type(h[j]);
+            }
+
+            std::size_t i = 0;
+            for (; i + 2 * simd_size <= n; i += 2 * simd_size)
+            {
+                batch_type acc0 = taps[0] * batch_type::load_unaligned(x + i);
+                batch_type acc1 = taps[0] * batch_type::load_unaligned(x + i + simd_size);
+                for (std::size_t j = 1; j < M; ++j)
+                {
+                    acc0 = fma(taps[j], batch_type::load_unaligned(x + i + j), acc0);
+                    acc1 = fma(taps[j], batch_type::load_unaligned(x + i + simd_size + j), acc1);
+                }
+                acc0.store_unaligned(out + i);
+                acc1.store_unaligned(out + i + simd_size);
+            }
+            for (; i + simd_size <= n; i += simd_size)
+            {
+                batch_type acc = taps[0] * batch_type::load_unaligned(x + i);
+                for (std::size_t j = 1; j < M; ++j)
+                {
+                    acc = fma(taps[j], batch_type::load_unaligned(x + i + j), acc);
+                }
+                acc.store_unaligned(out + i);
+            }
+            correlate_scalar(x, i, n, h, M, out);
+        }
+
+        template <class B, class T, std::size_t... Is>
+        void correlate_step(std::array<B, sizeof...(Is)>& acc, B const& tap, T const* x, index_sequence<Is...>)
+        {
+            (void)std::initializer_list<int>{(acc[Is] = fma(tap, B::load_unaligned(x + Is * B::size), acc[Is]), 0)...};
+        }
+
+        /**
+         * Kernel for filters of any length: each tap is broadcast once per
+         * block of \c Blocks batches of outputs and feeds one multiply-add
+         * per batch of the block.
+         */
+        template <class Arch, std::size_t Blocks, class T>
+        void correlate_blocked(T const* x, std::size_t n, T const* h, std::size_t m, T* out)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t simd_size = batch_type::size;
+            constexpr std::size_t block_size = Blocks * simd_size;
+
+            std::size_t i = 0;
+            for (; i + block_size <= n; i += block_size)
+            {
+                std::array<batch_type, Blocks> acc;
+                acc.fill(batch_type(T(0)));
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    correlate_step(acc, batch_type(h[j]), x + i + j, make_index_sequence<Blocks>());
+                }
+                for (std::size_t b = 0; b < Blocks; ++b)
+                {
+                    acc[b].store_unaligned(out + i + b * simd_size);
+                }
+            }
+            for (; i + simd_size <= n; i += simd_size)
+            {
+                batch_type acc(T(0));
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    acc = fma(batch_type(h[j]), batch_type::load_unaligned(x + i + j), acc);
+                }
+                acc.store_unaligned(out + i);
+            }
+            correlate_scalar(x, i, n, h, m, out);
+        }
+
+        /**
+         * Computes out[i] = h[0] * x[i] + ... + h[m - 1] * x[i + m - 1] for
+         * \c i in [0, \c n), \c x holding \c n + \c m - 1 values. Filters
+         * of up to eight taps use a register-blocked kernel of their
+         * exact length.
+         */
+        template <class Arch, class T>
+        void correlate(T const* x, std::size_t n, T const* h, std::size_t m, T* out)
+        {
+            switch (m)
+            {
+            case 1: return correlate_fixed<Arch, 1>(x, n, h, out);
+            case 2: return correlate_fixed<Arch, 2>(x, n, h, out);
+            case 3: return correlate_fixed<Arch, 3>(x, n, h, out);
+            case 4: return correlate_fixed<Arch, 4>(x, n, h, out);
+            case 5: return correlate_fixed<Arch, 5>(x, n, h, out);
+            case 6: return correlate_fixed<Arch, 6>(x, n, h, out);
+            case 7: return correlate_fixed<Arch, 7>(x, n, h, out);
+            case 8: return correlate_fixed<Arch, 8>(x, n, h, out);
+            default: return correlate_blocked<Arch, 4>(x, n, h, m, out);
+            }
+        }
+
+        // The kernels run a correlation, hence the taps in reverse order.
+        template <class T, class Iterator>
+        fir_vector<T> reversed_taps(Iterator first, Iterator last)
+        {
+            fir_vector<T> taps(first, last);
+            assert(!taps.empty() && "filters have at least one tap");
+            std::reverse(taps.begin(), taps.end());
+            return taps;
+        }
+    }
+
+    /**
+     * Convolves the signal [\c first, \c last) with the filter
+     * [\c taps_first, \c taps_last) and writes the outputs for which the
+     * filter lies entirely within the signal to the range beginning at
+     * \c d_first:
+     *
+     * out[i] = taps[0] * signal[i + m - 1] + ... + taps[m - 1] * signal[i]
+     *
+     * for \c i in [0, \c n - \c m], \c n and \c m being the lengths of the
+     * signal and of the filter. Nothing is written if the signal is
+     * shorter than the filter. Returns the end of the output range.
+     */
+    template <class Arch=default_arch, class Iterator1, class Iterator2, class OutputIterator>
+    OutputIterator convolve(Iterator1 first, Iterator1 last, Iterator2 taps_first, Iterator2 taps_last, OutputIterator d_first)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        static_assert(is_contiguous_iterator<Iterator1>::value && is_contiguous_iterator<OutputIterator>::value,
+                      "convolve requires contiguous signal and output");
+
+        auto const taps = detail::reversed_taps<value_type>(taps_first, taps_last);
+        std::size_t const size = static_cast<std::size_t>(std::distance(first, last));
+        if (size < taps.size())
+        {
+            return d_first;
+        }
+        std::size_t const count = size - taps.size() + 1;
+        detail::correlate<Arch>(&(*first), count, taps.data(), taps.size(), &(*d_first));
+        return d_first + count;
+    }
+
+    /**
+     * Convolves \c signal with \c taps into \c out, which must hold at
+     * least signal.size() - taps.size() + 1 values.
+     */
+    template <class Arch=default_arch, class Signal, class Taps, class Output>
+    void convolve(Signal const& signal, Taps const& taps, Output& out)
+    {
+        convolve<Arch>(std::begin(signal), std::end(signal), std::begin(taps), std::end(taps), std::begin(out));
+    }
+
+    /**
+     * Causal FIR filter processing a stream block by block: the output
+     * of each input sample is the sum of the \c m last samples weighted
+     * by the taps, the samples of the previous blocks included, and the
+     * samples before the first block being zeros.
+     *
+     * @code{.cpp}
+     * xsimd::fir_filter<float> filter(taps.begin(), taps.end());
+     * while (read(block))
+     * {
+     *     filter.process(block.begin(), block.end(), out.begin());
+     * }
+     * @endcode
+     */
+    template <class T, class Arch = default_arch>
+    class fir_filter
+    {
+    public:
+
+        using value_type = T;
+        using arch_type = Arch;
+
+        template <class Iterator>
+        fir_filter(Iterator taps_first, Iterator taps_last);
+
+        std::size_t size() const noexcept;
+        void reset();
+
+        template <class Iterator, class OutputIterator>
+        OutputIterator process(Iterator first, Iterator last, OutputIterator d_first);
+
+    private:
+
+        detail::fir_vector<T> m_taps;
+        // the last m - 1 samples, followed by the block being processed
+        detail::fir_vector<T> m_buffer;
+    };
+
+    template <class T, class Arch>
+    template <class Iterator>
+    fir_filter<T, Arch>::fir_filter(Iterator taps_first, Iterator taps_last)
+        : m_taps(detail::reversed_taps<T>(taps_first, taps_last))
+        , m_buffer(m_taps.size() - 1, T(0))
+    {
+    }
+
+    /**
+     * Number of taps of the filter.
+     */
+    template <class T, class Arch>
+    std::size_t fir_filter<T, Arch>::size() const noexcept
+    {
+        return m_taps.size();
+    }
+
+    /**
+     * Forgets the samples of the previous blocks.
+     */
+    template <class T, class Arch>
+    void fir_filter<T, Arch>::reset()
+    {
+        std::fill(m_buffer.begin(), m_buffer.end(), T(0));
+    }
+
+    /**
+     * Filters the block [\c first, \c last) and writes one output per
+     * input sample to the range beginning at \c d_first, which may be the
+     * input range. Returns the end of the output range.
+     */
+    template <class T, class Arch>
+    template <class Iterator, class OutputIterator>
+    OutputIterator fir_filter<T, Arch>::process(Iterator first, Iterator last, OutputIterator d_first)
+    {
+        static_assert(is_contiguous_iterator<OutputIterator>::value, "fir_filter requires a contiguous output");
+
+        std::size_t const history = m_taps.size() - 1;
+        std::size_t const size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+        {
+            return d_first;
+        }
+        m_buffer.resize(history + size);
+        std::copy(first, last, m_buffer.begin() + history);
+        detail::correlate<Arch>(m_buffer.data(), size, m_taps.data(), m_taps.size(), &(*d_first));
+        std::copy(m_buffer.begin() + size, m_buffer.end(), m_buffer.begin());
+        m_buffer.resize(history);
+        return d_first + size;
+    }
+}
+
+#endif
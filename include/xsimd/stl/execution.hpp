@@ -0,0 +1,314 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_EXECUTION_HPP
+#define XSIMD_EXECUTION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace xsimd
+{
+    /**
+     * Execution policy requesting the stl algorithms to split their
+     * range into chunks processed concurrently by an internal pool of
+     * threads. Each chunk is itself processed with batches.
+     *
+     * The policy may be restricted to a given number of threads, the
+     * calling thread included. A value of zero means all the hardware
+     * threads.
+     */
+    struct parallel_policy
+    {
+        constexpr parallel_policy() noexcept = default;
+        constexpr explicit parallel_policy(std::size_t num_threads) noexcept
+            : threads(num_threads)
+        {
+        }
+
+        std::size_t threads = 0;
+    };
+
+    constexpr parallel_policy par{};
+
+    namespace detail
+    {
+        /**
+         * Pool of worker threads running chunked loops.
+         *
+         * A loop over \c count chunks is split into one contiguous slice
+         * per participating thread. Each thread first drains its own slice,
+         * then steals the remaining chunks of the other ones, so that uneven
+         * chunk durations do not leave threads idle.
+         */
+        class thread_pool
+        {
+        public:
+
+            explicit thread_pool(std::size_t num_workers);
+            ~thread_pool();
+
+            thread_pool(thread_pool const&) = delete;
+            thread_pool& operator=(thread_pool const&) = delete;
+
+            std::size_t concurrency() const noexcept;
+
+            template <class F>
+            void parallel_for(std::size_t count, std::size_t num_threads, F&& f);
+
+            static thread_pool& instance();
+
+        private:
+
+            // padded to a cache line so that threads polling different
+            // slices do not contend on the same line
+            struct slice
+            {
+                std::atomic<std::size_t> next;
+                std::size_t end;
+                char padding[64 - sizeof(std::atomic<std::size_t>) - sizeof(std::size_t)];
+            };
+
+            void grow(std::size_t num_workers);
+            void worker_loop(std::size_t id, std::size_t generation);
+            void run_slices(std::size_t id);
+
+            static bool& in_worker() noexcept;
+
+            std::size_t const m_concurrency;
+            std::vector<std::thread> m_workers;
+            std::unique_ptr<slice[]> m_slices;
+
+            std::mutex m_submit_mutex;
+            std::mutex m_mutex;
+            std::condition_variable m_start;
+            std::condition_variable m_done;
+            std::size_t m_generation = 0;
+            std::size_t m_pending = 0;
+            std::size_t m_participants = 0;
+            bool m_stop = false;
+
+            std::function<void(std::size_t)> const* m_job = nullptr;
+            std::exception_ptr m_error;
+        };
+
+        inline thread_pool::thread_pool(std::size_t num_workers)
+            : m_concurrency(num_workers + 1)
+        {
+            grow(num_workers);
+        }
+
+        inline thread_pool::~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_start.notify_all();
+            for (auto& worker : m_workers)
+            {
+                worker.join();
+            }
+        }
+
+        inline std::size_t thread_pool::concurrency() const noexcept
+        {
+            return m_concurrency;
+        }
+
+        inline thread_pool& thread_pool::instance()
+        {
+            static thread_pool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1u);
+            return pool;
+        }
+
+        /**
+         * Spawns workers until the pool holds \c num_workers of them. Must
+         * not be called while a loop is running.
+         */
+        inline void thread_pool::grow(std::size_t num_workers)
+        {
+            m_slices.reset(new slice[num_workers + 1]);
+            m_workers.reserve(num_workers);
+            for (std::size_t i = m_workers.size(); i < num_workers; ++i)
+            {
+                m_workers.emplace_back(&thread_pool::worker_loop, this, i + 1, m_generation);
+            }
+        }
+
+        inline bool& thread_pool::in_worker() noexcept
+        {
+            static thread_local bool flag = false;
+            return flag;
+        }
+
+        /**
+         * Calls \c f(i) for each \c i in [0, \c count), using at most
+         * \c num_threads threads (zero meaning one per hardware thread),
+         * the calling thread included. The pool grows if more threads than
+         * hardware ones are requested. Returns once every call has completed
+         * and rethrows the first exception raised by \c f, if any. Nested
+         * calls from within \c f are run sequentially.
+         */
+        template <class F>
+        void thread_pool::parallel_for(std::size_t count, std::size_t num_threads, F&& f)
+        {
+            std::size_t participants = std::min(num_threads == 0 ? concurrency() : num_threads, count);
+            if (participants <= 1 || in_worker())
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    f(i);
+                }
+                return;
+            }
+
+            std::lock_guard<std::mutex> submit_lock(m_submit_mutex);
+            if (participants > m_workers.size() + 1)
+            {
+                grow(participants - 1);
+            }
+            std::function<void(std::size_t)> job(std::ref(f));
+            for (std::size_t p = 0; p < participants; ++p)
+            {
+                m_slices[p].next.store(p * count / participants, std::memory_order_relaxed);
+                m_slices[p].end = (p + 1) * count / participants;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_job = &job;
+                m_error = nullptr;
+                m_participants = participants;
+                m_pending = participants - 1;
+                ++m_generation;
+            }
+            m_start.notify_all();
+
+            run_slices(0);
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this]() { return m_pending == 0; });
+            m_job = nullptr;
+            if (m_error)
+            {
+                std::rethrow_exception(m_error);
+            }
+        }
+
+        inline void thread_pool::run_slices(std::size_t id)
+        {
+            bool& flag = in_worker();
+            bool const nested = flag;
+            flag = true;
+            for (std::size_t k = 0; k < m_participants; ++k)
+            {
+                slice& s = m_slices[(id + k) % m_participants];
+                std::size_t i;
+                while ((i = s.next.fetch_add(1, std::memory_order_relaxed)) < s.end)
+                {
+                    try
+                    {
+                        (*m_job)(i);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if (!m_error)
+                        {
+                            m_error = std::current_exception();
+                        }
+                    }
+                }
+            }
+            flag = nested;
+        }
+
+        inline void thread_pool::worker_loop(std::size_t id, std::size_t generation)
+        {
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_start.wait(lock, [&]() { return m_stop || m_generation != generation; });
+                    if (m_stop)
+                    {
+                        return;
+                    }
+                    generation = m_generation;
+                    if (id >= m_participants)
+                    {
+                        continue;
+                    }
+                }
+
+                run_slices(id);
+
+                bool last;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    last = --m_pending == 0;
+                }
+                if (last)
+                {
+                    m_done.notify_one();
+                }
+            }
+        }
+
+        /**
+         * Returns the number of elements per chunk for a parallel pass over
+         * \c size elements of type \c T with the given policy. Chunks hold
+         * a whole number of cache lines and are large enough to amortize the
+         * scheduling cost, while leaving a few chunks per thread for load
+         * balancing.
+         */
+        template <class T>
+        std::size_t parallel_chunk_size(std::size_t size, parallel_policy const& policy)
+        {
+            constexpr std::size_t cache_line = 64;
+            constexpr std::size_t min_chunk_bytes = 16 * 1024;
+            constexpr std::size_t chunks_per_thread = 4;
+            constexpr std::size_t line_size = sizeof(T) < cache_line ? cache_line / sizeof(T) : 1;
+
+            std::size_t threads = policy.threads == 0 ? thread_pool::instance().concurrency() : policy.threads;
+            std::size_t chunk = (size + threads * chunks_per_thread - 1) / (threads * chunks_per_thread);
+            chunk = std::max(chunk, (min_chunk_bytes + sizeof(T) - 1) / sizeof(T));
+            return (chunk + line_size - 1) / line_size * line_size;
+        }
+
+        /**
+         * Number of elements to process before the first chunk so that
+         * every following chunk starts on a cache line boundary.
+         */
+        template <class T>
+        std::size_t parallel_chunk_offset(T const* ptr, std::size_t size)
+        {
+            constexpr std::size_t cache_line = 64;
+            std::size_t const misalignment = reinterpret_cast<std::uintptr_t>(ptr) % cache_line;
+            if (misalignment == 0 || misalignment % sizeof(T) != 0)
+            {
+                return 0;
+            }
+            return std::min((cache_line - misalignment) / sizeof(T), size);
+        }
+    }
+}
+
+#endif
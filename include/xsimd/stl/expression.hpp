@@ -0,0 +1,472 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_EXPRESSION_HPP
+#define XSIMD_EXPRESSION_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../types/xsimd_api.hpp"
+#include "./iterator.hpp"
+
+namespace xsimd
+{
+    /**
+     * Lazy expression over arrays, built from expr() with the arithmetic
+     * operators and the math functions below, and computed by evaluate()
+     * in a single pass, without any intermediate array. The arrays of an
+     * expression hold the same number of values of the same type, and
+     * the scalars are converted to that type.
+     *
+     * @code{.cpp}
+     * std::vector<float> a, b, c, res;
+     * xsimd::evaluate(xsimd::expr(a) * b + xsimd::sin(xsimd::expr(c)), res.begin());
+     * @endcode
+     */
+    template <class E>
+    class expression
+    {
+    public:
+
+        using node_type = E;
+        using value_type = typename E::value_type;
+
+        explicit expression(E const& node)
+            : m_node(node)
+        {
+        }
+
+        E const& node() const noexcept { return m_node; }
+        std::size_t size() const noexcept { return m_node.size(); }
+
+    private:
+
+        E m_node;
+    };
+
+    namespace detail
+    {
+        inline std::size_t expression_size(std::size_t size) noexcept
+        {
+            return size;
+        }
+
+        // the scalars, of size max(), match arrays of any size
+        template <class... Sizes>
+        std::size_t expression_size(std::size_t lhs, std::size_t rhs, Sizes... sizes) noexcept
+        {
+            constexpr std::size_t any = std::numeric_limits<std::size_t>::max();
+            assert((lhs == rhs || lhs == any || rhs == any) && "the arrays of an expression hold the same number of values");
+            return expression_size(lhs == any ? rhs : lhs, sizes...);
+        }
+
+        inline bool all_aligned() noexcept
+        {
+            return true;
+        }
+
+        template <class... Bools>
+        bool all_aligned(bool aligned, Bools... others) noexcept
+        {
+            return aligned && all_aligned(others...);
+        }
+
+        // Leaf of an expression reading a contiguous array.
+        template <class T>
+        struct expression_array
+        {
+            using value_type = T;
+
+            T const* data;
+            std::size_t count;
+
+            std::size_t size() const noexcept { return count; }
+
+            // whether data + i is aligned whenever out + i is
+            template <class Arch>
+            bool aligned_with(T const* out) const noexcept
+            {
+                return (reinterpret_cast<std::uintptr_t>(data) - reinterpret_cast<std::uintptr_t>(out)) % Arch::alignment() == 0;
+            }
+
+            T scalar(std::size_t i) const { return data[i]; }
+
+            template <class Arch, class Mode>
+            batch<T, Arch> load(std::size_t i, Mode mode) const
+            {
+                return batch<T, Arch>::load(data + i, mode);
+            }
+        };
+
+        // Leaf of an expression broadcasting a scalar.
+        template <class T>
+        struct expression_scalar
+        {
+            using value_type = T;
+
+            T value;
+
+            std::size_t size() const noexcept { return std::numeric_limits<std::size_t>::max(); }
+
+            template <class Arch>
+            bool aligned_with(T const*) const noexcept
+            {
+                return true;
+            }
+
+            T scalar(std::size_t) const { return value; }
+
+            template <class Arch, class Mode>
+            batch<T, Arch> load(std::size_t, Mode) const
+            {
+                return batch<T, Arch>(value);
+            }
+        };
+
+        // Node of an expression applying F to the values of its operands.
+        template <class F, class... E>
+        struct expression_function
+        {
+            using value_type = typename std::decay<decltype(std::declval<F>()(std::declval<typename E::value_type>()...))>::type;
+
+            std::tuple<E...> operands;
+
+            std::size_t size() const noexcept
+            {
+                return size_impl(make_index_sequence<sizeof...(E)>());
+            }
+
+            template <class Arch>
+            bool aligned_with(value_type const* out) const noexcept
+            {
+                return aligned_with_impl<Arch>(out, make_index_sequence<sizeof...(E)>());
+            }
+
+            value_type scalar(std::size_t i) const
+            {
+                return scalar_impl(i, make_index_sequence<sizeof...(E)>());
+            }
+
+            template <class Arch, class Mode>
+            batch<value_type, Arch> load(std::size_t i, Mode mode) const
+            {
+                return load_impl<Arch>(i, mode, make_index_sequence<sizeof...(E)>());
+            }
+
+        private:
+
+            template <std::size_t... Is>
+            std::size_t size_impl(index_sequence<Is...>) const noexcept
+            {
+                return expression_size(std::get<Is>(operands).size()...);
+            }
+
+            template <class Arch, std::size_t... Is>
+            bool aligned_with_impl(value_type const* out, index_sequence<Is...>) const noexcept
+            {
+                return all_aligned(std::get<Is>(operands).template aligned_with<Arch>(out)...);
+            }
+
+            template <std::size_t... Is>
+            value_type scalar_impl(std::size_t i, index_sequence<Is...>) const
+            {
+                return F()(std::get<Is>(operands).scalar(i)...);
+            }
+
+            template <class Arch, class Mode, std::size_t... Is>
+            batch<value_type, Arch> load_impl(std::size_t i, Mode mode, index_sequence<Is...>) const
+            {
+                return F()(std::get<Is>(operands).template load<Arch>(i, mode)...);
+            }
+        };
+
+        template <class F, class... E>
+        expression<expression_function<F, E...>> make_expression(E const&... operands)
+        {
+            return expression<expression_function<F, E...>>(expression_function<F, E...> { std::tuple<E...>(operands...) });
+        }
+
+        /**
+         * Operands mixed with expressions: scalars become expression_scalar
+         * nodes and contiguous containers expression_array nodes, their
+         * values being of type T.
+         */
+        template <class T, class X, class Enable = void>
+        struct expression_operand
+        {
+        };
+
+        template <class T, class X>
+        struct expression_operand<T, X, typename std::enable_if<std::is_arithmetic<X>::value>::type>
+        {
+            using type = expression_scalar<T>;
+
+            static type make(X const& x) { return type { static_cast<T>(x) }; }
+        };
+
+        template <class T, class X>
+        struct expression_operand<T, X, typename std::enable_if<std::is_same<typename std::decay<decltype(*std::declval<X const&>().data())>::type, T>::value>::type>
+        {
+            using type = expression_array<T>;
+
+            static type make(X const& x) { return type { x.data(), static_cast<std::size_t>(x.size()) }; }
+        };
+
+        template <class T, class X>
+        using expression_operand_t = typename expression_operand<T, X>::type;
+
+#define XSIMD_EXPRESSION_FUNCTOR(NAME, FUNCTION)                                              \
+        struct NAME                                                                           \
+        {                                                                                     \
+            template <class... Args>                                                          \
+            auto operator()(Args const&... args) const -> decltype(FUNCTION(args...))         \
+            {                                                                                 \
+                return FUNCTION(args...);                                                     \
+            }                                                                                 \
+        };
+
+        XSIMD_EXPRESSION_FUNCTOR(abs_fn, ::xsimd::abs)
+        XSIMD_EXPRESSION_FUNCTOR(sqrt_fn, ::xsimd::sqrt)
+        XSIMD_EXPRESSION_FUNCTOR(cbrt_fn, ::xsimd::cbrt)
+        XSIMD_EXPRESSION_FUNCTOR(exp_fn, ::xsimd::exp)
+        XSIMD_EXPRESSION_FUNCTOR(exp2_fn, ::xsimd::exp2)
+        XSIMD_EXPRESSION_FUNCTOR(expm1_fn, ::xsimd::expm1)
+        XSIMD_EXPRESSION_FUNCTOR(log_fn, ::xsimd::log)
+        XSIMD_EXPRESSION_FUNCTOR(log2_fn, ::xsimd::log2)
+        XSIMD_EXPRESSION_FUNCTOR(log10_fn, ::xsimd::log10)
+        XSIMD_EXPRESSION_FUNCTOR(log1p_fn, ::xsimd::log1p)
+        XSIMD_EXPRESSION_FUNCTOR(sin_fn, ::xsimd::sin)
+        XSIMD_EXPRESSION_FUNCTOR(cos_fn, ::xsimd::cos)
+        XSIMD_EXPRESSION_FUNCTOR(tan_fn, ::xsimd::tan)
+        XSIMD_EXPRESSION_FUNCTOR(asin_fn, ::xsimd::asin)
+        XSIMD_EXPRESSION_FUNCTOR(acos_fn, ::xsimd::acos)
+        XSIMD_EXPRESSION_FUNCTOR(atan_fn, ::xsimd::atan)
+        XSIMD_EXPRESSION_FUNCTOR(sinh_fn, ::xsimd::sinh)
+        XSIMD_EXPRESSION_FUNCTOR(cosh_fn, ::xsimd::cosh)
+        XSIMD_EXPRESSION_FUNCTOR(tanh_fn, ::xsimd::tanh)
+        XSIMD_EXPRESSION_FUNCTOR(floor_fn, ::xsimd::floor)
+        XSIMD_EXPRESSION_FUNCTOR(ceil_fn, ::xsimd::ceil)
+        XSIMD_EXPRESSION_FUNCTOR(trunc_fn, ::xsimd::trunc)
+        XSIMD_EXPRESSION_FUNCTOR(pow_fn, ::xsimd::pow)
+        XSIMD_EXPRESSION_FUNCTOR(atan2_fn, ::xsimd::atan2)
+        XSIMD_EXPRESSION_FUNCTOR(hypot_fn, ::xsimd::hypot)
+        XSIMD_EXPRESSION_FUNCTOR(fma_fn, ::xsimd::fma)
+
+#undef XSIMD_EXPRESSION_FUNCTOR
+
+        struct negate_fn
+        {
+            template <class T>
+            auto operator()(T const& x) const -> decltype(-x) { return -x; }
+        };
+
+        struct plus_fn
+        {
+            template <class T>
+            auto operator()(T const& x, T const& y) const -> decltype(x + y) { return x + y; }
+        };
+
+        struct minus_fn
+        {
+            template <class T>
+            auto operator()(T const& x, T const& y) const -> decltype(x - y) { return x - y; }
+        };
+
+        struct multiplies_fn
+        {
+            template <class T>
+            auto operator()(T const& x, T const& y) const -> decltype(x * y) { return x * y; }
+        };
+
+        struct divides_fn
+        {
+            template <class T>
+            auto operator()(T const& x, T const& y) const -> decltype(x / y) { return x / y; }
+        };
+
+        struct min_fn
+        {
+            template <class T>
+            T operator()(T const& x, T const& y) const
+            {
+                using std::min;
+                return min(x, y);
+            }
+        };
+
+        struct max_fn
+        {
+            template <class T>
+            T operator()(T const& x, T const& y) const
+            {
+                using std::max;
+                return max(x, y);
+            }
+        };
+    }
+
+    /**
+     * Expression reading the values of the contiguous container \c c,
+     * which must outlive the expression.
+     */
+    template <class Container>
+    expression<detail::expression_array<typename Container::value_type>> expr(Container const& c)
+    {
+        using node_type = detail::expression_array<typename Container::value_type>;
+        return expression<node_type>(node_type { c.data(), static_cast<std::size_t>(c.size()) });
+    }
+
+    /**
+     * Expression reading the \c size values starting at \c data.
+     */
+    template <class T>
+    expression<detail::expression_array<T>> expr(T const* data, std::size_t size)
+    {
+        using node_type = detail::expression_array<T>;
+        return expression<node_type>(node_type { data, size });
+    }
+
+    // One overload for two expressions, and one for an expression and a
+    // scalar or a container on either side.
+#define XSIMD_EXPRESSION_BINARY(NAME, FUNCTOR)                                                                                 \
+    template <class E1, class E2>                                                                                              \
+    expression<detail::expression_function<FUNCTOR, E1, E2>> NAME(expression<E1> const& lhs, expression<E2> const& rhs)        \
+    {                                                                                                                          \
+        return detail::make_expression<FUNCTOR>(lhs.node(), rhs.node());                                                      \
+    }                                                                                                                          \
+    template <class E, class X>                                                                                                \
+    expression<detail::expression_function<FUNCTOR, E, detail::expression_operand_t<typename E::value_type, X>>>               \
+    NAME(expression<E> const& lhs, X const& rhs)                                                                               \
+    {                                                                                                                          \
+        return detail::make_expression<FUNCTOR>(lhs.node(), detail::expression_operand<typename E::value_type, X>::make(rhs)); \
+    }                                                                                                                          \
+    template <class X, class E>                                                                                                \
+    expression<detail::expression_function<FUNCTOR, detail::expression_operand_t<typename E::value_type, X>, E>>               \
+    NAME(X const& lhs, expression<E> const& rhs)                                                                               \
+    {                                                                                                                          \
+        return detail::make_expression<FUNCTOR>(detail::expression_operand<typename E::value_type, X>::make(lhs), rhs.node()); \
+    }
+
+    XSIMD_EXPRESSION_BINARY(operator+, detail::plus_fn)
+    XSIMD_EXPRESSION_BINARY(operator-, detail::minus_fn)
+    XSIMD_EXPRESSION_BINARY(operator*, detail::multiplies_fn)
+    XSIMD_EXPRESSION_BINARY(operator/, detail::divides_fn)
+    XSIMD_EXPRESSION_BINARY(min, detail::min_fn)
+    XSIMD_EXPRESSION_BINARY(max, detail::max_fn)
+    XSIMD_EXPRESSION_BINARY(pow, detail::pow_fn)
+    XSIMD_EXPRESSION_BINARY(atan2, detail::atan2_fn)
+    XSIMD_EXPRESSION_BINARY(hypot, detail::hypot_fn)
+
+#undef XSIMD_EXPRESSION_BINARY
+
+#define XSIMD_EXPRESSION_UNARY(NAME, FUNCTOR)                                    \
+    template <class E>                                                           \
+    expression<detail::expression_function<FUNCTOR, E>> NAME(expression<E> const& e) \
+    {                                                                            \
+        return detail::make_expression<FUNCTOR>(e.node());                       \
+    }
+
+    XSIMD_EXPRESSION_UNARY(operator-, detail::negate_fn)
+    XSIMD_EXPRESSION_UNARY(abs, detail::abs_fn)
+    XSIMD_EXPRESSION_UNARY(sqrt, detail::sqrt_fn)
+    XSIMD_EXPRESSION_UNARY(cbrt, detail::cbrt_fn)
+    XSIMD_EXPRESSION_UNARY(exp, detail::exp_fn)
+    XSIMD_EXPRESSION_UNARY(exp2, detail::exp2_fn)
+    XSIMD_EXPRESSION_UNARY(expm1, detail::expm1_fn)
+    XSIMD_EXPRESSION_UNARY(log, detail::log_fn)
+    XSIMD_EXPRESSION_UNARY(log2, detail::log2_fn)
+    XSIMD_EXPRESSION_UNARY(log10, detail::log10_fn)
+    XSIMD_EXPRESSION_UNARY(log1p, detail::log1p_fn)
+    XSIMD_EXPRESSION_UNARY(sin, detail::sin_fn)
+    XSIMD_EXPRESSION_UNARY(cos, detail::cos_fn)
+    XSIMD_EXPRESSION_UNARY(tan, detail::tan_fn)
+    XSIMD_EXPRESSION_UNARY(asin, detail::asin_fn)
+    XSIMD_EXPRESSION_UNARY(acos, detail::acos_fn)
+    XSIMD_EXPRESSION_UNARY(atan, detail::atan_fn)
+    XSIMD_EXPRESSION_UNARY(sinh, detail::sinh_fn)
+    XSIMD_EXPRESSION_UNARY(cosh, detail::cosh_fn)
+    XSIMD_EXPRESSION_UNARY(tanh, detail::tanh_fn)
+    XSIMD_EXPRESSION_UNARY(floor, detail::floor_fn)
+    XSIMD_EXPRESSION_UNARY(ceil, detail::ceil_fn)
+    XSIMD_EXPRESSION_UNARY(trunc, detail::trunc_fn)
+
+#undef XSIMD_EXPRESSION_UNARY
+
+    template <class E1, class E2, class E3>
+    expression<detail::expression_function<detail::fma_fn, E1, E2, E3>>
+    fma(expression<E1> const& x, expression<E2> const& y, expression<E3> const& z)
+    {
+        return detail::make_expression<detail::fma_fn>(x.node(), y.node(), z.node());
+    }
+
+    /**
+     * Writes the values of \c e to the range starting at \c out_first,
+     * in a single loop over batches. The output may be one of the arrays
+     * of the expression. The arrays are read with aligned loads when they
+     * are aligned like the output, with unaligned loads otherwise.
+     */
+    template <class Arch=default_arch, class E, class Iterator>
+    void evaluate(expression<E> const& e, Iterator out_first)
+    {
+        using value_type = typename expression<E>::value_type;
+        using batch_type = batch<value_type, Arch>;
+        static_assert(std::is_same<typename std::decay<decltype(*out_first)>::type, value_type>::value,
+                      "the output holds values of the type of the expression");
+        static_assert(is_contiguous_iterator<Iterator>::value, "evaluate requires a contiguous output");
+
+        std::size_t size = e.size();
+        assert(size != std::numeric_limits<std::size_t>::max() && "the expression reads at least one array");
+        if (size == 0)
+        {
+            return;
+        }
+
+        constexpr std::size_t simd_size = batch_type::size;
+        E const& node = e.node();
+        value_type* ptr_out = &(*out_first);
+        std::size_t align_begin = xsimd::get_alignment_offset(ptr_out, size, simd_size);
+        std::size_t align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+        for (std::size_t i = 0; i < align_begin; ++i)
+        {
+            ptr_out[i] = node.scalar(i);
+        }
+
+        if (node.template aligned_with<Arch>(ptr_out))
+        {
+            for (std::size_t i = align_begin; i < align_end; i += simd_size)
+            {
+                node.template load<Arch>(i, aligned_mode()).store_aligned(ptr_out + i);
+            }
+        }
+        else
+        {
+            for (std::size_t i = align_begin; i < align_end; i += simd_size)
+            {
+                node.template load<Arch>(i, unaligned_mode()).store_aligned(ptr_out + i);
+            }
+        }
+
+        for (std::size_t i = align_end; i < size; ++i)
+        {
+            ptr_out[i] = node.scalar(i);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,480 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_ITERATOR_HPP
+#define XSIMD_ITERATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../types/xsimd_api.hpp"
+
+namespace xsimd
+{
+    /**
+     * Random access iterator over the elements of memory separated by a
+     * constant \c stride, counted in elements, such as a column of a row
+     * major matrix or a field of an array of structures. The stl
+     * algorithms read and write it with gather and scatter instructions.
+     *
+     * @code{.cpp}
+     * // sum of the column j of a rows x cols row major matrix m
+     * auto column = xsimd::make_strided_iterator(m.data() + j, cols);
+     * float sum = xsimd::reduce(column, column + rows, 0.f);
+     * @endcode
+     */
+    template <class T>
+    class strided_iterator
+    {
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename std::remove_const<T>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        strided_iterator() noexcept = default;
+        strided_iterator(T* ptr, std::ptrdiff_t stride) noexcept
+            : m_ptr(ptr), m_stride(stride)
+        {
+        }
+
+        T* base() const noexcept { return m_ptr; }
+        std::ptrdiff_t stride() const noexcept { return m_stride; }
+
+        reference operator*() const noexcept { return *m_ptr; }
+        pointer operator->() const noexcept { return m_ptr; }
+        reference operator[](difference_type n) const noexcept { return m_ptr[n * m_stride]; }
+
+        strided_iterator& operator++() noexcept { m_ptr += m_stride; return *this; }
+        strided_iterator& operator--() noexcept { m_ptr -= m_stride; return *this; }
+        strided_iterator operator++(int) noexcept { strided_iterator tmp(*this); ++*this; return tmp; }
+        strided_iterator operator--(int) noexcept { strided_iterator tmp(*this); --*this; return tmp; }
+        strided_iterator& operator+=(difference_type n) noexcept { m_ptr += n * m_stride; return *this; }
+        strided_iterator& operator-=(difference_type n) noexcept { m_ptr -= n * m_stride; return *this; }
+
+        friend strided_iterator operator+(strided_iterator it, difference_type n) noexcept { return it += n; }
+        friend strided_iterator operator+(difference_type n, strided_iterator it) noexcept { return it += n; }
+        friend strided_iterator operator-(strided_iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(strided_iterator const& lhs, strided_iterator const& rhs) noexcept { return (lhs.m_ptr - rhs.m_ptr) / lhs.m_stride; }
+
+        friend bool operator==(strided_iterator const& lhs, strided_iterator const& rhs) noexcept { return lhs.m_ptr == rhs.m_ptr; }
+        friend bool operator!=(strided_iterator const& lhs, strided_iterator const& rhs) noexcept { return lhs.m_ptr != rhs.m_ptr; }
+        friend bool operator<(strided_iterator const& lhs, strided_iterator const& rhs) noexcept { return rhs - lhs > 0; }
+        friend bool operator>(strided_iterator const& lhs, strided_iterator const& rhs) noexcept { return rhs < lhs; }
+        friend bool operator<=(strided_iterator const& lhs, strided_iterator const& rhs) noexcept { return !(rhs < lhs); }
+        friend bool operator>=(strided_iterator const& lhs, strided_iterator const& rhs) noexcept { return !(lhs < rhs); }
+
+    private:
+
+        T* m_ptr = nullptr;
+        std::ptrdiff_t m_stride = 1;
+    };
+
+    template <class T>
+    strided_iterator<T> make_strided_iterator(T* ptr, std::ptrdiff_t stride) noexcept
+    {
+        return { ptr, stride };
+    }
+
+    /**
+     * Random access iterator over the elements <tt>base[index[i]]</tt>,
+     * \c index pointing to integral offsets. The stl algorithms read and
+     * write it with gather and scatter instructions; writing through it
+     * requires the offsets to be distinct.
+     */
+    template <class T, class Index>
+    class indirect_iterator
+    {
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename std::remove_const<T>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        static_assert(std::is_integral<Index>::value, "offsets are integers");
+
+        indirect_iterator() noexcept = default;
+        indirect_iterator(T* base, Index const* index) noexcept
+            : m_base(base), m_index(index)
+        {
+        }
+
+        T* base() const noexcept { return m_base; }
+        Index const* index() const noexcept { return m_index; }
+
+        reference operator*() const noexcept { return m_base[*m_index]; }
+        pointer operator->() const noexcept { return m_base + *m_index; }
+        reference operator[](difference_type n) const noexcept { return m_base[m_index[n]]; }
+
+        indirect_iterator& operator++() noexcept { ++m_index; return *this; }
+        indirect_iterator& operator--() noexcept { --m_index; return *this; }
+        indirect_iterator operator++(int) noexcept { indirect_iterator tmp(*this); ++*this; return tmp; }
+        indirect_iterator operator--(int) noexcept { indirect_iterator tmp(*this); --*this; return tmp; }
+        indirect_iterator& operator+=(difference_type n) noexcept { m_index += n; return *this; }
+        indirect_iterator& operator-=(difference_type n) noexcept { m_index -= n; return *this; }
+
+        friend indirect_iterator operator+(indirect_iterator it, difference_type n) noexcept { return it += n; }
+        friend indirect_iterator operator+(difference_type n, indirect_iterator it) noexcept { return it += n; }
+        friend indirect_iterator operator-(indirect_iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(indirect_iterator const& lhs, indirect_iterator const& rhs) noexcept { return lhs.m_index - rhs.m_index; }
+
+        friend bool operator==(indirect_iterator const& lhs, indirect_iterator const& rhs) noexcept { return lhs.m_index == rhs.m_index; }
+        friend bool operator!=(indirect_iterator const& lhs, indirect_iterator const& rhs) noexcept { return lhs.m_index != rhs.m_index; }
+        friend bool operator<(indirect_iterator const& lhs, indirect_iterator const& rhs) noexcept { return lhs.m_index < rhs.m_index; }
+        friend bool operator>(indirect_iterator const& lhs, indirect_iterator const& rhs) noexcept { return lhs.m_index > rhs.m_index; }
+        friend bool operator<=(indirect_iterator const& lhs, indirect_iterator const& rhs) noexcept { return lhs.m_index <= rhs.m_index; }
+        friend bool operator>=(indirect_iterator const& lhs, indirect_iterator const& rhs) noexcept { return lhs.m_index >= rhs.m_index; }
+
+    private:
+
+        T* m_base = nullptr;
+        Index const* m_index = nullptr;
+    };
+
+    template <class T, class Index>
+    indirect_iterator<T, Index> make_indirect_iterator(T* base, Index const* index) noexcept
+    {
+        return { base, index };
+    }
+
+    /**
+     * Tells whether the elements reached by an iterator are contiguous in
+     * memory, so that the stl algorithms may load them as whole batches
+     * from <tt>&*it</tt>. Only pointers, the iterators of std::vector,
+     * std::array and std::basic_string and, from C++20, the models of
+     * std::contiguous_iterator are known to be contiguous; the trait may
+     * be specialized to std::true_type for other iterators. The others are
+     * read and written through a buffer.
+     */
+    namespace detail
+    {
+        template <class Iterator>
+        struct is_std_contiguous_iterator : std::is_pointer<Iterator>
+        {
+        };
+
+#if defined(__GLIBCXX__)
+        template <class T, class Container>
+        struct is_std_contiguous_iterator<__gnu_cxx::__normal_iterator<T*, Container>> : std::true_type
+        {
+        };
+#endif
+
+#if defined(_LIBCPP_VERSION)
+        template <class T>
+        struct is_std_contiguous_iterator<std::__wrap_iter<T*>> : std::true_type
+        {
+        };
+#endif
+
+#if defined(_MSVC_STL_VERSION)
+        template <class Vector>
+        struct is_std_contiguous_iterator<std::_Vector_iterator<Vector>> : std::true_type
+        {
+        };
+
+        template <class Vector>
+        struct is_std_contiguous_iterator<std::_Vector_const_iterator<Vector>> : std::true_type
+        {
+        };
+
+        template <class String>
+        struct is_std_contiguous_iterator<std::_String_iterator<String>> : std::true_type
+        {
+        };
+
+        template <class String>
+        struct is_std_contiguous_iterator<std::_String_const_iterator<String>> : std::true_type
+        {
+        };
+
+        template <class T, std::size_t N>
+        struct is_std_contiguous_iterator<std::_Array_iterator<T, N>> : std::true_type
+        {
+        };
+
+        template <class T, std::size_t N>
+        struct is_std_contiguous_iterator<std::_Array_const_iterator<T, N>> : std::true_type
+        {
+        };
+#endif
+    }
+
+#if defined(__cpp_lib_concepts)
+    template <class Iterator>
+    struct is_contiguous_iterator
+        : std::integral_constant<bool, detail::is_std_contiguous_iterator<Iterator>::value || std::contiguous_iterator<Iterator>>
+    {
+    };
+#else
+    template <class Iterator>
+    struct is_contiguous_iterator : detail::is_std_contiguous_iterator<Iterator>
+    {
+    };
+#endif
+
+    template <class Iterator>
+    struct is_contiguous_iterator<std::move_iterator<Iterator>> : is_contiguous_iterator<Iterator>
+    {
+    };
+
+    namespace detail
+    {
+        /*
+         * Batch access to the elements of a range, by index from its first
+         * element: load and store for whole batches, get and set for a
+         * single element. Contiguous ranges are accessed with unaligned
+         * loads and stores, strided and indirect ones with gather and
+         * scatter when the offsets can be held in lanes as wide as the
+         * values, and any other random access range of lvalues through a
+         * buffer.
+         */
+        template <class Arch, class Iterator>
+        struct buffered_access
+        {
+            using value_type = typename std::iterator_traits<Iterator>::value_type;
+            using batch_type = batch<value_type, Arch>;
+
+            Iterator first;
+
+            explicit buffered_access(Iterator it)
+                : first(it)
+            {
+            }
+
+            batch_type load(std::size_t i) const
+            {
+                alignas(Arch::alignment()) value_type buffer[batch_type::size];
+                for (std::size_t k = 0; k < batch_type::size; ++k)
+                {
+                    buffer[k] = first[i + k];
+                }
+                return batch_type::load_aligned(buffer);
+            }
+
+            void store(std::size_t i, batch_type const& x) const
+            {
+                alignas(Arch::alignment()) value_type buffer[batch_type::size];
+                x.store_aligned(buffer);
+                for (std::size_t k = 0; k < batch_type::size; ++k)
+                {
+                    first[i + k] = buffer[k];
+                }
+            }
+
+            value_type get(std::size_t i) const { return first[i]; }
+            void set(std::size_t i, value_type const& x) const { first[i] = x; }
+        };
+
+        template <class Arch, class Iterator, class Enable = void>
+        struct batch_access : buffered_access<Arch, Iterator>
+        {
+            explicit batch_access(Iterator it)
+                : buffered_access<Arch, Iterator>(it)
+            {
+            }
+        };
+
+        template <class Arch, class Iterator>
+        struct batch_access<Arch, Iterator, typename std::enable_if<is_contiguous_iterator<Iterator>::value>::type>
+        {
+            using value_type = typename std::iterator_traits<Iterator>::value_type;
+            using batch_type = batch<value_type, Arch>;
+            using pointer = typename std::remove_reference<typename std::iterator_traits<Iterator>::reference>::type*;
+
+            pointer ptr;
+
+            explicit batch_access(Iterator first)
+                : ptr(&(*first))
+            {
+            }
+
+            batch_type load(std::size_t i) const { return batch_type::load_unaligned(ptr + i); }
+            void store(std::size_t i, batch_type const& x) const { x.store_unaligned(ptr + i); }
+            value_type get(std::size_t i) const { return ptr[i]; }
+            void set(std::size_t i, value_type const& x) const { ptr[i] = x; }
+        };
+
+        // offsets are signed integers of the width of the values
+        template <class T>
+        using gather_offset_type = typename std::make_signed<as_unsigned_integer_t<T>>::type;
+
+        template <class T>
+        using gather_enabled = typename std::enable_if<(sizeof(T) >= 4)>::type;
+
+        // whether every value of Index can be held in an Offset
+        template <class Index, class Offset>
+        struct is_offset_convertible
+            : std::integral_constant<bool, std::is_signed<Index>::value ? sizeof(Index) <= sizeof(Offset) : sizeof(Index) < sizeof(Offset)>
+        {
+        };
+
+        template <class Offset, class Index>
+        bool is_offset(Index idx, std::true_type) noexcept
+        {
+            return std::intmax_t(idx) >= std::intmax_t(std::numeric_limits<Offset>::min()) && std::intmax_t(idx) <= std::intmax_t(std::numeric_limits<Offset>::max());
+        }
+
+        template <class Offset, class Index>
+        bool is_offset(Index idx, std::false_type) noexcept
+        {
+            return std::uintmax_t(idx) <= std::uintmax_t(std::numeric_limits<Offset>::max());
+        }
+
+        // strides whose multiples up to the size of a batch overflow the
+        // offsets are read and written through a buffer
+        template <class Arch, class T>
+        struct batch_access<Arch, strided_iterator<T>, gather_enabled<T>>
+        {
+            using value_type = typename std::remove_const<T>::type;
+            using batch_type = batch<value_type, Arch>;
+            using offset_type = gather_offset_type<value_type>;
+            using offset_batch = batch<offset_type, Arch>;
+
+            T* ptr;
+            std::ptrdiff_t stride;
+            bool use_gather;
+            offset_batch offsets;
+
+            explicit batch_access(strided_iterator<T> first)
+                : ptr(first.base()), stride(first.stride())
+            {
+                using limits = std::numeric_limits<offset_type>;
+                std::ptrdiff_t const last = batch_type::size > 1 ? static_cast<std::ptrdiff_t>(batch_type::size - 1) : 1;
+                use_gather = is_offset_convertible<std::ptrdiff_t, offset_type>::value
+                    || (stride >= std::ptrdiff_t(limits::min()) / last && stride <= std::ptrdiff_t(limits::max()) / last);
+                alignas(Arch::alignment()) offset_type buffer[batch_type::size];
+                for (std::size_t k = 0; k < batch_type::size; ++k)
+                {
+                    buffer[k] = use_gather ? static_cast<offset_type>(static_cast<std::ptrdiff_t>(k) * stride) : offset_type(0);
+                }
+                offsets = offset_batch::load_aligned(buffer);
+            }
+
+            T* address(std::size_t i) const { return ptr + static_cast<std::ptrdiff_t>(i) * stride; }
+
+            batch_type load(std::size_t i) const
+            {
+                if (use_gather)
+                {
+                    return gather(static_cast<value_type const*>(address(i)), offsets);
+                }
+                return buffered_access<Arch, strided_iterator<T>>(strided_iterator<T>(ptr, stride)).load(i);
+            }
+
+            void store(std::size_t i, batch_type const& x) const
+            {
+                if (use_gather)
+                {
+                    scatter(x, address(i), offsets);
+                }
+                else
+                {
+                    buffered_access<Arch, strided_iterator<T>>(strided_iterator<T>(ptr, stride)).store(i, x);
+                }
+            }
+
+            value_type get(std::size_t i) const { return *address(i); }
+            void set(std::size_t i, value_type const& x) const { *address(i) = x; }
+        };
+
+        // batches of indices that do not fit in the offsets are read and
+        // written through a buffer
+        template <class Arch, class T, class Index>
+        struct batch_access<Arch, indirect_iterator<T, Index>, gather_enabled<T>>
+        {
+            using value_type = typename std::remove_const<T>::type;
+            using batch_type = batch<value_type, Arch>;
+            using offset_type = gather_offset_type<value_type>;
+            using offset_batch = batch<offset_type, Arch>;
+
+            T* base;
+            Index const* index;
+
+            explicit batch_access(indirect_iterator<T, Index> first)
+                : base(first.base()), index(first.index())
+            {
+            }
+
+            // signed indices of the width of the values are loaded as they are
+            bool offsets(std::size_t i, offset_batch& res, std::true_type) const
+            {
+                res = offset_batch::load_unaligned(reinterpret_cast<offset_type const*>(index + i));
+                return true;
+            }
+
+            bool offsets(std::size_t i, offset_batch& res, std::false_type) const
+            {
+                alignas(Arch::alignment()) offset_type buffer[batch_type::size];
+                for (std::size_t k = 0; k < batch_type::size; ++k)
+                {
+                    Index const idx = index[i + k];
+                    if (!is_offset_convertible<Index, offset_type>::value && !is_offset<offset_type>(idx, std::is_signed<Index> {}))
+                    {
+                        return false;
+                    }
+                    buffer[k] = static_cast<offset_type>(idx);
+                }
+                res = offset_batch::load_aligned(buffer);
+                return true;
+            }
+
+            bool offsets(std::size_t i, offset_batch& res) const
+            {
+                return offsets(i, res, std::integral_constant<bool, std::is_signed<Index>::value && sizeof(Index) == sizeof(offset_type)> {});
+            }
+
+            batch_type load(std::size_t i) const
+            {
+                offset_batch off;
+                if (offsets(i, off))
+                {
+                    return gather(static_cast<value_type const*>(base), off);
+                }
+                return buffered_access<Arch, indirect_iterator<T, Index>>(indirect_iterator<T, Index>(base, index)).load(i);
+            }
+
+            void store(std::size_t i, batch_type const& x) const
+            {
+                offset_batch off;
+                if (offsets(i, off))
+                {
+                    scatter(x, base, off);
+                }
+                else
+                {
+                    buffered_access<Arch, indirect_iterator<T, Index>>(indirect_iterator<T, Index>(base, index)).store(i, x);
+                }
+            }
+
+            value_type get(std::size_t i) const { return base[index[i]]; }
+            void set(std::size_t i, value_type const& x) const { base[index[i]] = x; }
+        };
+
+        template <class Arch, class Iterator>
+        batch_access<Arch, Iterator> make_batch_access(Iterator first)
+        {
+            return batch_access<Arch, Iterator>(first);
+        }
+    }
+}
+
+#endif
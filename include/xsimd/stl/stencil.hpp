@@ -0,0 +1,462 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_STENCIL_HPP
+#define XSIMD_STENCIL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#include "../types/xsimd_api.hpp"
+
+namespace xsimd
+{
+    /**
+     * Compile-time weights of a \c Size x \c Size stencil, given row by
+     * row, the weighted sum being divided by \c Divisor. Zero weights cost
+     * nothing and unit weights are applied with an addition or a
+     * subtraction.
+     *
+     * @code{.cpp}
+     * using gaussian_3x3 = xsimd::stencil_weights<3, 16,
+     *                                             1, 2, 1,
+     *                                             2, 4, 2,
+     *                                             1, 2, 1>;
+     * @endcode
+     */
+    template <std::size_t Size, int Divisor, int... Weights>
+    struct stencil_weights
+    {
+        static_assert(Size > 0 && sizeof...(Weights) == Size * Size, "one weight per element of the stencil");
+        static_assert(Divisor > 0, "positive divisor");
+
+        static constexpr std::size_t size = Size;
+        static constexpr int divisor = Divisor;
+
+        static constexpr int get(std::size_t row, std::size_t col)
+        {
+            return values[row * Size + col];
+        }
+
+        // sums of the positive and of the negative weights
+        static constexpr int positive_sum(std::size_t i = 0)
+        {
+            return i == sizeof...(Weights) ? 0 : (values[i] > 0 ? values[i] : 0) + positive_sum(i + 1);
+        }
+
+        static constexpr int negative_sum(std::size_t i = 0)
+        {
+            return i == sizeof...(Weights) ? 0 : (values[i] < 0 ? values[i] : 0) + negative_sum(i + 1);
+        }
+
+    private:
+
+        static constexpr int values[sizeof...(Weights)] = { Weights... };
+    };
+
+    template <std::size_t Size, int Divisor, int... Weights>
+    constexpr int stencil_weights<Size, Divisor, Weights...>::values[];
+
+    namespace detail
+    {
+        constexpr bool stencil_power_of_two(int n)
+        {
+            return n > 0 && (n & (n - 1)) == 0;
+        }
+
+        constexpr int stencil_log2(int n)
+        {
+            return n <= 1 ? 0 : 1 + stencil_log2(n / 2);
+        }
+
+        /**
+         * Type of the sums of a stencil over values of type \c T: floating
+         * point values are summed in their own type, 8-bit pixels in 16-bit
+         * integers, unsigned ones if no weight is negative, when the sums
+         * and their rounding cannot overflow, in 32-bit integers otherwise.
+         */
+        template <class T, class Weights>
+        struct stencil_accumulator
+        {
+            using type = T;
+        };
+
+        template <class Weights>
+        struct stencil_accumulator<uint8_t, Weights>
+        {
+            static constexpr bool fits_unsigned = stencil_power_of_two(Weights::divisor)
+                && Weights::negative_sum() == 0
+                && 255 * Weights::positive_sum() + Weights::divisor / 2 <= 65535;
+            static constexpr bool fits_signed = stencil_power_of_two(Weights::divisor)
+                && 255 * Weights::positive_sum() + Weights::divisor / 2 <= 32767
+                && 255 * Weights::negative_sum() >= -32768;
+            using type = typename std::conditional<fits_unsigned, uint16_t,
+                                                   typename std::conditional<fits_signed, int16_t, int32_t>::type>::type;
+        };
+
+        // How integer sums are divided: not at all, by a rounding shift,
+        // or through a float multiplication.
+        template <class Weights>
+        using stencil_division = std::integral_constant<int, Weights::divisor == 1 ? 0 : (stencil_power_of_two(Weights::divisor) ? 1 : 2)>;
+
+        template <class Weights, class B>
+        B stencil_divide(B const& acc, std::integral_constant<int, 0>)
+        {
+            return acc;
+        }
+
+        template <class Weights, class T, class A>
+        batch<T, A> stencil_divide(batch<T, A> const& acc, std::integral_constant<int, 1>)
+        {
+            return (acc + batch<T, A>(T(Weights::divisor / 2))) >> stencil_log2(Weights::divisor);
+        }
+
+        template <class Weights, class T>
+        T stencil_divide(T acc, std::integral_constant<int, 1>)
+        {
+            return T((acc + T(Weights::divisor / 2)) >> stencil_log2(Weights::divisor));
+        }
+
+        template <class Weights, class A>
+        batch<int32_t, A> stencil_divide(batch<int32_t, A> const& acc, std::integral_constant<int, 2>)
+        {
+            return to_int(nearbyint(to_float(acc) * batch<float, A>(1.f / float(Weights::divisor))));
+        }
+
+        template <class Weights>
+        int32_t stencil_divide(int32_t acc, std::integral_constant<int, 2>)
+        {
+            return static_cast<int32_t>(std::nearbyint(float(acc) * (1.f / float(Weights::divisor))));
+        }
+
+        // Divides the sums of a stencil, rounded and saturated to the pixel
+        // range for integers.
+        template <class Weights, class B>
+        B stencil_normalize(B const& acc, std::true_type)
+        {
+            using value_type = typename B::value_type;
+            return Weights::divisor == 1 ? acc : acc * B(value_type(1) / value_type(Weights::divisor));
+        }
+
+        template <class Weights, class B>
+        B stencil_normalize(B const& acc, std::false_type)
+        {
+            return min(max(stencil_divide<Weights>(acc, stencil_division<Weights>()), B(0)), B(255));
+        }
+
+        template <class Weights, class T, class Acc>
+        T stencil_normalize_scalar(Acc acc, std::true_type)
+        {
+            return Weights::divisor == 1 ? acc : acc * (T(1) / T(Weights::divisor));
+        }
+
+        template <class Weights, class T, class Acc>
+        T stencil_normalize_scalar(Acc acc, std::false_type)
+        {
+            Acc const res = stencil_divide<Weights>(acc, stencil_division<Weights>());
+            return T(std::min(std::max(res, Acc(0)), Acc(255)));
+        }
+
+        /**
+         * Loads batches of pixels of type \c T as batches of accumulators
+         * of type \c Acc, and stores them back once normalized.
+         */
+        template <class T, class Acc, class A>
+        struct stencil_io
+        {
+            using acc_batch = batch<T, A>;
+            using acc_array = std::array<acc_batch, 1>;
+            static constexpr std::size_t size = acc_batch::size;
+
+            static acc_array load(T const* ptr)
+            {
+                return {{ acc_batch::load_unaligned(ptr) }};
+            }
+
+            template <class Weights>
+            static void store(T* ptr, acc_array const& acc)
+            {
+                stencil_normalize<Weights>(acc[0], std::true_type()).store_unaligned(ptr);
+            }
+        };
+
+        template <class Acc, class A>
+        struct stencil_io_16
+        {
+            using acc_batch = batch<Acc, A>;
+            using acc_array = std::array<acc_batch, 2>;
+            static constexpr std::size_t size = batch<uint8_t, A>::size;
+
+            static acc_array load(uint8_t const* ptr)
+            {
+                auto const x = widen(batch<uint8_t, A>::load_unaligned(ptr));
+                return {{ bitwise_cast<acc_batch>(x[0]), bitwise_cast<acc_batch>(x[1]) }};
+            }
+
+            template <class Weights>
+            static void store(uint8_t* ptr, acc_array const& acc)
+            {
+                auto const res = narrow(stencil_normalize<Weights>(acc[0], std::false_type()), stencil_normalize<Weights>(acc[1], std::false_type()));
+                bitwise_cast<batch<uint8_t, A>>(res).store_unaligned(ptr);
+            }
+        };
+
+        template <class A>
+        struct stencil_io<uint8_t, uint16_t, A> : stencil_io_16<uint16_t, A>
+        {
+        };
+
+        template <class A>
+        struct stencil_io<uint8_t, int16_t, A> : stencil_io_16<int16_t, A>
+        {
+        };
+
+        template <class A>
+        struct stencil_io<uint8_t, int32_t, A>
+        {
+            using acc_batch = batch<int32_t, A>;
+            using acc_array = std::array<acc_batch, 4>;
+            static constexpr std::size_t size = batch<uint8_t, A>::size;
+
+            static acc_array load(uint8_t const* ptr)
+            {
+                auto const x = widen(batch<uint8_t, A>::load_unaligned(ptr));
+                auto const lo = widen(x[0]);
+                auto const hi = widen(x[1]);
+                return {{ bitwise_cast<acc_batch>(lo[0]), bitwise_cast<acc_batch>(lo[1]),
+                          bitwise_cast<acc_batch>(hi[0]), bitwise_cast<acc_batch>(hi[1]) }};
+            }
+
+            template <class Weights>
+            static void store(uint8_t* ptr, acc_array const& acc)
+            {
+                auto const lo = narrow(stencil_normalize<Weights>(acc[0], std::false_type()), stencil_normalize<Weights>(acc[1], std::false_type()));
+                auto const hi = narrow(stencil_normalize<Weights>(acc[2], std::false_type()), stencil_normalize<Weights>(acc[3], std::false_type()));
+                bitwise_cast<batch<uint8_t, A>>(narrow(lo, hi)).store_unaligned(ptr);
+            }
+        };
+
+        template <int W>
+        struct stencil_tap
+        {
+            template <class B>
+            static void apply(B& acc, B const& x)
+            {
+                acc += x * B(typename B::value_type(W));
+            }
+        };
+
+        template <>
+        struct stencil_tap<1>
+        {
+            template <class B>
+            static void apply(B& acc, B const& x)
+            {
+                acc += x;
+            }
+        };
+
+        template <>
+        struct stencil_tap<-1>
+        {
+            template <class B>
+            static void apply(B& acc, B const& x)
+            {
+                acc -= x;
+            }
+        };
+
+        template <>
+        struct stencil_tap<0>
+        {
+            template <class B>
+            static void apply(B&, B const&)
+            {
+            }
+        };
+
+        // Loads the batch at \c ptr once and adds it, weighted, to the sums
+        // of the two output rows it contributes to.
+        template <int W0, int W1>
+        struct stencil_pair
+        {
+            template <class IO, class T>
+            static void apply(typename IO::acc_array& acc0, typename IO::acc_array& acc1, T const* ptr)
+            {
+                auto const x = IO::load(ptr);
+                for (std::size_t k = 0; k < x.size(); ++k)
+                {
+                    stencil_tap<W0>::apply(acc0[k], x[k]);
+                    stencil_tap<W1>::apply(acc1[k], x[k]);
+                }
+            }
+        };
+
+        template <>
+        struct stencil_pair<0, 0>
+        {
+            template <class IO, class T>
+            static void apply(typename IO::acc_array&, typename IO::acc_array&, T const*)
+            {
+            }
+        };
+
+        /**
+         * Sums of \c Rows consecutive output rows, one or two, at the
+         * batch of columns starting at \c in. The \c Size + \c Rows - 1
+         * input rows are loaded once, each row but the first and the last
+         * contributing to both output rows when \c Rows is two.
+         */
+        template <class Weights, class IO, std::size_t Rows, class T, std::size_t... Is>
+        void stencil_block(T const* in, std::size_t stride, typename IO::acc_array& acc0, typename IO::acc_array& acc1,
+                           index_sequence<Is...>)
+        {
+            constexpr std::size_t n = Weights::size;
+            (void)std::initializer_list<int>{(stencil_pair<(Is / n < n ? Weights::get(Is / n, Is % n) : 0),
+                                                           (Rows == 2 && Is / n >= 1 ? Weights::get(Is / n - 1, Is % n) : 0)>::template apply<IO>(acc0, acc1, in + (Is / n) * stride + Is % n),
+                                              0)...};
+        }
+
+        template <class Weights, class Acc, class T>
+        T stencil_scalar(T const* in, std::size_t stride)
+        {
+            Acc acc = Acc(0);
+            for (std::size_t r = 0; r < Weights::size; ++r)
+            {
+                for (std::size_t c = 0; c < Weights::size; ++c)
+                {
+                    acc = Acc(acc + Acc(Weights::get(r, c)) * Acc(in[r * stride + c]));
+                }
+            }
+            return stencil_normalize_scalar<Weights, T>(acc, std::is_floating_point<T>());
+        }
+
+        /**
+         * Output rows [0, \c Rows) and columns [\c begin, \c end) of a
+         * stencil. Columns left after the last whole batch are computed by
+         * a batch ending at \c end, overlapping the previous one, when the
+         * range is wide enough.
+         */
+        template <class Weights, class Arch, std::size_t Rows, class T>
+        void stencil_rows(T const* in, std::size_t in_stride, T* out, std::size_t out_stride, std::size_t begin, std::size_t end)
+        {
+            using acc_type = typename stencil_accumulator<T, Weights>::type;
+            using io = stencil_io<T, acc_type, Arch>;
+            using taps = make_index_sequence<(Weights::size + Rows - 1) * Weights::size>;
+            constexpr std::size_t simd_size = io::size;
+
+            auto compute = [&](std::size_t j)
+            {
+                typename io::acc_array acc0, acc1;
+                acc0.fill(typename io::acc_batch(acc_type(0)));
+                acc1.fill(typename io::acc_batch(acc_type(0)));
+                stencil_block<Weights, io, Rows>(in + j, in_stride, acc0, acc1, taps());
+                io::template store<Weights>(out + j, acc0);
+                if (Rows == 2)
+                {
+                    io::template store<Weights>(out + out_stride + j, acc1);
+                }
+            };
+
+            std::size_t j = begin;
+            for (; j + simd_size <= end; j += simd_size)
+            {
+                compute(j);
+            }
+            if (j != end && end - begin >= simd_size)
+            {
+                compute(end - simd_size);
+                j = end;
+            }
+            for (; j < end; ++j)
+            {
+                for (std::size_t r = 0; r < Rows; ++r)
+                {
+                    out[r * out_stride + j] = stencil_scalar<Weights, acc_type>(in + r * in_stride + j, in_stride);
+                }
+            }
+        }
+
+        // Output columns per tile, so that the input rows of a pair of
+        // output rows fill half of a 32 KiB L1 cache.
+        template <class T, class Arch>
+        std::size_t stencil_tile_cols(std::size_t rows)
+        {
+            constexpr std::size_t simd_size = batch<T, Arch>::size;
+            std::size_t const cols = 16 * 1024 / (rows * sizeof(T));
+            return std::max(simd_size, cols / simd_size * simd_size);
+        }
+    }
+
+    /**
+     * Applies the stencil \c Weights to the \c rows x \c cols row-major
+     * image \c in, whose rows are \c in_stride elements apart, and writes
+     * the outputs for which the stencil lies entirely within the image
+     * to \c out, whose rows are \c out_stride elements apart:
+     *
+     * out(i, j) = sum(w(r, c) * in(i + r, j + c)) / divisor
+     *
+     * for \c i in [0, \c rows - \c Size] and \c j in [0, \c cols - \c Size].
+     * Pixels of type \c uint8_t are rounded and saturated, and computed
+     * with 16-bit sums when they cannot overflow. The image is processed
+     * in column tiles whose rows stay in cache, two output rows at a time
+     * sharing the loads of their common input rows. \c out must not
+     * overlap \c in.
+     */
+    template <class Weights, class Arch=default_arch, class T>
+    void stencil2d(T const* in, std::size_t rows, std::size_t cols, std::size_t in_stride, T* out, std::size_t out_stride)
+    {
+        static_assert(std::is_floating_point<T>::value || std::is_same<T, uint8_t>::value,
+                      "stencils apply to floating point or 8-bit images");
+
+        constexpr std::size_t size = Weights::size;
+        if (rows < size || cols < size)
+        {
+            return;
+        }
+        std::size_t const out_rows = rows - size + 1;
+        std::size_t const out_cols = cols - size + 1;
+        std::size_t const tile_cols = detail::stencil_tile_cols<T, Arch>(size + 1);
+
+        for (std::size_t begin = 0; begin < out_cols; begin += tile_cols)
+        {
+            std::size_t const end = std::min(begin + tile_cols, out_cols);
+            std::size_t i = 0;
+            for (; i + 2 <= out_rows; i += 2)
+            {
+                detail::stencil_rows<Weights, Arch, 2>(in + i * in_stride, in_stride, out + i * out_stride, out_stride, begin, end);
+            }
+            if (i < out_rows)
+            {
+                detail::stencil_rows<Weights, Arch, 1>(in + i * in_stride, in_stride, out + i * out_stride, out_stride, begin, end);
+            }
+        }
+    }
+
+    /**
+     * Applies the stencil \c Weights to a contiguous \c rows x \c cols
+     * image, the output being a contiguous (\c rows - \c Size + 1) x
+     * (\c cols - \c Size + 1) image.
+     */
+    template <class Weights, class Arch=default_arch, class T>
+    void stencil2d(T const* in, std::size_t rows, std::size_t cols, T* out)
+    {
+        std::size_t const out_cols = cols < Weights::size ? 0 : cols - Weights::size + 1;
+        stencil2d<Weights, Arch>(in, rows, cols, cols, out, out_cols);
+    }
+}
+
+#endif
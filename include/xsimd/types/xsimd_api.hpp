@@ -12,6 +12,7 @@
 #ifndef XSIMD_API_HPP
 #define XSIMD_API_HPP
 
+#include <array>
 #include <complex>
 #include <cstddef>
 #include <limits>
@@ -381,6 +382,97 @@ batch<T, A> clip(batch<T, A> const& x, batch<T, A> const& lo, batch<T, A> const&
   return kernel::clip(x, lo, hi, A{});
 }
 
+/**
+ * @ingroup batch_math
+ *
+ * Clips the values of the batch \c x between those of the batches \c lo and
+ * \c hi with the cheapest sequence of the architecture: the result for a NaN
+ * in \c x is either \c lo or NaN depending on the architecture.
+ * @param x batch of floating point values.
+ * @param lo batch of floating point values, none of them NaN.
+ * @param hi batch of floating point values, none of them NaN.
+ * @return the result of the clipping.
+ */
+template<class A, class T>
+batch<T, A> clip_fast(batch<T, A> const& x, batch<T, A> const& lo, batch<T, A> const& hi) {
+  return kernel::clip_fast<A>(x, lo, hi, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Clips the values of the batch \c x between those of the batches \c lo and
+ * \c hi, a NaN in \c x being clipped to \c lo, as
+ * <tt>fmin(hi, fmax(x, lo))</tt> does.
+ * @param x batch of floating point values.
+ * @param lo batch of floating point values, none of them NaN.
+ * @param hi batch of floating point values, none of them NaN.
+ * @return the result of the clipping.
+ */
+template<class A, class T>
+batch<T, A> clip_ignore_nan(batch<T, A> const& x, batch<T, A> const& lo, batch<T, A> const& hi) {
+  return kernel::clip_ignore_nan<A>(x, lo, hi, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Clips the values of the batch \c x between those of the batches \c lo and
+ * \c hi, a NaN in \c x giving NaN.
+ * @param x batch of floating point values.
+ * @param lo batch of floating point values, none of them NaN.
+ * @param hi batch of floating point values, none of them NaN.
+ * @return the result of the clipping.
+ */
+template<class A, class T>
+batch<T, A> clip_propagate_nan(batch<T, A> const& x, batch<T, A> const& lo, batch<T, A> const& hi) {
+  return kernel::clip_propagate_nan<A>(x, lo, hi, A{});
+}
+
+/**
+ * @ingroup batch_data_transfer
+ *
+ * Packs the lanes of \c x selected by \c mask into the first lanes of
+ * the result, in order. The remaining lanes are set to zero.
+ * \code{.cpp}
+ * std::size_t j = 0;
+ * for(std::size_t i = 0; i < N; ++i)
+ *     if(mask[i])
+ *         res[j++] = x[i];
+ * for(; j < N; ++j)
+ *     res[j] = 0;
+ * \endcode
+ * @param x batch of integer or floating point values.
+ * @param mask batch of boolean values selecting the lanes to keep.
+ * @return the packed lanes.
+ */
+template<class T, class A>
+batch<T, A> compress(batch<T, A> const& x, batch_bool<T, A> const& mask) {
+  return kernel::compress<A>(x, mask, A{});
+}
+
+/**
+ * @ingroup batch_logical
+ *
+ * For each lane of \c x, computes the bit mask of the preceding lanes
+ * holding the same value. Equivalent to
+ * \code{.cpp}
+ * for(std::size_t i = 0; i < N; ++i) {
+ *     res[i] = 0;
+ *     for(std::size_t j = 0; j < i; ++j)
+ *         if(x[j] == x[i])
+ *             res[i] |= T(1) << j;
+ * }
+ * \endcode
+ * @param x batch of 32 or 64 bit integers.
+ * @return the bit masks of the lanes equal to each lane.
+ */
+template<class T, class A>
+batch<T, A> conflict(batch<T, A> const& x) {
+  static_assert(std::is_integral<T>::value && sizeof(T) >= 4, "conflict detection on 32 or 64 bit integers");
+  return kernel::conflict<A>(x, A{});
+}
+
 /**
  * @ingroup batch_complex
  *
@@ -432,6 +524,22 @@ batch<T, A> cosh(batch<T, A> const& x) {
   return kernel::cosh<A>(x, A{});
 }
 
+/**
+ * @ingroup batch_trigo
+ *
+ * Computes the cosine of pi times the batch \c x. The argument is reduced
+ * exactly to a multiple of 0.5 and a remainder, so that the accuracy does
+ * not depend on the magnitude of \c x, which it does for <tt>cos(pi * x)</tt>:
+ * the error stays below 2 ulp. The zeros of odd multiples of 0.5 are
+ * positive.
+ * @param x batch of floating point values.
+ * @return the cosine of pi times \c x.
+ */
+template<class T, class A>
+batch<T, A> cospi(batch<T, A> const& x) {
+  return kernel::cospi<A>(x, A{});
+}
+
 /**
  * @ingroup batch_arithmetic
  *
@@ -570,6 +678,78 @@ batch<T, A> fabs(batch<T, A> const& x) {
   return kernel::abs<A>(x, A{});
 }
 
+/**
+ * Faster and less accurate versions of some of the mathematical functions:
+ * they use polynomials of lower degree and skip the handling of special
+ * values, infinities and NaNs included. The maximum errors given are the
+ * ones measured against a higher precision reference, with and without fma.
+ */
+namespace fast {
+
+/**
+ * @ingroup batch_math
+ *
+ * Computes the cosine of the batch \c x. The argument is reduced in a
+ * single step, which keeps the error below 2.6 ulp for |x| < 6000 in single
+ * precision and below 2.4 ulp for |x| < 10^6 in double precision. The
+ * accuracy degrades beyond, and the result of an infinity or a NaN is
+ * unspecified.
+ * @param x batch of floating point values.
+ * @return an approximation of the cosine of \c x.
+ */
+template<class T, class A>
+batch<T, A> cos(batch<T, A> const& x) {
+  return kernel::cos_fast<A>(x, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Computes the natural exponential of the batch \c x, with an error below
+ * 3.1 ulp. Arguments are clamped to [-86.5, 88] in single precision and to
+ * [-707, 709] in double precision, so that the result is never an infinity
+ * nor a zero, and the result of a NaN is unspecified.
+ * @param x batch of floating point values.
+ * @return an approximation of the natural exponential of \c x.
+ */
+template<class T, class A>
+batch<T, A> exp(batch<T, A> const& x) {
+  return kernel::exp_fast<A>(x, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Computes the natural logarithm of the batch \c x, with an error below
+ * 1.3 ulp in single precision and 2.3 ulp in double precision. \c x must
+ * hold positive normal values: the results of denormals, zeros, negative
+ * values, infinities and NaNs are unspecified.
+ * @param x batch of floating point values.
+ * @return an approximation of the natural logarithm of \c x.
+ */
+template<class T, class A>
+batch<T, A> log(batch<T, A> const& x) {
+  return kernel::log_fast<A>(x, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Computes the sine of the batch \c x. The argument is reduced in a single
+ * step, which keeps the error below 2.6 ulp for |x| < 6000 in single
+ * precision and below 2.4 ulp for |x| < 10^6 in double precision. The
+ * accuracy degrades beyond, and the result of an infinity or a NaN is
+ * unspecified.
+ * @param x batch of floating point values.
+ * @return an approximation of the sine of \c x.
+ */
+template<class T, class A>
+batch<T, A> sin(batch<T, A> const& x) {
+  return kernel::sin_fast<A>(x, A{});
+}
+
+}
+
 /**
  * @ingroup batch_math
  *
@@ -615,28 +795,30 @@ batch<T, A> fma(batch<T, A> const& x, batch<T, A> const& y, batch<T, A> const& z
 /**
  * @ingroup batch_math
  *
- * Computes the larger values of the batches \c x and \c y.
+ * Computes the larger values of the batches \c x and \c y, a NaN operand
+ * being ignored. Same as max_ignore_nan.
  * @param x a batch of integer or floating point values.
  * @param y a batch of integer or floating point values.
  * @return a batch of the larger values.
  */
 template<class T, class A>
 batch<T, A> fmax(batch<T, A> const& x, batch<T, A> const& y) {
-  return kernel::max<A>(x, y, A{});
+  return kernel::max_ignore_nan<A>(x, y, A{});
 }
 
 
 /**
  * @ingroup batch_math
  *
- * Computes the smaller values of the batches \c x and \c y.
+ * Computes the smaller values of the batches \c x and \c y, a NaN operand
+ * being ignored. Same as min_ignore_nan.
  * @param x a batch of integer or floating point values.
  * @param y a batch of integer or floating point values.
- * @return a batch of the larger values.
+ * @return a batch of the smaller values.
  */
 template<class T, class A>
 batch<T, A> fmin(batch<T, A> const& x, batch<T, A> const& y) {
-  return kernel::min<A>(x, y, A{});
+  return kernel::min_ignore_nan<A>(x, y, A{});
 }
 
 /**
@@ -707,6 +889,25 @@ batch<T, A> frexp(const batch<T, A>& x, batch<as_integer_t<T>, A>& y) {
   return kernel::frexp<A>(x, y, A{});
 }
 
+/**
+ * @ingroup batch_data_transfer
+ *
+ * Loads the values of \c src at the offsets held by \c index.
+ * Equivalent to
+ * \code{.cpp}
+ * for(std::size_t i = 0; i < N; ++i)
+ *     res[i] = src[index[i]];
+ * \endcode
+ * @param src memory the values are read from.
+ * @param index batch of non-negative offsets, of the width of \c T.
+ * @return the gathered values.
+ */
+template<class T, class A, class U>
+batch<T, A> gather(T const* src, batch<U, A> const& index) {
+  static_assert(std::is_integral<U>::value && sizeof(U) == sizeof(T), "offsets are integers of the width of the values");
+  return kernel::gather<A>(src, index, A{});
+}
+
 /**
  * @ingroup batch_logical
  *
@@ -801,6 +1002,20 @@ real_batch_type_t<batch<T, A>> imag(batch<T, A> const& x) {
   return kernel::imag<A>(x, A{});
 }
 
+/**
+ * @ingroup batch_reducers
+ *
+ * Prefix sum of the scalars of the batch \c x: lane \c i of the result
+ * holds the sum of the lanes 0 to \c i of \c x. It is computed in
+ * log2(N) steps, each one adding the batch slid by a power of two lanes.
+ * @param x batch of integer or floating point values.
+ * @return the inclusive prefix sum of \c x.
+ */
+template<class T, class A>
+batch<T, A> inclusive_scan(batch<T, A> const& x) {
+  return kernel::inclusive_scan<A>(x, A{});
+}
+
 /**
  * @ingroup batch_constant
  *
@@ -1100,6 +1315,50 @@ batch<T, A> max(batch<T, A> const& x, batch<T, A> const& y) {
   return kernel::max<A>(x, y, A{});
 }
 
+/**
+ * @ingroup batch_math
+ *
+ * Computes the larger values of the batches \c x and \c y with the cheapest
+ * instruction of the architecture. When either value is NaN, the result is
+ * \c y on x86 and NaN on arm.
+ * @param x a batch of integer or floating point values.
+ * @param y a batch of integer or floating point values.
+ * @return a batch of the larger values.
+ */
+template<class T, class A>
+batch<T, A> max_fast(batch<T, A> const& x, batch<T, A> const& y) {
+  return kernel::max_fast<A>(x, y, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Computes the larger values of the batches \c x and \c y, a NaN value
+ * being ignored: the result is NaN only when both values are NaN, as for
+ * <tt>std::fmax</tt>.
+ * @param x a batch of integer or floating point values.
+ * @param y a batch of integer or floating point values.
+ * @return a batch of the larger values.
+ */
+template<class T, class A>
+batch<T, A> max_ignore_nan(batch<T, A> const& x, batch<T, A> const& y) {
+  return kernel::max_ignore_nan<A>(x, y, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Computes the larger values of the batches \c x and \c y, the result
+ * being NaN when either value is NaN.
+ * @param x a batch of integer or floating point values.
+ * @param y a batch of integer or floating point values.
+ * @return a batch of the larger values.
+ */
+template<class T, class A>
+batch<T, A> max_propagate_nan(batch<T, A> const& x, batch<T, A> const& y) {
+  return kernel::max_propagate_nan<A>(x, y, A{});
+}
+
 /**
  * @ingroup batch_math
  *
@@ -1113,6 +1372,50 @@ batch<T, A> min(batch<T, A> const& x, batch<T, A> const& y) {
   return kernel::min<A>(x, y, A{});
 }
 
+/**
+ * @ingroup batch_math
+ *
+ * Computes the smaller values of the batches \c x and \c y with the cheapest
+ * instruction of the architecture. When either value is NaN, the result is
+ * \c y on x86 and NaN on arm.
+ * @param x a batch of integer or floating point values.
+ * @param y a batch of integer or floating point values.
+ * @return a batch of the smaller values.
+ */
+template<class T, class A>
+batch<T, A> min_fast(batch<T, A> const& x, batch<T, A> const& y) {
+  return kernel::min_fast<A>(x, y, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Computes the smaller values of the batches \c x and \c y, a NaN value
+ * being ignored: the result is NaN only when both values are NaN, as for
+ * <tt>std::fmin</tt>.
+ * @param x a batch of integer or floating point values.
+ * @param y a batch of integer or floating point values.
+ * @return a batch of the smaller values.
+ */
+template<class T, class A>
+batch<T, A> min_ignore_nan(batch<T, A> const& x, batch<T, A> const& y) {
+  return kernel::min_ignore_nan<A>(x, y, A{});
+}
+
+/**
+ * @ingroup batch_math
+ *
+ * Computes the smaller values of the batches \c x and \c y, the result
+ * being NaN when either value is NaN.
+ * @param x a batch of integer or floating point values.
+ * @param y a batch of integer or floating point values.
+ * @return a batch of the smaller values.
+ */
+template<class T, class A>
+batch<T, A> min_propagate_nan(batch<T, A> const& x, batch<T, A> const& y) {
+  return kernel::min_propagate_nan<A>(x, y, A{});
+}
+
 /**
  * @ingroup batch_constant
  *
@@ -1152,6 +1455,21 @@ auto mul(T const& x, Tp const& y) -> decltype(x * y){
   return x * y;
 }
 
+/**
+ * @ingroup batch_conversion
+ *
+ * Converts the lanes of \c lo followed by the lanes of \c hi to the type
+ * half as wide, the opposite of widen. Integers are truncated to their
+ * low bits, doubles are rounded to float.
+ * @param lo batch of integer or double precision values.
+ * @param hi batch of integer or double precision values.
+ * @return a batch holding twice as many lanes as \c lo.
+ */
+template<class T, class A>
+batch<narrow_type_t<T>, A> narrow(batch<T, A> const& lo, batch<T, A> const& hi) {
+  return kernel::narrow<A>(lo, hi, A{});
+}
+
 /**
  * @ingroup batch_rounding
  *
@@ -1281,6 +1599,24 @@ real_batch_type_t<batch<T, A>> real(batch<T, A> const& x) {
   return kernel::real<A>(x, A{});
 }
 
+/**
+ * @ingroup batch_arithmetic
+ *
+ * Approximates the reciprocal of the batch \c x: the estimate of the
+ * architecture, within 2^-8 of the result on NEON, 1.5 * 2^-12 for floats
+ * on SSE and AVX, 2^-14 on AVX512 and 5.1% elsewhere, is refined by
+ * \c Steps Newton-Raphson iterations, each squaring the relative error.
+ * The results for zeros, infinities, NaN and for values whose magnitude
+ * or reciprocal is subnormal are unspecified.
+ * @tparam Steps the number of Newton-Raphson iterations.
+ * @param x batch of floating point values.
+ * @return the approximated reciprocal of \c x.
+ */
+template<std::size_t Steps, class T, class A>
+batch<T, A> reciprocal(batch<T, A> const& x) {
+  return kernel::reciprocal<A>(x, std::integral_constant<std::size_t, Steps>(), A{});
+}
+
 /**
  * @ingroup batch_math
  *
@@ -1321,6 +1657,24 @@ batch<T, A> round(batch<T, A> const& x) {
   return kernel::round<A>(x, A{});
 }
 
+/**
+ * @ingroup batch_math
+ *
+ * Approximates the reciprocal of the square root of the batch \c x: the
+ * estimate of the architecture, within 2^-8 of the result on NEON,
+ * 1.5 * 2^-12 for floats on SSE and AVX, 2^-14 on AVX512 and 3.5%
+ * elsewhere, is refined by \c Steps Newton-Raphson iterations, each
+ * squaring the relative error. The results for zeros, infinities,
+ * negative, NaN and subnormal values are unspecified.
+ * @tparam Steps the number of Newton-Raphson iterations.
+ * @param x batch of positive floating point values.
+ * @return the approximated reciprocal square root of \c x.
+ */
+template<std::size_t Steps, class T, class A>
+batch<T, A> rsqrt(batch<T, A> const& x) {
+  return kernel::rsqrt<A>(x, std::integral_constant<std::size_t, Steps>(), A{});
+}
+
 /**
  * @ingroup batch_arithmetic
  *
@@ -1338,6 +1692,25 @@ auto sadd(T const& x, Tp const& y) -> decltype(x + y) {
   return kernel::sadd<A>(B(x), B(y), A{});
 }
 
+/**
+ * @ingroup batch_data_transfer
+ *
+ * Stores the values of \c x at the offsets held by \c index. When
+ * several lanes share an offset, the last of them is stored. Equivalent to
+ * \code{.cpp}
+ * for(std::size_t i = 0; i < N; ++i)
+ *     dst[index[i]] = x[i];
+ * \endcode
+ * @param x batch of values to store.
+ * @param dst memory the values are written to.
+ * @param index batch of non-negative offsets, of the width of \c T.
+ */
+template<class T, class A, class U>
+void scatter(batch<T, A> const& x, T* dst, batch<U, A> const& index) {
+  static_assert(std::is_integral<U>::value && sizeof(U) == sizeof(T), "offsets are integers of the width of the values");
+  kernel::scatter<A>(x, dst, index, A{});
+}
+
 /**
  * @ingroup batch_miscellaneous
  *
@@ -1443,6 +1816,56 @@ batch<T, A> sinh(batch<T, A> const& x) {
   return kernel::sinh<A>(x, A{});
 }
 
+/**
+ * @ingroup batch_trigo
+ *
+ * Computes the sine of pi times the batch \c x. The argument is reduced
+ * exactly to a multiple of 0.5 and a remainder, so that the accuracy does
+ * not depend on the magnitude of \c x, which it does for <tt>sin(pi * x)</tt>:
+ * the error stays below 2 ulp. The zeros of integers have the sign of \c x.
+ * @param x batch of floating point values.
+ * @return the sine of pi times \c x.
+ */
+template<class T, class A>
+batch<T, A> sinpi(batch<T, A> const& x) {
+  return kernel::sinpi<A>(x, A{});
+}
+
+/**
+ * @ingroup batch_data_transfer
+ *
+ * Slides the whole batch \c x by \c N bytes towards its last lane,
+ * shifting in zeros. Unlike bitwise_lshift, bytes move across the
+ * scalars. Equivalent to
+ * \code{.cpp}
+ * for(std::size_t i = 0; i < sizeof(x); ++i)
+ *     res_bytes[i] = i < N ? 0 : x_bytes[i - N];
+ * \endcode
+ * @param x batch to slide.
+ * @return the slid batch.
+ */
+template<size_t N, class T, class A>
+batch<T, A> slide_left(batch<T, A> const& x) {
+  return bitwise_cast<batch<T, A>>(kernel::slide_left<N, A>(bitwise_cast<batch<uint8_t, A>>(x), A{}));
+}
+
+/**
+ * @ingroup batch_data_transfer
+ *
+ * Slides the whole batch \c x by \c N bytes towards its first lane,
+ * shifting in zeros. Equivalent to
+ * \code{.cpp}
+ * for(std::size_t i = 0; i < sizeof(x); ++i)
+ *     res_bytes[i] = i + N < sizeof(x) ? x_bytes[i + N] : 0;
+ * \endcode
+ * @param x batch to slide.
+ * @return the slid batch.
+ */
+template<size_t N, class T, class A>
+batch<T, A> slide_right(batch<T, A> const& x) {
+  return bitwise_cast<batch<T, A>>(kernel::slide_right<N, A>(bitwise_cast<batch<uint8_t, A>>(x), A{}));
+}
+
 /**
  * @ingroup batch_trigo
  *
@@ -1456,6 +1879,19 @@ std::pair<batch<T, A>, batch<T, A>> sincos(batch<T, A> const& x) {
   return kernel::sincos<A>(x, A{});
 }
 
+/**
+ * @ingroup batch_trigo
+ *
+ * Computes the sine and the cosine of pi times the batch \c x, as
+ * \c sinpi and \c cospi do, sharing the reduction of the argument.
+ * @param x batch of floating point values.
+ * @return a pair containing the sine then the cosine of pi times \c x.
+ */
+template<class T, class A>
+std::pair<batch<T, A>, batch<T, A>> sincospi(batch<T, A> const& x) {
+  return kernel::sincospi<A>(x, A{});
+}
+
 /**
  * @ingroup batch_math
  *
@@ -1622,6 +2058,22 @@ auto sub(T const& x, Tp const& y) -> decltype(x - y){
   return x - y;
 }
 
+/**
+ * @ingroup batch_data_transfer
+ *
+ * Rearranges the lanes of \c x according to the compile-time indices of
+ * \c mask: lane \c i of the result is lane \c mask[i] of \c x.
+ * @param x batch of integer or floating point values.
+ * @param mask constant batch of unsigned integers of the same width as the
+ * elements of \c x, each lower than the size of the batch.
+ * @return the rearranged batch.
+ */
+template<class T, class A, class Vt, Vt... Values>
+batch<T, A> swizzle(batch<T, A> const& x, batch_constant<batch<Vt, A>, Values...> mask) {
+  static_assert(sizeof(T) == sizeof(Vt), "consistent mask size");
+  return kernel::swizzle<A>(x, mask, A{});
+}
+
 /**
  * @ingroup batch_trigo
  *
@@ -1646,6 +2098,21 @@ batch<T, A> tanh(batch<T, A> const& x) {
   return kernel::tanh<A>(x, A{});
 }
 
+/**
+ * @ingroup batch_trigo
+ *
+ * Computes the tangent of pi times the batch \c x, with the exact
+ * reduction of \c sinpi and an error below 3 ulp. Odd multiples of 0.5 give infinities, positive
+ * when the integer part of |x| is even, and the zeros of integers are
+ * negative when it is odd, the signs being flipped for negative \c x.
+ * @param x batch of floating point values.
+ * @return the tangent of pi times \c x.
+ */
+template<class T, class A>
+batch<T, A> tanpi(batch<T, A> const& x) {
+  return kernel::tanpi<A>(x, A{});
+}
+
 /**
  * @ingroup batch_math_extra
  *
@@ -1695,6 +2162,21 @@ batch<T, A> trunc(batch<T, A> const& x) {
   return kernel::trunc<A>(x, A{});
 }
 
+/**
+ * @ingroup batch_conversion
+ *
+ * Converts the lanes of \c x to the type twice as wide, sign-extending
+ * signed integers, zero-extending unsigned ones and promoting float to
+ * double.
+ * @param x batch of integer (up to 32 bits) or floating point values.
+ * @return the conversion of the low half of \c x followed by the one of
+ * its high half.
+ */
+template<class T, class A>
+std::array<batch<widen_type_t<T>, A>, 2> widen(batch<T, A> const& x) {
+  return kernel::widen<A>(x, A{});
+}
+
 /**
  * @ingroup batch_data_transfer
  *
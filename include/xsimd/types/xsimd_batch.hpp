@@ -14,6 +14,7 @@
 
 #include <cassert>
 #include <complex>
+#include <cstdint>
 
 #include "../config/xsimd_arch.hpp"
 #include "../memory/xsimd_alignment.hpp"
@@ -73,6 +74,11 @@ namespace xsimd
         static XSIMD_NO_DISCARD batch load(U const* mem, unaligned_mode);
 
         T get(std::size_t i) const;
+        template<std::size_t I>
+        T get() const;
+        T first() const;
+        template<std::size_t I>
+        batch& set(T val);
 
         // comparison operators
         batch_bool_type operator==(batch const& other) const;
@@ -226,6 +232,10 @@ namespace xsimd
         static XSIMD_NO_DISCARD batch_bool load_unaligned(bool const * mem);
 
         bool get(std::size_t i) const;
+        template<std::size_t I>
+        bool get() const;
+        bool first() const;
+        uint64_t mask() const;
 
         // comparison operators
         batch_bool operator==(batch_bool const& other) const;
@@ -551,12 +561,58 @@ namespace xsimd
         return load_unaligned(mem);
     }
 
+    /**
+     * Retrieves the \c i-th lane of the batch. Architectures providing a
+     * variable permute select the lane in-register, other ones go through
+     * memory. Prefer get<I>() when the index is known at compile time.
+     * @param i the index of the lane, must be lower than \c size.
+     * @return the value of the \c i-th lane.
+     */
     template <class T, class A>
     T batch<T, A>::get(std::size_t i) const
     {
-        alignas(A::alignment()) T buffer[size];
-        store_aligned(&buffer[0]);
-        return buffer[i];
+        assert(i < size && "index in bounds");
+        return kernel::get<A>(*this, i, A{});
+    }
+
+    /**
+     * Retrieves the \c I-th lane of the batch without a memory round-trip
+     * wherever the architecture provides a lane extraction instruction.
+     * @tparam I the index of the lane, must be lower than \c size.
+     * @return the value of the \c I-th lane.
+     */
+    template <class T, class A>
+    template <std::size_t I>
+    T batch<T, A>::get() const
+    {
+        static_assert(I < size, "index in bounds");
+        return kernel::get<A>(*this, index<I>{}, A{});
+    }
+
+    /**
+     * Retrieves the first lane of the batch. This is the cheapest lane
+     * to access on every architecture.
+     * @return the value of the first lane.
+     */
+    template <class T, class A>
+    T batch<T, A>::first() const
+    {
+        return get<0>();
+    }
+
+    /**
+     * Replaces the \c I-th lane of the batch by \c val, leaving the other
+     * lanes untouched.
+     * @tparam I the index of the lane, must be lower than \c size.
+     * @param val the new value of the lane.
+     * @return a reference to \c *this.
+     */
+    template <class T, class A>
+    template <std::size_t I>
+    batch<T, A>& batch<T, A>::set(T val)
+    {
+        static_assert(I < size, "index in bounds");
+        return *this = kernel::insert<A>(*this, val, index<I>{}, A{});
     }
 
     /******************************
@@ -809,9 +865,33 @@ namespace xsimd
     template<class T, class A>
     bool batch_bool<T, A>::get(std::size_t i) const
     {
-        alignas(A::alignment()) bool buffer[size];
-        store_aligned(&buffer[0]);
-        return buffer[i];
+        assert(i < size && "index in bounds");
+        return kernel::get<A>(*this, i, A{});
+    }
+
+    template<class T, class A>
+    template<std::size_t I>
+    bool batch_bool<T, A>::get() const
+    {
+        static_assert(I < size, "index in bounds");
+        return kernel::get<A>(*this, index<I>{}, A{});
+    }
+
+    template<class T, class A>
+    bool batch_bool<T, A>::first() const
+    {
+        return get<0>();
+    }
+
+    /**
+     * Packs the lanes of the batch into an integer, bit \c i being set if
+     * and only if the \c i-th lane is true. The position of the first true
+     * lane is then given by a bit scan of the result.
+     */
+    template<class T, class A>
+    uint64_t batch_bool<T, A>::mask() const
+    {
+        return kernel::mask<A>(*this, A{});
     }
 
     /***********************************
@@ -70,6 +70,17 @@ namespace xsimd
         template<class T>
         struct convert {};
     }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Compile-time lane index, used to select the lane to extract or insert.
+     */
+    template<std::size_t I>
+    struct index
+    {
+        static constexpr std::size_t value = I;
+    };
 }
 
 #endif
@@ -157,6 +157,122 @@ namespace xsimd
     template <class T>
     using as_float_t = typename as_float<T>::type;
 
+    /**************
+     * widen_type *
+     **************/
+
+    template <class T>
+    struct widen_type;
+
+    template <>
+    struct widen_type<int8_t>
+    {
+        using type = int16_t;
+    };
+
+    template <>
+    struct widen_type<uint8_t>
+    {
+        using type = uint16_t;
+    };
+
+    template <>
+    struct widen_type<int16_t>
+    {
+        using type = int32_t;
+    };
+
+    template <>
+    struct widen_type<uint16_t>
+    {
+        using type = uint32_t;
+    };
+
+    template <>
+    struct widen_type<int32_t>
+    {
+        using type = int64_t;
+    };
+
+    template <>
+    struct widen_type<uint32_t>
+    {
+        using type = uint64_t;
+    };
+
+    template <>
+    struct widen_type<float>
+    {
+        using type = double;
+    };
+
+    template <class T, class A>
+    struct widen_type<batch<T, A>>
+    {
+        using type = batch<typename widen_type<T>::type, A>;
+    };
+
+    template <class T>
+    using widen_type_t = typename widen_type<T>::type;
+
+    /***************
+     * narrow_type *
+     ***************/
+
+    template <class T>
+    struct narrow_type;
+
+    template <>
+    struct narrow_type<int16_t>
+    {
+        using type = int8_t;
+    };
+
+    template <>
+    struct narrow_type<uint16_t>
+    {
+        using type = uint8_t;
+    };
+
+    template <>
+    struct narrow_type<int32_t>
+    {
+        using type = int16_t;
+    };
+
+    template <>
+    struct narrow_type<uint32_t>
+    {
+        using type = uint16_t;
+    };
+
+    template <>
+    struct narrow_type<int64_t>
+    {
+        using type = int32_t;
+    };
+
+    template <>
+    struct narrow_type<uint64_t>
+    {
+        using type = uint32_t;
+    };
+
+    template <>
+    struct narrow_type<double>
+    {
+        using type = float;
+    };
+
+    template <class T, class A>
+    struct narrow_type<batch<T, A>>
+    {
+        using type = batch<typename narrow_type<T>::type, A>;
+    };
+
+    template <class T>
+    using narrow_type_t = typename narrow_type<T>::type;
+
     /**************
      * as_logical *
      **************/
@@ -11,6 +11,9 @@
 
 #include "test_utils.hpp"
 #include "xsimd/stl/algorithms.hpp"
+#include <cstring>
+#include <cstdint>
+#include <deque>
 #include <numeric>
 
 struct binary_functor
@@ -137,6 +140,46 @@ public:
             return a * b;
         }
     };
+
+    struct abs_diff
+    {
+        template <class T>
+        T operator()(const T& a, const T& b) const
+        {
+            using std::abs;
+            using xsimd::abs;
+            return abs(a - b);
+        }
+    };
+
+    struct maximum
+    {
+        template <class T>
+        T operator()(const T& a, const T& b) const
+        {
+            using std::max;
+            using xsimd::max;
+            return max(a, b);
+        }
+    };
+
+    struct add
+    {
+        template <class T>
+        T operator()(const T& a, const T& b) const
+        {
+            return a + b;
+        }
+    };
+
+    struct square
+    {
+        template <class T>
+        T operator()(const T& a) const
+        {
+            return a * a;
+        }
+    };
 };
 
 TEST_F(xsimd_reduce, unaligned_begin_unaligned_end)
@@ -233,6 +276,1226 @@ TEST_F(xsimd_reduce, using_custom_binary_function)
     }
 }
 
+TEST_F(xsimd_reduce, multiple_accumulators)
+{
+    using batch_type = xsimd::batch<test_value_type>;
+    std::size_t const n = 13 * batch_type::size + 3;
+    aligned_vec_t values(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        values[i] = test_value_type(i % 7);
+    }
+
+    // every count of full batches from zero to a few accumulator blocks
+    for (std::size_t offset = 0; offset < 2; ++offset)
+    {
+        for (std::size_t count = 0; count + offset <= n; ++count)
+        {
+            auto const begin = values.begin() + offset;
+            auto const end = begin + count;
+            test_value_type expected = std::accumulate(begin, end, init);
+            EXPECT_EQ(expected, (xsimd::reduce<xsimd::default_arch, 1>(begin, end, init))) << count;
+            EXPECT_EQ(expected, (xsimd::reduce<xsimd::default_arch, 3>(begin, end, init))) << count;
+            EXPECT_EQ(expected, (xsimd::reduce<xsimd::default_arch, 4>(begin, end, init))) << count;
+            EXPECT_EQ(expected, (xsimd::reduce<xsimd::default_arch, 8>(begin, end, init))) << count;
+        }
+    }
+}
+
+TEST(algorithms, dispatched)
+{
+    std::size_t const n = 93;
+    std::vector<test_value_type> a(n), b(n), c(n), expected(n);
+    std::iota(a.begin(), a.end(), test_value_type(0));
+    std::iota(b.begin(), b.end(), test_value_type(3));
+
+    std::transform(a.begin(), a.end(), expected.begin(), unary_functor{});
+    xsimd::dispatched::transform(a.begin(), a.end(), c.begin(), unary_functor{});
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), c.begin()));
+
+    std::transform(a.begin(), a.end(), b.begin(), expected.begin(), binary_functor{});
+    xsimd::dispatched::transform(a.begin(), a.end(), b.begin(), c.begin(), binary_functor{});
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), c.begin()));
+
+    EXPECT_EQ(std::accumulate(a.begin(), a.end(), test_value_type(1)), xsimd::dispatched::reduce(a.begin(), a.end(), test_value_type(1)));
+    EXPECT_EQ(std::accumulate(a.begin() + 1, a.end(), test_value_type(1), binary_functor{}),
+              xsimd::dispatched::reduce(a.begin() + 1, a.end(), test_value_type(1), binary_functor{}));
+
+    using single_arch = xsimd::arch_list<xsimd::default_arch>;
+    EXPECT_EQ(std::accumulate(a.begin(), a.end(), test_value_type(1)), xsimd::dispatched::reduce<single_arch>(a.begin(), a.end(), test_value_type(1)));
+}
+
+TEST(algorithms, parallel_transform)
+{
+    // large enough to be split across several chunks
+    std::size_t const n = 100003;
+    std::vector<test_value_type, test_allocator_type<test_value_type>> a(n), b(n), ca(n);
+    std::iota(a.begin(), a.end(), test_value_type(0));
+    std::iota(b.begin(), b.end(), test_value_type(1));
+    std::vector<test_value_type> expected(n), c(n);
+
+    for (std::size_t threads : {0, 1, 3, 8})
+    {
+        xsimd::parallel_policy policy(threads);
+
+        std::transform(a.begin() + 1, a.end(), expected.begin(), unary_functor{});
+        xsimd::transform(policy, a.begin() + 1, a.end(), c.begin(), unary_functor{});
+        EXPECT_TRUE(std::equal(c.begin(), c.end() - 1, expected.begin())) << "unary, " << threads << " threads";
+
+        std::transform(a.begin(), a.end(), b.begin(), expected.begin(), binary_functor{});
+        xsimd::transform(policy, a.begin(), a.end(), b.begin(), ca.begin(), binary_functor{});
+        EXPECT_TRUE(std::equal(ca.begin(), ca.end(), expected.begin())) << "binary, " << threads << " threads";
+    }
+}
+
+TEST_F(xsimd_reduce, inner_product)
+{
+    using batch_type = xsimd::batch<test_value_type>;
+    std::size_t const n = 13 * batch_type::size + 3;
+    aligned_vec_t x(n), y(n + 1);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = test_value_type(i % 7);
+        y[i] = test_value_type(3) - test_value_type(i % 5);
+    }
+    y[n] = 1;
+
+    // the values are small integers: every summation order is exact
+    for (std::size_t offset_x = 0; offset_x < 2; ++offset_x)
+    {
+        for (std::size_t offset_y = 0; offset_y < 2; ++offset_y)
+        {
+            for (std::size_t count = 0; count + offset_x <= n; ++count)
+            {
+                auto const begin = x.begin() + offset_x;
+                auto const end = begin + count;
+                auto const other = y.begin() + offset_y;
+                test_value_type expected = std::inner_product(begin, end, other, init);
+                EXPECT_EQ(expected, xsimd::inner_product(begin, end, other, init)) << count;
+                EXPECT_EQ(expected, xsimd::transform_reduce(begin, end, other, init)) << count;
+                EXPECT_EQ(expected, (xsimd::inner_product<xsimd::default_arch, 3>(begin, end, other, init))) << count;
+            }
+        }
+    }
+
+    std::vector<int32_t> a(100), b(100);
+    std::iota(a.begin(), a.end(), -50);
+    std::iota(b.begin(), b.end(), 7);
+    EXPECT_EQ(std::inner_product(a.begin(), a.end(), b.begin(), 3), xsimd::inner_product(a.begin(), a.end(), b.begin(), 3));
+}
+
+TEST_F(xsimd_reduce, transform_reduce)
+{
+    std::size_t const n = 7 * xsimd::batch<test_value_type>::size + 5;
+    aligned_vec_t x(n), y(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = test_value_type(i % 11);
+        y[i] = test_value_type((i * 3) % 13);
+    }
+    x[n / 2] = 50;
+
+    for (std::size_t offset = 0; offset < 3; ++offset)
+    {
+        auto const begin = x.begin() + offset;
+        test_value_type expected = 0;
+        test_value_type expected_squares = init;
+        for (std::size_t i = offset; i < n; ++i)
+        {
+            expected = std::max(expected, std::abs(x[i] - y[i]));
+            expected_squares += x[i] * x[i];
+        }
+        EXPECT_EQ(expected, xsimd::transform_reduce(begin, x.end(), y.begin() + offset, test_value_type(0), maximum{}, abs_diff{}));
+        EXPECT_EQ(expected, xsimd::inner_product(begin, x.end(), y.begin() + offset, test_value_type(0), maximum{}, abs_diff{}));
+        EXPECT_EQ(expected_squares, xsimd::transform_reduce(begin, x.end(), init, add{}, square{}));
+    }
+}
+
+TEST_F(xsimd_reduce, parallel)
+{
+    std::size_t const n = 100003;
+    aligned_vec_t large(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        large[i] = test_value_type(i % 17);
+    }
+
+    for (std::size_t threads : {0, 1, 3, 8})
+    {
+        xsimd::parallel_policy policy(threads);
+        EXPECT_EQ(std::accumulate(large.begin() + 1, large.end(), init), xsimd::reduce(policy, large.begin() + 1, large.end(), init)) << threads << " threads";
+        EXPECT_EQ(std::accumulate(vec.begin(), vec.end(), init), xsimd::reduce(policy, vec.begin(), vec.end(), init)) << threads << " threads";
+        EXPECT_EQ(init, xsimd::reduce(policy, vec.begin(), vec.begin(), init)) << threads << " threads";
+    }
+    EXPECT_EQ(std::accumulate(large.begin(), large.end(), init), xsimd::reduce(xsimd::par, large.begin(), large.end(), init));
+}
+
+struct greater_than_five
+{
+    template <class T>
+    auto operator()(const T& a) const -> decltype(a > T(5))
+    {
+        return a > T(5);
+    }
+};
+
+template <class T>
+void check_find_count()
+{
+    using vector_type = std::vector<T, test_allocator_type<T>>;
+    std::size_t const n = 9 * xsimd::batch<T>::size + 3;
+    vector_type values(n, T(1));
+
+    for (std::size_t offset = 0; offset < 2; ++offset)
+    {
+        auto const begin = values.begin() + offset;
+        EXPECT_EQ(xsimd::find(begin, values.end(), T(2)), values.end());
+        EXPECT_EQ(xsimd::find(begin, begin, T(1)), begin);
+        EXPECT_EQ(xsimd::count(begin, values.end(), T(1)), std::count(begin, values.end(), T(1)));
+        EXPECT_TRUE(xsimd::none_of(begin, values.end(), greater_than_five{}));
+        EXPECT_FALSE(xsimd::any_of(begin, values.end(), greater_than_five{}));
+        EXPECT_FALSE(xsimd::all_of(begin, values.end(), greater_than_five{}));
+        EXPECT_TRUE(xsimd::all_of(begin, begin, greater_than_five{}));
+
+        // a single match at each position, then a match everywhere after it
+        for (std::size_t i = offset; i < n; ++i)
+        {
+            values[i] = T(7);
+            EXPECT_EQ(xsimd::find(begin, values.end(), T(7)), values.begin() + i) << i;
+            EXPECT_EQ(xsimd::find_if(begin, values.end(), greater_than_five{}), values.begin() + i) << i;
+            EXPECT_TRUE(xsimd::any_of(begin, values.end(), greater_than_five{})) << i;
+            EXPECT_EQ(xsimd::count(begin, values.end(), T(7)), 1) << i;
+            values[i] = T(1);
+        }
+        for (std::size_t i = n; i-- > offset;)
+        {
+            values[i] = T(7);
+            EXPECT_EQ(xsimd::find(begin, values.end(), T(7)), values.begin() + i) << i;
+            EXPECT_EQ(xsimd::count_if(begin, values.end(), greater_than_five{}), std::count(begin, values.end(), T(7))) << i;
+            EXPECT_EQ(xsimd::all_of(begin, values.end(), greater_than_five{}), i == offset) << i;
+        }
+        std::fill(values.begin(), values.end(), T(1));
+    }
+}
+
+TEST(algorithms, find_count)
+{
+    check_find_count<test_value_type>();
+    check_find_count<float>();
+    check_find_count<int8_t>();
+    check_find_count<uint16_t>();
+    check_find_count<int32_t>();
+    check_find_count<uint64_t>();
+}
+
+TEST(algorithms, find_value_conversion)
+{
+    std::vector<uint8_t, test_allocator_type<uint8_t>> bytes(100, uint8_t(44));
+    bytes[50] = 255;
+    // 300 and -1 do not compare equal to any uint8_t
+    EXPECT_EQ(xsimd::find(bytes.begin(), bytes.end(), 300), bytes.end());
+    EXPECT_EQ(xsimd::count(bytes.begin(), bytes.end(), -1), 0);
+    EXPECT_EQ(xsimd::find(bytes.begin(), bytes.end(), 255), bytes.begin() + 50);
+
+    std::vector<float, test_allocator_type<float>> floats(100, 0.1f);
+    EXPECT_EQ(xsimd::find(floats.begin(), floats.end(), 0.1), floats.end());
+    EXPECT_EQ(xsimd::count(floats.begin(), floats.end(), 0.1f), 100);
+}
+
+template <class T>
+void check_minmax_element(std::size_t n)
+{
+    using vector_type = std::vector<T, test_allocator_type<T>>;
+    vector_type values(n);
+    // few distinct values, so that ties are frequent
+    std::size_t state = 12345;
+    for (auto& v : values)
+    {
+        state = state * 1103515245 + 12345;
+        v = T((state >> 16) % 23);
+    }
+
+    for (std::size_t offset = 0; offset < 3 && offset < n; ++offset)
+    {
+        auto const begin = values.begin() + offset;
+        EXPECT_EQ(xsimd::min_element(begin, values.end()), std::min_element(begin, values.end())) << n;
+        EXPECT_EQ(xsimd::max_element(begin, values.end()), std::max_element(begin, values.end())) << n;
+        EXPECT_EQ(xsimd::minmax_element(begin, values.end()), std::minmax_element(begin, values.end())) << n;
+        EXPECT_EQ(xsimd::min_element(begin, values.end(), xsimd::nan_policy::fast), std::min_element(begin, values.end())) << n;
+        EXPECT_EQ(xsimd::minmax_element(begin, values.end(), xsimd::nan_policy::propagate), std::minmax_element(begin, values.end())) << n;
+    }
+}
+
+TEST(algorithms, minmax_element)
+{
+    for (std::size_t n : {std::size_t(1), std::size_t(5), std::size_t(17), std::size_t(64), std::size_t(1001), std::size_t(20000)})
+    {
+        check_minmax_element<test_value_type>(n);
+        check_minmax_element<float>(n);
+        check_minmax_element<int8_t>(n);
+        check_minmax_element<uint8_t>(n);
+        check_minmax_element<int16_t>(n);
+        check_minmax_element<int32_t>(n);
+        check_minmax_element<uint64_t>(n);
+    }
+
+    std::vector<float> empty;
+    EXPECT_EQ(xsimd::min_element(empty.begin(), empty.end()), empty.end());
+    EXPECT_EQ(xsimd::minmax_element(empty.begin(), empty.end()), std::make_pair(empty.begin(), empty.begin()));
+}
+
+TEST(algorithms, minmax_element_nan)
+{
+    using vector_type = std::vector<test_value_type, test_allocator_type<test_value_type>>;
+    test_value_type const nan = std::numeric_limits<test_value_type>::quiet_NaN();
+    std::size_t const n = 103;
+    vector_type values(n);
+    std::iota(values.begin(), values.end(), test_value_type(0));
+    std::reverse(values.begin(), values.begin() + 50);
+    values[0] = nan;
+    values[60] = nan;
+
+    auto const begin = values.begin();
+    EXPECT_EQ(xsimd::min_element(begin, values.end()), begin + 49);
+    EXPECT_EQ(xsimd::max_element(begin, values.end()), begin + 102);
+    EXPECT_EQ(xsimd::minmax_element(begin, values.end()), std::make_pair(begin + 49, begin + 102));
+    EXPECT_EQ(xsimd::min_element(begin, values.end(), xsimd::nan_policy::propagate), begin);
+    EXPECT_EQ(xsimd::max_element(begin + 1, values.end(), xsimd::nan_policy::propagate), begin + 60);
+    EXPECT_EQ(xsimd::minmax_element(begin + 1, values.end(), xsimd::nan_policy::propagate), std::make_pair(begin + 60, begin + 60));
+
+    std::fill(values.begin(), values.end(), nan);
+    EXPECT_EQ(xsimd::min_element(begin + 1, values.end()), begin + 1);
+    EXPECT_EQ(xsimd::minmax_element(begin + 1, values.end()), std::make_pair(begin + 1, begin + 1));
+}
+
+struct below
+{
+    int threshold;
+
+    template <class T>
+    auto operator()(const T& a) const -> decltype(a < T(0))
+    {
+        return a < T(threshold);
+    }
+};
+
+template <class T>
+void check_stream_compaction()
+{
+    using vector_type = std::vector<T, test_allocator_type<T>>;
+    vector_type values(203);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = T((i * 37) % 100);
+    }
+
+    // selectivities from none to all, unaligned starts and sizes
+    for (int threshold : { 0, 1, 10, 50, 90, 100 })
+    {
+        below pred { threshold };
+        for (std::size_t offset = 0; offset < 3; ++offset)
+        {
+            auto begin = values.begin() + offset;
+
+            vector_type expected(values.size()), res(values.size());
+            auto expected_end = std::copy_if(begin, values.end(), expected.begin(), pred);
+            auto res_end = xsimd::copy_if(begin, values.end(), res.begin() + offset, pred);
+            ASSERT_EQ(expected_end - expected.begin(), res_end - (res.begin() + offset)) << "copy_if " << threshold;
+            EXPECT_TRUE(std::equal(expected.begin(), expected_end, res.begin() + offset)) << "copy_if " << threshold;
+
+            // the output holds only the selected elements
+            std::vector<T> exact(static_cast<std::size_t>(expected_end - expected.begin()) + 1, T(-1));
+            EXPECT_EQ(exact.end() - 1, xsimd::copy_if(begin, values.end(), exact.begin(), pred));
+            EXPECT_EQ(T(-1), exact.back()) << "copy_if " << threshold;
+
+            vector_type expected_false(values.size()), res_false(values.size());
+            auto expected_ends = std::partition_copy(begin, values.end(), expected.begin(), expected_false.begin(), pred);
+            auto res_ends = xsimd::partition_copy(begin, values.end(), res.begin(), res_false.begin(), pred);
+            ASSERT_EQ(expected_ends.first - expected.begin(), res_ends.first - res.begin()) << "partition_copy " << threshold;
+            ASSERT_EQ(expected_ends.second - expected_false.begin(), res_ends.second - res_false.begin()) << "partition_copy " << threshold;
+            EXPECT_TRUE(std::equal(expected.begin(), expected_ends.first, res.begin())) << "partition_copy " << threshold;
+            EXPECT_TRUE(std::equal(expected_false.begin(), expected_ends.second, res_false.begin())) << "partition_copy " << threshold;
+
+            vector_type removed(values), expected_removed(values);
+            auto expected_new_end = std::remove_if(expected_removed.begin() + offset, expected_removed.end(), pred);
+            auto new_end = xsimd::remove_if(removed.begin() + offset, removed.end(), pred);
+            ASSERT_EQ(expected_new_end - expected_removed.begin(), new_end - removed.begin()) << "remove_if " << threshold;
+            EXPECT_TRUE(std::equal(expected_removed.begin(), expected_new_end, removed.begin())) << "remove_if " << threshold;
+        }
+    }
+}
+
+TEST(algorithms, stream_compaction)
+{
+    check_stream_compaction<float>();
+    check_stream_compaction<double>();
+    check_stream_compaction<int32_t>();
+    check_stream_compaction<uint16_t>();
+    check_stream_compaction<int8_t>();
+}
+
+template <class T>
+void check_scan(std::size_t n, std::size_t offset)
+{
+    using vector_type = std::vector<T, test_allocator_type<T>>;
+    vector_type values(n + offset), inclusive(n), exclusive(n), res(n + offset);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = T((i * 7 + 3) % 5);
+    }
+    auto const first = values.begin() + offset;
+
+    T sum = T(2);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        exclusive[i] = sum;
+        sum = T(sum + first[i]);
+        inclusive[i] = sum;
+    }
+
+    EXPECT_EQ(res.begin() + offset + n, xsimd::inclusive_scan(first, values.end(), res.begin() + offset, T(2)));
+    EXPECT_TRUE(std::equal(inclusive.begin(), inclusive.end(), res.begin() + offset)) << "inclusive_scan " << n << " " << offset;
+
+    EXPECT_EQ(res.begin() + n, xsimd::exclusive_scan(first, values.end(), res.begin(), T(2)));
+    EXPECT_TRUE(std::equal(exclusive.begin(), exclusive.end(), res.begin())) << "exclusive_scan " << n << " " << offset;
+
+    xsimd::inclusive_scan(first, values.end(), res.begin());
+    std::partial_sum(first, values.end(), inclusive.begin());
+    EXPECT_TRUE(std::equal(inclusive.begin(), inclusive.end(), res.begin())) << "inclusive_scan " << n << " " << offset;
+
+    for (std::size_t threads : { 1, 2, 3 })
+    {
+        xsimd::parallel_policy policy(threads);
+        vector_type in_place(values);
+        xsimd::exclusive_scan(policy, in_place.begin() + offset, in_place.end(), in_place.begin() + offset, T(2));
+        EXPECT_TRUE(std::equal(exclusive.begin(), exclusive.end(), in_place.begin() + offset)) << "parallel exclusive_scan " << n << " " << offset;
+
+        xsimd::inclusive_scan(policy, first, values.end(), res.begin());
+        EXPECT_TRUE(std::equal(inclusive.begin(), inclusive.end(), res.begin())) << "parallel inclusive_scan " << n << " " << offset;
+    }
+}
+
+TEST(algorithms, scan)
+{
+    for (std::size_t n : { 0, 1, 5, 17, 64, 1000, 100003 })
+    {
+        for (std::size_t offset : { 0, 1, 3 })
+        {
+            check_scan<float>(n, offset);
+            check_scan<double>(n, offset);
+            check_scan<int32_t>(n, offset);
+            check_scan<uint16_t>(n, offset);
+            check_scan<uint8_t>(n, offset);
+        }
+    }
+}
+
+template <class T>
+void check_polyval(std::size_t degree, xsimd::polynomial_scheme scheme)
+{
+    using vector_type = std::vector<T, test_allocator_type<T>>;
+    std::vector<double> coeffs(degree + 1);
+    for (std::size_t k = 0; k <= degree; ++k)
+    {
+        coeffs[k] = (k % 3 == 0 ? 1. : -0.5) / double(k + 1);
+    }
+    std::size_t const size = 203;
+    vector_type x(size + 1), res(size + 1);
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = T(-1.1 + 2.2 * double(i) / double(size));
+    }
+
+    for (std::size_t offset : { 0, 1 })
+    {
+        auto end = xsimd::polyval(coeffs.begin(), coeffs.end(), x.begin() + offset, x.end(), res.begin(), scheme);
+        EXPECT_EQ(res.begin() + (x.size() - offset), end);
+        for (std::size_t i = 0; i + offset < x.size(); ++i)
+        {
+            long double expected = 0;
+            for (std::size_t k = coeffs.size(); k-- > 0;)
+            {
+                expected = expected * (long double)(x[i + offset]) + (long double)(T(coeffs[k]));
+            }
+            EXPECT_NEAR(double(res[i]), double(expected), 8 * std::numeric_limits<T>::epsilon()) << "degree " << degree << " at " << x[i + offset];
+        }
+    }
+}
+
+// values of packed records, not aligned on their size
+template <class T>
+void check_polyval_misaligned()
+{
+    std::size_t const size = 100;
+    std::vector<T> storage(size + 1);
+    T* x = reinterpret_cast<T*>(reinterpret_cast<char*>(storage.data()) + 2);
+    std::vector<T> values(size), res(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        values[i] = T(i) / T(size);
+    }
+    std::memcpy(static_cast<void*>(x), values.data(), size * sizeof(T));
+
+    std::vector<T> const coeffs = { T(1), T(-2), T(3) };
+    EXPECT_EQ(res.end(), xsimd::polyval(coeffs, x, x + size, res.begin()));
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        T const v = values[i];
+        EXPECT_NEAR(double(res[i]), double((T(3) * v - T(2)) * v + T(1)), 4 * std::numeric_limits<T>::epsilon()) << "misaligned, index " << i;
+    }
+}
+
+TEST(algorithms, polyval)
+{
+    for (std::size_t degree : { 0, 1, 2, 3, 4, 5, 7, 8, 9, 12, 16, 20 })
+    {
+        for (auto scheme : { xsimd::polynomial_scheme::automatic, xsimd::polynomial_scheme::horner, xsimd::polynomial_scheme::estrin })
+        {
+            check_polyval<float>(degree, scheme);
+            check_polyval<double>(degree, scheme);
+        }
+    }
+
+    // in place, with coefficients from a container
+    std::vector<float> x = { 0.f, 1.f, 2.f, -1.f, 0.5f };
+    std::vector<float> const coeffs = { 1.f, -2.f, 3.f };
+    xsimd::polyval(coeffs, x.begin(), x.end(), x.begin());
+    EXPECT_EQ(x, std::vector<float>({ 1.f, 2.f, 9.f, 6.f, 0.75f }));
+
+    std::vector<float> empty;
+    EXPECT_EQ(x.end(), xsimd::polyval(empty, x.begin(), x.end(), x.begin()));
+    EXPECT_EQ(x, std::vector<float>(5, 0.f));
+
+    check_polyval_misaligned<float>();
+    check_polyval_misaligned<double>();
+}
+
+template <class T>
+void check_chebval(std::size_t n, double lo, double hi)
+{
+    using vector_type = std::vector<T, test_allocator_type<T>>;
+    std::vector<T> coeffs(n);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        coeffs[k] = T((k % 2 == 0 ? 1. : -1.) / double(k * k + 1));
+    }
+    std::size_t const size = 131;
+    vector_type x(size), res(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        x[i] = T(lo + (hi - lo) * double(i) / double(size - 1));
+    }
+
+    xsimd::chebval(coeffs.begin(), coeffs.end(), x.begin(), x.end(), res.begin(), lo, hi);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        // T_k(u) = cos(k acos(u))
+        long double const u = std::min(std::max((2.L * x[i] - (lo + hi)) / (hi - lo), -1.L), 1.L);
+        long double expected = 0;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            expected += coeffs[k] * std::cos(k * std::acos(u));
+        }
+        EXPECT_NEAR(double(res[i]), double(expected), 16 * std::numeric_limits<T>::epsilon()) << n << " terms at " << x[i];
+    }
+}
+
+TEST(algorithms, chebval)
+{
+    for (std::size_t n : { 1, 2, 3, 8, 21 })
+    {
+        check_chebval<float>(n, -1., 1.);
+        check_chebval<double>(n, -1., 1.);
+        check_chebval<float>(n, 0., 10.);
+        check_chebval<double>(n, -3., 5.);
+    }
+}
+
+template <class T>
+void check_sort(std::size_t n, unsigned range)
+{
+    std::vector<T> values(n);
+    unsigned seed = 12345u + static_cast<unsigned>(n);
+    for (auto& v : values)
+    {
+        seed = seed * 1103515245u + 12345u;
+        v = static_cast<T>((seed >> 8) % range);
+    }
+    std::vector<T> expected(values);
+    std::sort(expected.begin(), expected.end());
+    xsimd::sort(values.begin(), values.end());
+    EXPECT_EQ(values, expected) << "n = " << n << ", range = " << range;
+}
+
+TEST(algorithms, sort)
+{
+    for (std::size_t n : { 0, 1, 2, 3, 7, 16, 31, 64, 100, 129, 255, 1000, 4097, 20000 })
+    {
+        for (unsigned range : { 3u, 1000u, 1u << 24 })
+        {
+            check_sort<test_value_type>(n, range);
+            check_sort<float>(n, range);
+            check_sort<int32_t>(n, range);
+            check_sort<uint32_t>(n, range);
+            check_sort<int64_t>(n, range);
+            check_sort<uint8_t>(n, range);
+            check_sort<int16_t>(n, range);
+        }
+    }
+
+    // sorted, reversed and negative inputs
+    std::vector<int32_t> values(5000);
+    std::iota(values.begin(), values.end(), -2500);
+    std::vector<int32_t> expected(values);
+    xsimd::sort(values.begin(), values.end());
+    EXPECT_EQ(values, expected);
+    std::reverse(values.begin(), values.end());
+    xsimd::sort(values.begin(), values.end());
+    EXPECT_EQ(values, expected);
+}
+
+TEST(algorithms, sort_nan)
+{
+    test_value_type const nan = std::numeric_limits<test_value_type>::quiet_NaN();
+    for (std::size_t n : { 5, 103, 3000 })
+    {
+        std::vector<test_value_type> values(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            values[i] = i % 7 == 3 ? nan : test_value_type((i * 37) % 101) - test_value_type(50);
+        }
+        std::vector<test_value_type> expected;
+        std::copy_if(values.begin(), values.end(), std::back_inserter(expected), [](test_value_type v) { return v == v; });
+        std::sort(expected.begin(), expected.end());
+
+        xsimd::sort(values.begin(), values.end());
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), values.begin())) << "n = " << n;
+        EXPECT_TRUE(std::all_of(values.begin() + expected.size(), values.end(), [](test_value_type v) { return v != v; })) << "n = " << n;
+    }
+}
+
+TEST(algorithms, byte_search)
+{
+    std::string const text = "GET /index.html HTTP/1.1\r\nHost: example.org\r\nUser-Agent: test\r\n\r\n"
+                             "The quick brown fox jumps over the lazy dog, the quick brown fox jumps again.";
+    // every start offset and length, so that the range ends fall at any
+    // position within the aligned batches
+    for (std::size_t begin = 0; begin < 70; ++begin)
+    {
+        for (std::size_t end = begin; end <= text.size(); end += 3)
+        {
+            auto const first = text.begin() + begin;
+            auto const last = text.begin() + end;
+            for (char c : { 'q', 'T', '\n', 'z', '!' })
+            {
+                EXPECT_EQ(xsimd::find_byte(first, last, c), std::find(first, last, c)) << begin << " " << end << " " << c;
+            }
+            std::string const set = "\r:!";
+            EXPECT_EQ(xsimd::find_any_of(first, last, '\r', ':', '!'), std::find_first_of(first, last, set.begin(), set.end()));
+            for (std::string needle : { "fox", "the quick", "HTTP/1.1\r\n", "a", "again.", "dog, the", "jumps over the lazy dog, the quick", "xyz" })
+            {
+                EXPECT_EQ(xsimd::search(first, last, needle.begin(), needle.end()), std::search(first, last, needle.begin(), needle.end()))
+                    << begin << " " << end << " " << needle;
+            }
+        }
+        EXPECT_EQ(xsimd::strlen(text.c_str() + begin), std::strlen(text.c_str() + begin));
+    }
+
+    std::vector<uint8_t> bytes(1000, 1);
+    bytes[777] = 200;
+    EXPECT_EQ(xsimd::find_byte(bytes.begin(), bytes.end(), uint8_t(200)), bytes.begin() + 777);
+    EXPECT_EQ(xsimd::find_byte(bytes.begin(), bytes.end(), uint8_t(3)), bytes.end());
+    EXPECT_EQ(xsimd::find_any_of(bytes.begin(), bytes.end(), 3, 200), bytes.begin() + 777);
+    std::vector<uint8_t> needle(bytes.begin(), bytes.begin() + 300);
+    EXPECT_EQ(xsimd::search(bytes.begin(), bytes.end(), needle.begin(), needle.end()), bytes.begin());
+    needle.back() = 200;
+    EXPECT_EQ(xsimd::search(bytes.begin(), bytes.end(), needle.begin(), needle.end()), bytes.begin() + 478);
+    EXPECT_EQ(xsimd::search(bytes.begin(), bytes.end(), needle.begin(), needle.begin()), bytes.begin());
+}
+
+TEST(algorithms, accurate_sum)
+{
+    // huge terms cancelling out around small ones: the exact sum is the
+    // number of ones, which a plain summation loses
+    std::vector<double> values;
+    double const big = std::ldexp(1., 60);
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        values.push_back(big);
+        values.push_back(1.);
+        values.push_back(-big);
+    }
+    for (std::size_t offset = 0; offset < 9; offset += 3)
+    {
+        double const expected = double(1000 - offset / 3);
+        EXPECT_EQ(expected, xsimd::accurate_sum(values.begin() + offset, values.end(), xsimd::summation::neumaier)) << offset;
+        EXPECT_EQ(expected, xsimd::accurate_sum(values.begin() + offset, values.end(), xsimd::summation::ogita_rump_oishi)) << offset;
+    }
+
+    // well-conditioned sum: every method is within an ulp of the exact
+    // result
+    std::vector<double> tenths(1000000, 0.1);
+    double const exact = 1000000. * 0.1;
+    for (auto method : { xsimd::summation::kahan, xsimd::summation::neumaier, xsimd::summation::ogita_rump_oishi })
+    {
+        double const res = xsimd::accurate_sum(tenths.begin(), tenths.end(), method);
+        EXPECT_LE(std::abs(res - exact), exact * std::numeric_limits<double>::epsilon());
+    }
+
+    EXPECT_EQ(0., xsimd::accurate_sum(values.begin(), values.begin()));
+}
+
+// the error of a product is only fms(x, y, x * y) when fma is fused
+static_assert(!xsimd::detail::has_fused_fma<xsimd::generic>::value, "no fused fma on generic");
+#if XSIMD_WITH_SSE2
+static_assert(!xsimd::detail::has_fused_fma<xsimd::sse4_2>::value, "no fused fma on sse4.2");
+static_assert(xsimd::detail::has_fused_fma<xsimd::fma3>::value, "fused fma on fma3");
+#endif
+#if XSIMD_WITH_NEON && !defined(__ARM_FEATURE_FMA)
+static_assert(!xsimd::detail::has_fused_fma<xsimd::neon>::value, "no fused fma on neon without VFPv4");
+#endif
+
+TEST(algorithms, accurate_dot)
+{
+    // products that are not representable and cancel each other:
+    // a * (a + 1) - a * (a - 1) == 2 * a
+    double const a = std::ldexp(1., 40) + 1.;
+    std::vector<double> x, y;
+    for (std::size_t i = 0; i < 500; ++i)
+    {
+        x.push_back(a);
+        y.push_back(a + 1.);
+        x.push_back(-a);
+        y.push_back(a - 1.);
+        x.push_back(0.5);
+        y.push_back(2.);
+    }
+    for (std::size_t offset = 0; offset < 9; offset += 3)
+    {
+        double const expected = double(500 - offset / 3) * (2. * a + 1.);
+        EXPECT_EQ(expected, xsimd::accurate_dot(x.begin() + offset, x.end(), y.begin() + offset)) << offset;
+    }
+
+    std::vector<float> u(1000, 0.1f), v(1000, 3.f);
+    float const exact = static_cast<float>(3000. * static_cast<double>(0.1f));
+    for (auto method : { xsimd::summation::kahan, xsimd::summation::neumaier, xsimd::summation::ogita_rump_oishi })
+    {
+        float const res = xsimd::accurate_dot(u.begin(), u.end(), v.begin(), method);
+        EXPECT_LE(std::abs(res - exact), exact * std::numeric_limits<float>::epsilon());
+    }
+}
+
+template <class T>
+std::vector<std::size_t> scalar_bincount(std::vector<T> const& keys, std::size_t num_bins)
+{
+    std::vector<std::size_t> res(num_bins, 0);
+    for (T key : keys)
+    {
+        if (!(key < T(0)) && static_cast<std::size_t>(key) < num_bins)
+        {
+            ++res[static_cast<std::size_t>(key)];
+        }
+    }
+    return res;
+}
+
+TEST(algorithms, bincount)
+{
+    // every key of the type has its own bin
+    std::vector<uint8_t> bytes(3001);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+    {
+        bytes[i] = uint8_t(i * i % 251);
+    }
+    std::vector<std::size_t> counts(300, 0);
+    xsimd::bincount(bytes.begin(), bytes.end(), counts.begin(), counts.end());
+    EXPECT_EQ(scalar_bincount(bytes, 300), counts);
+
+    // negative keys, keys past the last bin, and counts added to the output
+    std::vector<int8_t> small(2000);
+    for (std::size_t i = 0; i < small.size(); ++i)
+    {
+        small[i] = int8_t(int(i % 256) - 128);
+    }
+    std::vector<std::size_t> small_counts(200, 1);
+    xsimd::bincount(small.begin() + 1, small.end(), small_counts.begin(), small_counts.end());
+    std::vector<std::size_t> expected = scalar_bincount(std::vector<int8_t>(small.begin() + 1, small.end()), 200);
+    for (auto& c : expected)
+    {
+        ++c;
+    }
+    EXPECT_EQ(expected, small_counts);
+
+    // many duplicates within a batch
+    std::vector<int32_t> keys(1027);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = int32_t(i % 3 == 0 ? 5 : i % 7) - 1;
+    }
+    std::vector<uint32_t> key_counts(6, 0);
+    xsimd::bincount(keys.begin(), keys.end(), key_counts.begin(), key_counts.end());
+    std::vector<std::size_t> key_expected = scalar_bincount(keys, 6);
+    EXPECT_TRUE(std::equal(key_expected.begin(), key_expected.end(), key_counts.begin()));
+
+    std::vector<uint64_t> wide(keys.begin(), keys.end());
+    std::fill(key_counts.begin(), key_counts.end(), 0);
+    xsimd::bincount(wide.begin(), wide.end(), key_counts.begin(), key_counts.end());
+    key_expected = scalar_bincount(wide, 6);
+    EXPECT_TRUE(std::equal(key_expected.begin(), key_expected.end(), key_counts.begin()));
+}
+
+template <class T>
+void check_histogram(std::size_t num_bins)
+{
+    T const lo = T(-2), hi = T(3);
+    std::vector<T> values;
+    for (std::size_t i = 0; i < 5000; ++i)
+    {
+        values.push_back(T(-2.5) + T(6) * T(i) / T(5000));
+    }
+    values.push_back(lo);
+    values.push_back(hi);
+    values.push_back(std::numeric_limits<T>::quiet_NaN());
+    values.push_back(std::numeric_limits<T>::infinity());
+
+    std::vector<std::size_t> expected(num_bins, 0);
+    T const scale = T(num_bins) / (hi - lo);
+    for (T x : values)
+    {
+        if (x >= lo && x <= hi)
+        {
+            ++expected[std::min(static_cast<std::size_t>((x - lo) * scale), num_bins - 1)];
+        }
+    }
+
+    std::vector<std::size_t> counts(num_bins, 0);
+    xsimd::histogram(values.begin(), values.end(), counts.begin(), counts.end(), lo, hi);
+    EXPECT_EQ(expected, counts) << num_bins << " bins";
+    std::size_t const in_range = static_cast<std::size_t>(std::count_if(values.begin(), values.end(), [&](T x) { return x >= lo && x <= hi; }));
+    EXPECT_EQ(in_range, std::accumulate(counts.begin(), counts.end(), std::size_t(0)));
+}
+
+TEST(algorithms, histogram)
+{
+    check_histogram<float>(10);
+    check_histogram<float>(256);
+    check_histogram<double>(7);
+    check_histogram<double>(4096);
+}
+
+// reference of conversion_policy::saturate
+template <class Out, class In>
+Out saturate_cast(In x)
+{
+    if (std::is_floating_point<Out>::value)
+    {
+        return static_cast<Out>(x);
+    }
+    if (x != x)
+    {
+        return Out(0);
+    }
+    long double const value = x;
+    if (value <= static_cast<long double>(std::numeric_limits<Out>::lowest()))
+    {
+        return std::numeric_limits<Out>::lowest();
+    }
+    if (value >= static_cast<long double>(std::numeric_limits<Out>::max()))
+    {
+        return std::numeric_limits<Out>::max();
+    }
+    return static_cast<Out>(x);
+}
+
+template <class T>
+bool same_value(T x, T y)
+{
+    return x == y || (x != x && y != y);
+}
+
+template <class In, class Out>
+void check_convert()
+{
+    std::size_t const size = 203;
+    std::vector<In> in(size + 1);
+    std::vector<Out> out(size);
+
+    // values representable in both types
+    long double const lo = std::max<long double>(std::numeric_limits<In>::lowest(), std::numeric_limits<Out>::lowest());
+    long double const hi = std::min<long double>(std::numeric_limits<In>::max(), std::numeric_limits<Out>::max());
+    for (std::size_t i = 0; i <= size; ++i)
+    {
+        long double const t = static_cast<long double>((i * 7919) % 1000) / 1000.L;
+        long double const fraction = std::is_floating_point<In>::value ? 0.25L * static_cast<long double>(i % 4) : 0.L;
+        in[i] = static_cast<In>(std::floor(lo + (hi - lo) * t) + fraction);
+    }
+    for (std::size_t offset = 0; offset < 2; ++offset)
+    {
+        auto res = xsimd::convert(in.begin() + offset, in.begin() + offset + size, out.begin());
+        EXPECT_EQ(res, out.end());
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            EXPECT_EQ(out[i], static_cast<Out>(in[i + offset])) << "index " << i << ", offset " << offset;
+        }
+    }
+
+    // values over the whole range of In
+    long double const in_lo = std::is_floating_point<In>::value ? -1e30L : static_cast<long double>(std::numeric_limits<In>::lowest());
+    long double const in_hi = std::is_floating_point<In>::value ? 1e30L : static_cast<long double>(std::numeric_limits<In>::max());
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        long double const t = static_cast<long double>((i * 7919) % 1000) / 1000.L;
+        in[i] = static_cast<In>(in_lo + (in_hi - in_lo) * t);
+    }
+    in[10] = std::numeric_limits<In>::max();
+    in[51] = std::numeric_limits<In>::lowest();
+    if (std::is_floating_point<In>::value)
+    {
+        in[20] = std::numeric_limits<In>::quiet_NaN();
+        in[33] = std::numeric_limits<In>::infinity();
+        in[34] = -std::numeric_limits<In>::infinity();
+        in[40] = static_cast<In>(std::numeric_limits<Out>::max());
+        in[41] = static_cast<In>(-0.75);
+    }
+    xsimd::convert(in.begin(), in.begin() + size, out.begin(), xsimd::conversion_policy::saturate);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        EXPECT_TRUE(same_value(out[i], saturate_cast<Out>(in[i]))) << "index " << i << ": " << +in[i] << " -> " << +out[i];
+    }
+}
+
+TEST(algorithms, convert)
+{
+    // widening
+    check_convert<int8_t, uint16_t>();
+    check_convert<uint8_t, int64_t>();
+    check_convert<int8_t, float>();
+    check_convert<uint8_t, float>();
+    check_convert<int16_t, float>();
+    check_convert<uint16_t, double>();
+    check_convert<int32_t, double>();
+    check_convert<uint32_t, double>();
+    check_convert<float, double>();
+    check_convert<float, int64_t>();
+    // same width
+    check_convert<int32_t, uint32_t>();
+    check_convert<uint32_t, int32_t>();
+    check_convert<uint32_t, float>();
+    check_convert<int64_t, double>();
+    check_convert<float, int32_t>();
+    check_convert<float, uint32_t>();
+    check_convert<double, int64_t>();
+    // narrowing
+    check_convert<int16_t, uint8_t>();
+    check_convert<uint16_t, int8_t>();
+    check_convert<int32_t, int16_t>();
+    check_convert<int64_t, int32_t>();
+    check_convert<double, float>();
+    check_convert<float, int8_t>();
+    check_convert<float, uint8_t>();
+    check_convert<float, int16_t>();
+    check_convert<double, int32_t>();
+    check_convert<double, uint16_t>();
+}
+
+struct affine_functor
+{
+    template <class T>
+    T operator()(const T& a) const
+    {
+        return a * T(3) + T(1);
+    }
+};
+
+struct multiply_add_functor
+{
+    template <class T>
+    T operator()(const T& a, const T& b) const
+    {
+        return a * b + T(2);
+    }
+};
+
+template <class In, class Out>
+void check_mixed_transform()
+{
+    using compute_type = typename std::conditional<(sizeof(In) >= sizeof(Out)), In, Out>::type;
+    std::size_t const size = 301;
+    std::vector<In, test_allocator_type<In>> a(size + 1), b(size + 1);
+    std::vector<Out> out(size + 1);
+    for (std::size_t i = 0; i <= size; ++i)
+    {
+        // a * b + 2 and 3 * a + 1 fit in a byte
+        a[i] = static_cast<In>(i % 9);
+        b[i] = static_cast<In>((i * 7) % 23);
+    }
+    for (std::size_t offset = 0; offset < 2; ++offset)
+    {
+        xsimd::transform(a.begin() + offset, a.begin() + offset + size, out.begin() + 1, affine_functor{});
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            EXPECT_EQ(out[i + 1], static_cast<Out>(affine_functor{}(static_cast<compute_type>(a[i + offset])))) << "unary, index " << i << ", offset " << offset;
+        }
+        xsimd::transform(a.begin() + offset, a.begin() + offset + size, b.begin(), out.begin(), multiply_add_functor{});
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            EXPECT_EQ(out[i], static_cast<Out>(multiply_add_functor{}(static_cast<compute_type>(a[i + offset]), static_cast<compute_type>(b[i])))) << "binary, index " << i << ", offset " << offset;
+        }
+    }
+}
+
+TEST(algorithms, mixed_transform)
+{
+    check_mixed_transform<uint8_t, float>();
+    check_mixed_transform<int16_t, float>();
+    check_mixed_transform<uint16_t, int32_t>();
+    check_mixed_transform<int32_t, float>();
+    check_mixed_transform<float, uint8_t>();
+    check_mixed_transform<float, int16_t>();
+    check_mixed_transform<int32_t, int8_t>();
+    check_mixed_transform<test_value_type, int32_t>();
+
+    // the parallel transform splits a mixed one into chunks
+    std::size_t const n = 100003;
+    std::vector<uint8_t, test_allocator_type<uint8_t>> a(n);
+    std::vector<float> expected(n), c(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = static_cast<uint8_t>(i);
+        expected[i] = affine_functor{}(static_cast<float>(a[i]));
+    }
+    xsimd::transform(xsimd::parallel_policy(3), a.begin(), a.end(), c.begin(), affine_functor{});
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+}
+
+static_assert(xsimd::is_contiguous_iterator<float*>::value, "pointers are contiguous");
+static_assert(xsimd::is_contiguous_iterator<std::vector<float>::const_iterator>::value, "vector iterators are contiguous");
+static_assert(!xsimd::is_contiguous_iterator<std::deque<float>::iterator>::value, "deque iterators are not contiguous");
+static_assert(!xsimd::is_contiguous_iterator<xsimd::strided_iterator<float>>::value, "strided iterators are not contiguous");
+static_assert(!xsimd::is_contiguous_iterator<std::vector<float>::reverse_iterator>::value, "reverse iterators are not contiguous");
+
+// random access iterator over a ring buffer, starting anywhere in it
+template <class T>
+class ring_iterator
+{
+public:
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    ring_iterator(T* data, std::ptrdiff_t capacity, std::ptrdiff_t pos)
+        : m_data(data), m_capacity(capacity), m_pos(pos)
+    {
+    }
+
+    reference operator*() const { return m_data[m_pos % m_capacity]; }
+    reference operator[](difference_type n) const { return m_data[(m_pos + n) % m_capacity]; }
+
+    ring_iterator& operator++() { ++m_pos; return *this; }
+    ring_iterator& operator--() { --m_pos; return *this; }
+    ring_iterator operator++(int) { ring_iterator tmp(*this); ++m_pos; return tmp; }
+    ring_iterator operator--(int) { ring_iterator tmp(*this); --m_pos; return tmp; }
+    ring_iterator& operator+=(difference_type n) { m_pos += n; return *this; }
+    ring_iterator& operator-=(difference_type n) { m_pos -= n; return *this; }
+
+    friend ring_iterator operator+(ring_iterator it, difference_type n) { return it += n; }
+    friend ring_iterator operator+(difference_type n, ring_iterator it) { return it += n; }
+    friend ring_iterator operator-(ring_iterator it, difference_type n) { return it -= n; }
+    friend difference_type operator-(ring_iterator const& lhs, ring_iterator const& rhs) { return lhs.m_pos - rhs.m_pos; }
+
+    friend bool operator==(ring_iterator const& lhs, ring_iterator const& rhs) { return lhs.m_pos == rhs.m_pos; }
+    friend bool operator!=(ring_iterator const& lhs, ring_iterator const& rhs) { return lhs.m_pos != rhs.m_pos; }
+    friend bool operator<(ring_iterator const& lhs, ring_iterator const& rhs) { return lhs.m_pos < rhs.m_pos; }
+    friend bool operator>(ring_iterator const& lhs, ring_iterator const& rhs) { return lhs.m_pos > rhs.m_pos; }
+    friend bool operator<=(ring_iterator const& lhs, ring_iterator const& rhs) { return lhs.m_pos <= rhs.m_pos; }
+    friend bool operator>=(ring_iterator const& lhs, ring_iterator const& rhs) { return lhs.m_pos >= rhs.m_pos; }
+
+private:
+
+    T* m_data;
+    std::ptrdiff_t m_capacity;
+    std::ptrdiff_t m_pos;
+};
+
+static_assert(!xsimd::is_contiguous_iterator<ring_iterator<float>>::value, "user iterators are not contiguous unless they say so");
+
+template <class T>
+void check_ring()
+{
+    // the range wraps around the end of the buffer, unaligned loads from
+    // &*first would read past it
+    std::ptrdiff_t const capacity = 101;
+    std::vector<T> buffer(static_cast<std::size_t>(capacity));
+    for (std::size_t i = 0; i < buffer.size(); ++i)
+    {
+        buffer[i] = static_cast<T>(i % 11);
+    }
+    ring_iterator<T> first(buffer.data(), capacity, capacity - 3);
+    ring_iterator<T> last = first + capacity;
+
+    EXPECT_EQ(xsimd::reduce(first, last, T(1)), std::accumulate(first, last, T(1)));
+    EXPECT_EQ(xsimd::transform_reduce(first, last, buffer.begin(), T(0)), std::inner_product(first, last, buffer.begin(), T(0)));
+    EXPECT_EQ(xsimd::count(first, last, T(10)), std::count(first, last, T(10)));
+    EXPECT_EQ(xsimd::find(first + 5, last, T(0)), std::find(first + 5, last, T(0)));
+
+    std::vector<T> res(buffer.size()), expected(buffer.size());
+    xsimd::transform(first, last, res.begin(), unary_functor{});
+    std::transform(first, last, expected.begin(), unary_functor{});
+    EXPECT_EQ(res, expected);
+
+    // written in place, across the end of the buffer
+    std::vector<T> values(buffer);
+    std::transform(first, last, first, unary_functor{});
+    ring_iterator<T> values_first(values.data(), capacity, capacity - 3);
+    xsimd::transform(values_first, values_first + capacity, values_first, unary_functor{});
+    EXPECT_EQ(values, buffer);
+}
+
+TEST(algorithms, user_iterator)
+{
+    check_ring<float>();
+    check_ring<double>();
+    check_ring<int16_t>();
+}
+
+template <class T>
+void check_strided()
+{
+    // row major matrix, whose columns are reduced and transformed
+    std::size_t const rows = 203;
+    std::size_t const cols = 7;
+    std::vector<T> m(rows * cols);
+    for (std::size_t i = 0; i < m.size(); ++i)
+    {
+        m[i] = static_cast<T>(i % 13);
+    }
+
+    for (std::size_t j = 0; j < cols; ++j)
+    {
+        auto first = xsimd::make_strided_iterator(m.data() + j, static_cast<std::ptrdiff_t>(cols));
+        auto last = first + static_cast<std::ptrdiff_t>(rows);
+        EXPECT_EQ(static_cast<std::size_t>(last - first), rows);
+        EXPECT_EQ(xsimd::reduce(first, last, T(1)), std::accumulate(first, last, T(1))) << "column " << j;
+        EXPECT_EQ(xsimd::reduce(xsimd::par, first, last, T(0)), std::accumulate(first, last, T(0))) << "column " << j;
+        EXPECT_EQ(xsimd::transform_reduce(first, last, m.begin(), T(0)), std::inner_product(first, last, m.begin(), T(0))) << "column " << j;
+
+        EXPECT_EQ(xsimd::count(first, last, T(12)), std::count(first, last, T(12))) << "column " << j;
+        EXPECT_EQ(xsimd::find(first, last, T(12)), std::find(first, last, T(12))) << "column " << j;
+
+        std::vector<T> column(rows), expected(rows);
+        std::transform(first, last, expected.begin(), unary_functor{});
+        xsimd::transform(first, last, column.begin(), unary_functor{});
+        EXPECT_EQ(column, expected) << "column " << j;
+    }
+
+    // strided output, written with scatter
+    std::vector<T> a(rows), b(rows), res(2 * rows), expected(2 * rows);
+    std::iota(a.begin(), a.end(), T(1));
+    std::iota(b.begin(), b.end(), T(3));
+    auto out = xsimd::make_strided_iterator(res.data() + 1, 2);
+    xsimd::transform(a.begin(), a.end(), b.begin(), out, binary_functor{});
+    std::transform(a.begin(), a.end(), b.begin(), xsimd::make_strided_iterator(expected.data() + 1, 2), binary_functor{});
+    EXPECT_EQ(res, expected);
+
+    // only the first column is read, whatever the other ones hold
+    std::vector<T> small = { T(1), T(9), T(9), T(2), T(9), T(9), T(3), T(9), T(9), T(4), T(9), T(9) };
+    auto column_first = xsimd::make_strided_iterator(small.data(), 3);
+    EXPECT_EQ(xsimd::count(column_first, column_first + 4, T(9)), 0);
+    EXPECT_EQ(xsimd::find(column_first, column_first + 4, T(9)), column_first + 4);
+    EXPECT_EQ(xsimd::find(column_first, column_first + 4, T(3)), column_first + 2);
+
+    // reverse iteration goes through a buffer
+    std::vector<T> reversed(rows);
+    xsimd::transform(a.rbegin(), a.rend(), reversed.begin(), unary_functor{});
+    std::transform(a.rbegin(), a.rend(), expected.begin(), unary_functor{});
+    EXPECT_TRUE(std::equal(reversed.begin(), reversed.end(), expected.begin()));
+}
+
+template <class T, class Index>
+void check_indirect()
+{
+    std::size_t const size = 301;
+    std::vector<T> values(size);
+    std::vector<Index> index(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        values[i] = static_cast<T>(i % 17);
+        index[i] = static_cast<Index>((i * 37) % size);
+    }
+    auto first = xsimd::make_indirect_iterator(values.data(), index.data());
+    auto last = first + static_cast<std::ptrdiff_t>(size);
+    EXPECT_EQ(xsimd::reduce(first, last, T(0)), std::accumulate(first, last, T(0)));
+    EXPECT_EQ(xsimd::count(first, last, T(5)), std::count(first, last, T(5)));
+    EXPECT_EQ(xsimd::find(first, last, T(16)), std::find(first, last, T(16)));
+    EXPECT_EQ(xsimd::transform_reduce(first, last, T(0), binary_functor{}, unary_functor{}),
+              std::accumulate(first, last, T(0), [](T acc, T x) { return acc - x; }));
+
+    // the permutation is written back in place
+    std::vector<T> expected(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        expected[index[i]] = -values[index[i]];
+    }
+    xsimd::transform(first, last, first, unary_functor{});
+    EXPECT_EQ(values, expected);
+}
+
+TEST(algorithms, strided_iterator)
+{
+    check_strided<float>();
+    check_strided<int32_t>();
+    check_strided<int8_t>();
+    check_strided<test_value_type>();
+}
+
+TEST(algorithms, indirect_iterator)
+{
+    check_indirect<float, int32_t>();
+    check_indirect<float, std::size_t>();
+    check_indirect<int16_t, uint32_t>();
+    check_indirect<test_value_type, uint64_t>();
+
+    // 64-bit indices beyond the range of 32-bit offsets, the base being
+    // shifted back by 2^32 elements
+#if SIZE_MAX > 0xffffffffu
+    {
+        std::size_t const shift = std::size_t(1) << 32;
+        std::vector<float> values(64);
+        std::vector<std::size_t> index(values.size());
+        for (std::size_t i = 0; i < index.size(); ++i)
+        {
+            values[i] = static_cast<float>(i);
+            index[i] = shift + (i * 5) % values.size();
+        }
+        auto first = xsimd::make_indirect_iterator(values.data() - shift, index.data());
+        auto last = first + static_cast<std::ptrdiff_t>(index.size());
+        EXPECT_EQ(xsimd::reduce(first, last, 0.f), 2016.f);
+        EXPECT_EQ(xsimd::find(first, last, 7.f) - first, 27);
+        std::vector<float> res(index.size()), expected(index.size());
+        xsimd::transform(first, last, res.begin(), unary_functor{});
+        std::transform(first, last, expected.begin(), unary_functor{});
+        EXPECT_EQ(res, expected);
+
+        // unsigned 32-bit indices from 2^31, which are not negative offsets
+        std::size_t const half = std::size_t(1) << 31;
+        std::vector<uint32_t> index32(index.size());
+        for (std::size_t i = 0; i < index32.size(); ++i)
+        {
+            index32[i] = static_cast<uint32_t>(half + (i * 5) % values.size());
+        }
+        auto first32 = xsimd::make_indirect_iterator(values.data() - half, index32.data());
+        EXPECT_EQ(xsimd::reduce(first32, first32 + static_cast<std::ptrdiff_t>(index32.size()), 0.f), 2016.f);
+    }
+#endif
+
+    std::deque<float> d(100);
+    std::iota(d.begin(), d.end(), 1.f);
+    EXPECT_EQ(xsimd::reduce(d.begin(), d.end(), 0.f), 5050.f);
+}
+
 #if XSIMD_X86_INSTR_SET > XSIMD_VERSION_NUMBER_NOT_AVAILABLE || XSIMD_ARM_INSTR_SET > XSIMD_VERSION_NUMBER_NOT_AVAILABLE
 TEST(algorithms, iterator)
 {
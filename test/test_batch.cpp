@@ -18,6 +18,18 @@
 
 using namespace std::placeholders;
 
+template <class T>
+struct reverse_index
+{
+    static constexpr T get(size_t i, size_t n) { return static_cast<T>(n - 1 - i); }
+};
+
+template <class T>
+struct rotate_index
+{
+    static constexpr T get(size_t i, size_t n) { return static_cast<T>((i + 1) % n); }
+};
+
 template <class B>
 class batch_test : public testing::Test
 {
@@ -114,6 +126,62 @@ protected:
         {
             EXPECT_EQ(res.get(i), lhs[i]) << print_function_name("get(") << i << ")";
         }
+        EXPECT_EQ(res.first(), lhs[0]) << print_function_name("first()");
+        test_static_access(xsimd::detail::make_index_sequence<size>());
+    }
+
+    void test_swizzle() const
+    {
+        using index_type = xsimd::as_unsigned_integer_t<value_type>;
+        using index_batch = xsimd::batch<index_type, typename batch_type::arch_type>;
+
+        array_type expected;
+        std::reverse_copy(lhs.cbegin(), lhs.cend(), expected.begin());
+        batch_type res = xsimd::swizzle(batch_lhs(), xsimd::make_batch_constant<index_batch, reverse_index<index_type>>());
+        EXPECT_BATCH_EQ(res, expected) << print_function_name("swizzle (reverse)");
+
+        std::rotate_copy(lhs.cbegin(), lhs.cbegin() + 1, lhs.cend(), expected.begin());
+        res = xsimd::swizzle(batch_lhs(), xsimd::make_batch_constant<index_batch, rotate_index<index_type>>());
+        EXPECT_BATCH_EQ(res, expected) << print_function_name("swizzle (rotate)");
+
+        // slides are counted in bytes, zeros being shifted in
+        expected.fill(value_type(0));
+        std::copy(lhs.cbegin(), lhs.cend() - 1, expected.begin() + 1);
+        res = xsimd::slide_left<sizeof(value_type)>(batch_lhs());
+        EXPECT_BATCH_EQ(res, expected) << print_function_name("slide_left");
+
+        expected.fill(value_type(0));
+        std::copy(lhs.cbegin() + size / 2, lhs.cend(), expected.begin());
+        res = xsimd::slide_right<size / 2 * sizeof(value_type)>(batch_lhs());
+        EXPECT_BATCH_EQ(res, expected) << print_function_name("slide_right");
+
+        expected.fill(value_type(0));
+        res = xsimd::slide_left<size * sizeof(value_type)>(batch_lhs());
+        EXPECT_BATCH_EQ(res, expected) << print_function_name("slide_left (whole batch)");
+    }
+
+    void test_compress() const
+    {
+        // every pattern for small batches, a sample of them otherwise
+        std::size_t const step = size <= 8 ? 1 : 97;
+        for (std::size_t pattern = 0; pattern < (std::size_t(1) << std::min<std::size_t>(size, 16)); pattern += step)
+        {
+            bool_array_type selected;
+            array_type expected;
+            expected.fill(value_type(0));
+            std::size_t j = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                selected[i] = ((pattern >> (i % 16)) & 1) != 0;
+                if (selected[i])
+                {
+                    expected[j++] = lhs[i];
+                }
+            }
+            auto mask = xsimd::batch_bool<value_type, typename batch_type::arch_type>::load_unaligned(selected.data());
+            batch_type res = xsimd::compress(batch_lhs(), mask);
+            EXPECT_BATCH_EQ(res, expected) << print_function_name("compress") << " pattern " << pattern;
+        }
     }
 
     void test_arithmetic() const
@@ -495,6 +563,20 @@ protected:
             batch_type res = fmax(batch_lhs(), batch_rhs());
             EXPECT_BATCH_EQ(res, expected) << print_function_name("fmax");
         }
+        // NaN policies agree on values that are not NaN
+        {
+            array_type expected_min, expected_max;
+            std::transform(lhs.cbegin(), lhs.cend(), rhs.cbegin(), expected_min.begin(),
+                           [](const value_type& l, const value_type& r) { return std::min(l, r); });
+            std::transform(lhs.cbegin(), lhs.cend(), rhs.cbegin(), expected_max.begin(),
+                           [](const value_type& l, const value_type& r) { return std::max(l, r); });
+            EXPECT_BATCH_EQ(xsimd::min_fast(batch_lhs(), batch_rhs()), expected_min) << print_function_name("min_fast");
+            EXPECT_BATCH_EQ(xsimd::min_ignore_nan(batch_lhs(), batch_rhs()), expected_min) << print_function_name("min_ignore_nan");
+            EXPECT_BATCH_EQ(xsimd::min_propagate_nan(batch_lhs(), batch_rhs()), expected_min) << print_function_name("min_propagate_nan");
+            EXPECT_BATCH_EQ(xsimd::max_fast(batch_lhs(), batch_rhs()), expected_max) << print_function_name("max_fast");
+            EXPECT_BATCH_EQ(xsimd::max_ignore_nan(batch_lhs(), batch_rhs()), expected_max) << print_function_name("max_ignore_nan");
+            EXPECT_BATCH_EQ(xsimd::max_propagate_nan(batch_lhs(), batch_rhs()), expected_max) << print_function_name("max_propagate_nan");
+        }
     }
 
     void test_fused_operations() const
@@ -562,6 +644,13 @@ protected:
             value_type res = hadd(batch_lhs());
             EXPECT_SCALAR_EQ(res, expected) << print_function_name("hadd");
         }
+        // inclusive_scan
+        {
+            array_type expected;
+            std::partial_sum(lhs.cbegin(), lhs.cend(), expected.begin());
+            batch_type res = inclusive_scan(batch_lhs());
+            EXPECT_BATCH_EQ(res, expected) << print_function_name("inclusive_scan");
+        }
     }
 
     void test_boolean_conversions() const
@@ -637,6 +726,24 @@ protected:
 
 private:
 
+    template <size_t... Is>
+    void test_static_access(xsimd::detail::index_sequence<Is...>) const
+    {
+        batch_type b = batch_lhs();
+        array_type res = {b.template get<Is>()...};
+        EXPECT_EQ(res, lhs) << print_function_name("get<I>()");
+
+        batch_type updated = batch_lhs();
+        (void)std::initializer_list<int>{(updated.template set<Is>(rhs[Is]), 0)...};
+        EXPECT_EQ(updated, rhs) << print_function_name("set<I>()");
+
+        array_type expected = lhs;
+        expected[size - 1] = rhs[size - 1];
+        batch_type last = batch_lhs();
+        last.template set<size - 1>(rhs[size - 1]);
+        EXPECT_EQ(last, expected) << print_function_name("set<size - 1>()");
+    }
+
     batch_type batch_lhs() const
     {
         return batch_type::load_unaligned(lhs.data());
@@ -706,6 +813,16 @@ TYPED_TEST(batch_test, access_operator)
     this->test_access_operator();
 }
 
+TYPED_TEST(batch_test, swizzle)
+{
+    this->test_swizzle();
+}
+
+TYPED_TEST(batch_test, compress)
+{
+    this->test_compress();
+}
+
 TYPED_TEST(batch_test, arithmetic)
 {
     this->test_arithmetic();
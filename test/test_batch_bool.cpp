@@ -167,6 +167,46 @@ protected:
         EXPECT_EQ(ares, arhs) << print_function_name("load_aligned / store_aligned");
     }
 
+    void test_access_operator() const
+    {
+        auto bool_g = xsimd::get_bool<batch_bool_type>{};
+        for (const auto& vec : bool_g.almost_all_false())
+        {
+            batch_bool_type b = batch_bool_type::load_unaligned(vec.data());
+            bool_array_type res;
+            for (size_t i = 0; i < size; ++i)
+            {
+                res[i] = b.get(i);
+            }
+            EXPECT_EQ(res, vec) << print_function_name("get(i)");
+            EXPECT_EQ(b.first(), vec[0]) << print_function_name("first()");
+            test_static_access(b, vec, xsimd::detail::make_index_sequence<size>());
+        }
+    }
+
+    void test_mask() const
+    {
+        auto bool_g = xsimd::get_bool<batch_bool_type>{};
+        auto check = [](bool_array_type const& vec)
+        {
+            uint64_t expected = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                expected |= vec[i] ? uint64_t(1) << i : uint64_t(0);
+            }
+            EXPECT_EQ(batch_bool_type::load_unaligned(vec.data()).mask(), expected) << print_function_name("mask()");
+        };
+        for (const auto& vec : bool_g.almost_all_false())
+        {
+            check(vec);
+        }
+        for (const auto& vec : bool_g.almost_all_true())
+        {
+            check(vec);
+        }
+        EXPECT_EQ(batch_bool_type(false).mask(), uint64_t(0)) << print_function_name("mask() (false)");
+    }
+
     void test_any_all() const
     {
         auto bool_g = xsimd::get_bool<batch_bool_type>{};
@@ -292,6 +332,13 @@ private:
     {
         return batch_type::load_unaligned(rhs.data());
     }
+
+    template <size_t... Is>
+    void test_static_access(batch_bool_type const& b, bool_array_type const& expected, xsimd::detail::index_sequence<Is...>) const
+    {
+        bool_array_type res = {b.template get<Is>()...};
+        EXPECT_EQ(res, expected) << print_function_name("get<I>()");
+    }
 };
 
 TYPED_TEST_SUITE(batch_bool_test, batch_types, simd_test_names);
@@ -301,6 +348,16 @@ TYPED_TEST(batch_bool_test, load_store)
     this->test_load_store();
 }
 
+TYPED_TEST(batch_bool_test, access_operator)
+{
+    this->test_access_operator();
+}
+
+TYPED_TEST(batch_bool_test, mask)
+{
+    this->test_mask();
+}
+
 TYPED_TEST(batch_bool_test, any_all)
 {
     this->test_any_all();
@@ -78,6 +78,150 @@ protected:
         EXPECT_BATCH_EQ(res, expected) << print_function_name("haddp");
     }
 
+    void test_nan_comparison() const
+    {
+        // comparisons with NaN are unordered: only != holds
+        batch_type nan(std::numeric_limits<value_type>::quiet_NaN());
+        bool_array_type all_true, all_false;
+        std::fill(all_true.begin(), all_true.end(), true);
+        std::fill(all_false.begin(), all_false.end(), false);
+        EXPECT_BATCH_EQ(nan != nan, all_true) << print_function_name("nan != nan");
+        EXPECT_BATCH_EQ(nan != batch_lhs(), all_true) << print_function_name("nan != batch");
+        EXPECT_BATCH_EQ(nan == nan, all_false) << print_function_name("nan == nan");
+        EXPECT_BATCH_EQ(nan < batch_lhs(), all_false) << print_function_name("nan < batch");
+    }
+
+    void test_nan_min_max() const
+    {
+        // lane i % 4: NaN on the left, on the right, on both sides, nowhere
+        value_type const nan = std::numeric_limits<value_type>::quiet_NaN();
+        array_type x, y;
+        for (size_t i = 0; i < size; ++i)
+        {
+            x[i] = (i % 4 == 0 || i % 4 == 2) ? nan : lhs[i];
+            y[i] = (i % 4 == 1 || i % 4 == 2) ? nan : rhs[i];
+        }
+        batch_type const bx = batch_type::load_unaligned(x.data());
+        batch_type const by = batch_type::load_unaligned(y.data());
+
+        // policy 0 propagates NaN, 1 ignores it, 2 returns either y or NaN
+        auto check_nan_policy = [&](batch_type const& res, value_type (*ignore)(value_type, value_type), int policy, std::string const& name)
+        {
+            array_type out;
+            res.store_unaligned(out.data());
+            for (size_t i = 0; i < size; ++i)
+            {
+                if (policy == 0)
+                {
+                    if (i % 4 != 3)
+                        EXPECT_TRUE(std::isnan(out[i])) << print_function_name(name) << " at " << i;
+                    else
+                        EXPECT_EQ(out[i], ignore(x[i], y[i])) << print_function_name(name) << " at " << i;
+                }
+                else if (policy == 1 || i % 4 == 3)
+                {
+                    value_type const expected = ignore(x[i], y[i]);
+                    if (std::isnan(expected))
+                        EXPECT_TRUE(std::isnan(out[i])) << print_function_name(name) << " at " << i;
+                    else
+                        EXPECT_EQ(out[i], expected) << print_function_name(name) << " at " << i;
+                }
+                else
+                {
+                    EXPECT_TRUE(std::isnan(out[i]) || out[i] == y[i]) << print_function_name(name) << " at " << i;
+                }
+            }
+        };
+        value_type (*fmin_ref)(value_type, value_type) = [](value_type a, value_type b) { return std::fmin(a, b); };
+        value_type (*fmax_ref)(value_type, value_type) = [](value_type a, value_type b) { return std::fmax(a, b); };
+        check_nan_policy(xsimd::min_propagate_nan(bx, by), fmin_ref, 0, "min_propagate_nan");
+        check_nan_policy(xsimd::min_ignore_nan(bx, by), fmin_ref, 1, "min_ignore_nan");
+        check_nan_policy(xsimd::min_fast(bx, by), fmin_ref, 2, "min_fast");
+        check_nan_policy(xsimd::fmin(bx, by), fmin_ref, 1, "fmin");
+        check_nan_policy(xsimd::max_propagate_nan(bx, by), fmax_ref, 0, "max_propagate_nan");
+        check_nan_policy(xsimd::max_ignore_nan(bx, by), fmax_ref, 1, "max_ignore_nan");
+        check_nan_policy(xsimd::max_fast(bx, by), fmax_ref, 2, "max_fast");
+        check_nan_policy(xsimd::fmax(bx, by), fmax_ref, 1, "fmax");
+
+        // clip: NaN inputs become lo or stay NaN, bounds are never NaN
+        batch_type const lo(value_type(0.5)), hi(value_type(1.5));
+        array_type ignored, propagated, fast;
+        xsimd::clip_ignore_nan(bx, lo, hi).store_unaligned(ignored.data());
+        xsimd::clip_propagate_nan(bx, lo, hi).store_unaligned(propagated.data());
+        xsimd::clip_fast(bx, lo, hi).store_unaligned(fast.data());
+        for (size_t i = 0; i < size; ++i)
+        {
+            value_type const expected = std::fmin(value_type(1.5), std::fmax(x[i], value_type(0.5)));
+            EXPECT_EQ(ignored[i], expected) << print_function_name("clip_ignore_nan") << " at " << i;
+            if (std::isnan(x[i]))
+            {
+                EXPECT_TRUE(std::isnan(propagated[i])) << print_function_name("clip_propagate_nan") << " at " << i;
+                EXPECT_TRUE(std::isnan(fast[i]) || fast[i] == value_type(0.5)) << print_function_name("clip_fast") << " at " << i;
+            }
+            else
+            {
+                EXPECT_EQ(propagated[i], expected) << print_function_name("clip_propagate_nan") << " at " << i;
+                EXPECT_EQ(fast[i], expected) << print_function_name("clip_fast") << " at " << i;
+            }
+        }
+    }
+
+    void test_reciprocal() const
+    {
+        check_refinement("reciprocal", xsimd::detail::make_index_sequence<5>());
+    }
+
+    void test_rsqrt() const
+    {
+        check_refinement("rsqrt", xsimd::detail::make_index_sequence<5>());
+    }
+
+private:
+
+    // largest relative error of reciprocal<Steps> or rsqrt<Steps> over
+    // mantissas and exponents in [2^-30, 2^31), negative ones included for
+    // the reciprocal
+    template <std::size_t Steps>
+    double refinement_error(std::string const& name) const
+    {
+        bool const is_rsqrt = name == "rsqrt";
+        double res = 0.;
+        array_type input, output;
+        for (size_t k = 0; k < 509 * 61; k += size)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                size_t const j = k + i;
+                value_type const sign = (is_rsqrt || j % 2 == 0) ? value_type(1) : value_type(-1);
+                input[i] = sign * std::ldexp(value_type(1) + value_type(j % 509) / 509, int(j % 61) - 30);
+            }
+            batch_type const x = batch_type::load_unaligned(input.data());
+            batch_type const y = is_rsqrt ? xsimd::rsqrt<Steps>(x) : xsimd::reciprocal<Steps>(x);
+            y.store_unaligned(output.data());
+            for (size_t i = 0; i < size; ++i)
+            {
+                long double const expected = is_rsqrt ? 1.L / std::sqrt((long double)input[i]) : 1.L / input[i];
+                res = std::max(res, double(std::fabs((output[i] - expected) / expected)));
+            }
+        }
+        return res;
+    }
+
+    // each step squares the error, down to the rounding errors of the
+    // arithmetic
+    template <std::size_t... Steps>
+    void check_refinement(std::string const& name, xsimd::detail::index_sequence<Steps...>) const
+    {
+        double const errors[] = { refinement_error<Steps>(name)... };
+        double const eps = std::numeric_limits<value_type>::epsilon();
+        EXPECT_LT(errors[0], name == "rsqrt" ? 0.035 : 0.052) << print_function_name(name + "<0>");
+        for (size_t i = 1; i < sizeof...(Steps); ++i)
+        {
+            EXPECT_LE(errors[i], 2 * errors[i - 1] * errors[i - 1] + 4 * eps) << print_function_name(name) << " after " << i << " steps";
+        }
+        EXPECT_LE(errors[sizeof...(Steps) - 1], 4 * eps) << print_function_name(name) << " fully refined";
+    }
+
 private:
 
     batch_type batch_lhs() const
@@ -104,3 +248,22 @@ TYPED_TEST(batch_float_test, haddp)
     this->test_haddp();
 }
 
+TYPED_TEST(batch_float_test, reciprocal)
+{
+    this->test_reciprocal();
+}
+
+TYPED_TEST(batch_float_test, rsqrt)
+{
+    this->test_rsqrt();
+}
+
+TYPED_TEST(batch_float_test, nan_comparison)
+{
+    this->test_nan_comparison();
+}
+
+TYPED_TEST(batch_float_test, nan_min_max)
+{
+    this->test_nan_min_max();
+}
@@ -277,6 +277,11 @@ protected:
         }
     }
 
+    void test_conflict() const
+    {
+        test_conflict_impl(std::integral_constant<bool, sizeof(value_type) >= 4>());
+    }
+
     void test_min_max() const
     {
         xsimd::test_int_min_max<batch_type> t;
@@ -298,6 +303,34 @@ protected:
 
 private:
 
+    void test_conflict_impl(std::false_type) const
+    {
+    }
+
+    void test_conflict_impl(std::true_type) const
+    {
+        // lanes holding i % 3 match the preceding lanes with the same remainder
+        array_type values, expected;
+        for (size_t i = 0; i < size; ++i)
+        {
+            values[i] = value_type(i % 3);
+            expected[i] = value_type(0);
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (j % 3 == i % 3)
+                {
+                    expected[i] |= value_type(value_type(1) << j);
+                }
+            }
+        }
+        batch_type res = xsimd::conflict(batch_type::load_unaligned(values.data()));
+        EXPECT_BATCH_EQ(res, expected) << print_function_name("conflict");
+
+        expected.fill(value_type(0));
+        res = xsimd::conflict(batch_lhs());
+        EXPECT_BATCH_EQ(res, expected) << print_function_name("conflict (distinct lanes)");
+    }
+
     batch_type batch_lhs() const
     {
         return batch_type::load_unaligned(lhs.data());
@@ -331,6 +364,11 @@ TYPED_TEST(batch_int_test, more_shift)
     this->test_more_shift();
 }
 
+TYPED_TEST(batch_int_test, conflict)
+{
+    this->test_conflict();
+}
+
 TYPED_TEST(batch_int_test, min_max)
 {
     this->test_min_max();
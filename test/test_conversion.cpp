@@ -152,6 +152,55 @@ protected:
             EXPECT_VECTOR_EQ(ui8vres, ui8res) << print_function_name("u8_to_64");
         }
     }
+
+    void test_widen_narrow()
+    {
+        check_widen_narrow<int8_t>();
+        check_widen_narrow<uint8_t>();
+        check_widen_narrow<int16_t>();
+        check_widen_narrow<uint16_t>();
+        check_widen_narrow<int32_t>();
+        check_widen_narrow<uint32_t>();
+        check_widen_narrow<float>();
+    }
+
+private:
+
+    template <class T>
+    void check_widen_narrow()
+    {
+        using wide_type = xsimd::widen_type_t<T>;
+        using batch_type = xsimd::batch<T>;
+        using wide_batch = xsimd::batch<wide_type>;
+        constexpr std::size_t size = batch_type::size;
+        std::vector<T, xsimd::default_allocator<T>> input(size), narrowed(size);
+        std::vector<wide_type, xsimd::default_allocator<wide_type>> wide(size), expected(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            // covers both signs and the full range of the narrow type
+            input[i] = static_cast<T>(std::numeric_limits<T>::max() / T(size) * T(i) - T(i % 2 ? 3 : 0));
+            expected[i] = static_cast<wide_type>(input[i]);
+        }
+        auto res = xsimd::widen(batch_type::load_aligned(input.data()));
+        res[0].store_aligned(wide.data());
+        res[1].store_aligned(wide.data() + wide_batch::size);
+        EXPECT_VECTOR_EQ(wide, expected) << print_function_name("widen");
+
+        xsimd::narrow(res[0], res[1]).store_aligned(narrowed.data());
+        EXPECT_VECTOR_EQ(narrowed, input) << print_function_name("narrow");
+
+        if (std::is_integral<T>::value)
+        {
+            // narrowing keeps the low bits of integers
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                wide[i] = static_cast<wide_type>(expected[i] * wide_type(1000) + wide_type(i));
+                input[i] = static_cast<T>(wide[i]);
+            }
+            xsimd::narrow(wide_batch::load_aligned(wide.data()), wide_batch::load_aligned(wide.data() + wide_batch::size)).store_aligned(narrowed.data());
+            EXPECT_VECTOR_EQ(narrowed, input) << print_function_name("narrow truncation");
+        }
+    }
 };
 
 TYPED_TEST_SUITE(conversion_test, conversion_types, conversion_test_names);
@@ -181,4 +230,9 @@ TYPED_TEST(conversion_test, u8_casting)
     this->test_u8_casting();
 }
 
+TYPED_TEST(conversion_test, widen_narrow)
+{
+    this->test_widen_narrow();
+}
+
 #endif
@@ -0,0 +1,148 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "xsimd/stl/convolve.hpp"
+
+template <class T>
+using convolve_vector = std::vector<T, xsimd::aligned_allocator<T>>;
+
+template <class T>
+std::vector<T> make_signal(std::size_t n, std::size_t seed)
+{
+    std::vector<T> res(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        res[i] = T(int((i * 7 + seed * 13) % 11) - 5);
+    }
+    return res;
+}
+
+// convolution of the signal padded with m - 1 zeros on the left
+template <class T>
+std::vector<double> reference_filter(std::vector<T> const& signal, std::vector<T> const& taps)
+{
+    std::vector<double> res(signal.size());
+    for (std::size_t i = 0; i < signal.size(); ++i)
+    {
+        double acc = 0.;
+        for (std::size_t k = 0; k < taps.size() && k <= i; ++k)
+        {
+            acc += double(taps[k]) * double(signal[i - k]);
+        }
+        res[i] = acc;
+    }
+    return res;
+}
+
+template <class T>
+void check_convolve(std::size_t n, std::size_t m, std::size_t offset)
+{
+    auto const signal = make_signal<T>(n + offset, 1);
+    auto const taps = make_signal<T>(m, 2);
+    convolve_vector<T> aligned_signal(signal.begin(), signal.end());
+    convolve_vector<T> out(n + offset, T(-100));
+
+    // outputs i + m - 1 of the causal filter
+    std::vector<T> const input(signal.begin() + offset, signal.end());
+    auto const expected = reference_filter(input, taps);
+
+    auto end = xsimd::convolve(aligned_signal.begin() + offset, aligned_signal.end(), taps.begin(), taps.end(), out.begin() + offset);
+    std::size_t const count = n >= m ? n - m + 1 : 0;
+    ASSERT_EQ(out.begin() + offset + count, end) << "n " << n << " m " << m;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(double(out[offset + i]), expected[i + m - 1]) << "n " << n << " m " << m << " offset " << offset << " index " << i;
+    }
+    if (offset + count < out.size())
+    {
+        EXPECT_EQ(out[offset + count], T(-100)) << "n " << n << " m " << m;
+    }
+}
+
+TEST(convolve, valid)
+{
+    for (std::size_t m : { 1, 2, 3, 5, 8, 9, 16, 33, 128 })
+    {
+        for (std::size_t n : { 0, 1, 7, 8, 100, 1000 })
+        {
+            for (std::size_t offset : { 0, 1 })
+            {
+                check_convolve<float>(n, m, offset);
+                check_convolve<double>(n, m, offset);
+                check_convolve<int32_t>(n, m, offset);
+            }
+        }
+    }
+}
+
+TEST(convolve, containers)
+{
+    std::vector<float> const signal = { 1.f, 2.f, 3.f, 4.f };
+    std::vector<float> const taps = { 1.f, 10.f };
+    std::vector<float> out(3);
+    xsimd::convolve(signal, taps, out);
+    EXPECT_EQ(out, std::vector<float>({ 12.f, 23.f, 34.f }));
+}
+
+template <class T>
+void check_fir_filter(std::size_t m)
+{
+    auto const signal = make_signal<T>(3000, 3);
+    auto const taps = make_signal<T>(m, 4);
+    auto const expected = reference_filter(signal, taps);
+
+    xsimd::fir_filter<T> filter(taps.begin(), taps.end());
+    EXPECT_EQ(filter.size(), m);
+
+    // blocks shorter than the history, then longer ones
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        std::vector<T> out(signal.size());
+        std::size_t begin = 0;
+        std::size_t block = 1;
+        while (begin < signal.size())
+        {
+            std::size_t const end = std::min(begin + block, signal.size());
+            auto res = filter.process(signal.begin() + begin, signal.begin() + end, out.begin() + begin);
+            EXPECT_EQ(out.begin() + end, res);
+            begin = end;
+            block = block * 3 % 257 + 1;
+        }
+        for (std::size_t i = 0; i < signal.size(); ++i)
+        {
+            EXPECT_EQ(double(out[i]), expected[i]) << "m " << m << " pass " << pass << " index " << i;
+        }
+        filter.reset();
+    }
+
+    // in place
+    std::vector<T> data(signal);
+    filter.process(data.begin(), data.begin() + 100, data.begin());
+    filter.process(data.begin() + 100, data.end(), data.begin() + 100);
+    for (std::size_t i = 0; i < signal.size(); ++i)
+    {
+        EXPECT_EQ(double(data[i]), expected[i]) << "m " << m << " in place, index " << i;
+    }
+}
+
+TEST(convolve, fir_filter)
+{
+    for (std::size_t m : { 1, 4, 8, 16, 65 })
+    {
+        check_fir_filter<float>(m);
+        check_fir_filter<double>(m);
+        check_fir_filter<int32_t>(m);
+    }
+}
@@ -168,6 +168,48 @@ protected:
         }
 
     }
+
+    void test_fast_functions()
+    {
+        // results over the whole range of normal values
+        value_type const max_log = std::log(std::numeric_limits<value_type>::max());
+        vector_type input(nb_input);
+        for (size_t i = 0; i < nb_input; ++i)
+        {
+            input[i] = max_log * (value_type(-0.97) + value_type(1.96) * value_type(i) / value_type(nb_input));
+        }
+        batch_type in;
+
+        // fast::exp
+        {
+            std::transform(input.cbegin(), input.cend(), expected.begin(),
+                        [](const value_type& v) { return std::exp(v); });
+            for (size_t i = 0; i < nb_input; i += size)
+            {
+                detail::load_batch(in, input, i);
+                detail::store_batch(xsimd::fast::exp(in), res, i);
+            }
+            EXPECT_LE(detail::get_max_ulp_diff(res, expected), 4.) << print_function_name("fast::exp");
+
+            batch_type const inf = std::numeric_limits<value_type>::infinity();
+            EXPECT_TRUE(all(isfinite(xsimd::fast::exp(inf)))) << print_function_name("fast::exp");
+            EXPECT_TRUE(all(xsimd::fast::exp(-inf) < batch_type(std::numeric_limits<value_type>::min() * 1024))) << print_function_name("fast::exp");
+        }
+
+        // fast::log
+        {
+            std::transform(input.cbegin(), input.cend(), input.begin(),
+                        [](const value_type& v) { return std::exp(v); });
+            std::transform(input.cbegin(), input.cend(), expected.begin(),
+                        [](const value_type& v) { return std::log(v); });
+            for (size_t i = 0; i < nb_input; i += size)
+            {
+                detail::load_batch(in, input, i);
+                detail::store_batch(xsimd::fast::log(in), res, i);
+            }
+            EXPECT_LE(detail::get_max_ulp_diff(res, expected), 4.) << print_function_name("fast::log");
+        }
+    }
 };
 
 TYPED_TEST_SUITE(exponential_test, batch_float_types, simd_test_names);
@@ -181,3 +223,8 @@ TYPED_TEST(exponential_test, log)
 {
     this->test_log_functions();
 }
+
+TYPED_TEST(exponential_test, fast)
+{
+    this->test_fast_functions();
+}
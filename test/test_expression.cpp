@@ -0,0 +1,148 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "xsimd/stl/expression.hpp"
+
+#if XSIMD_WITH_NEON && !XSIMD_WITH_NEON64
+using expression_value_type = float;
+#else
+using expression_value_type = double;
+#endif
+
+template <class T>
+using expression_vector = std::vector<T, xsimd::aligned_allocator<T>>;
+
+class xsimd_expression : public ::testing::Test
+{
+protected:
+
+    using value_type = expression_value_type;
+    using vector_type = expression_vector<value_type>;
+
+    static constexpr std::size_t size = 93;
+
+    xsimd_expression()
+        : a(size), b(size), c(size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            a[i] = value_type(0.25) * value_type(i) + value_type(1);
+            b[i] = value_type(3) - value_type(0.125) * value_type(i);
+            c[i] = value_type(0.01) * value_type(i);
+        }
+    }
+
+    template <class F>
+    vector_type expected(F f, std::size_t count = size) const
+    {
+        vector_type res(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            res[i] = f(i);
+        }
+        return res;
+    }
+
+    template <class V>
+    void check(V const& res, vector_type const& ref, std::size_t offset = 0) const
+    {
+        for (std::size_t i = 0; i < ref.size(); ++i)
+        {
+            EXPECT_NEAR(res[offset + i], ref[i], std::abs(ref[i]) * 1e-6) << "index " << i;
+        }
+    }
+
+    vector_type a, b, c;
+};
+
+TEST_F(xsimd_expression, arithmetic)
+{
+    vector_type res(size);
+    xsimd::evaluate(xsimd::expr(a) * b + c, res.begin());
+    check(res, expected([this](std::size_t i) { return a[i] * b[i] + c[i]; }));
+
+    xsimd::evaluate((xsimd::expr(a) - b) / (xsimd::expr(c) + 1), res.begin());
+    check(res, expected([this](std::size_t i) { return (a[i] - b[i]) / (c[i] + 1); }));
+
+    xsimd::evaluate(-xsimd::expr(a) * 2 + 0.5, res.begin());
+    check(res, expected([this](std::size_t i) { return -a[i] * 2 + value_type(0.5); }));
+
+    xsimd::evaluate(2 / xsimd::expr(a) - b * xsimd::expr(c), res.begin());
+    check(res, expected([this](std::size_t i) { return 2 / a[i] - b[i] * c[i]; }));
+}
+
+TEST_F(xsimd_expression, functions)
+{
+    vector_type res(size);
+    xsimd::evaluate(xsimd::expr(a) * b + xsimd::sin(xsimd::expr(c)), res.begin());
+    check(res, expected([this](std::size_t i) { return a[i] * b[i] + std::sin(c[i]); }));
+
+    xsimd::evaluate(xsimd::sqrt(xsimd::abs(xsimd::expr(b))) + xsimd::exp(xsimd::expr(c)), res.begin());
+    check(res, expected([this](std::size_t i) { return std::sqrt(std::abs(b[i])) + std::exp(c[i]); }));
+
+    xsimd::evaluate(xsimd::min(xsimd::expr(a), b) - xsimd::max(xsimd::expr(b), 1), res.begin());
+    check(res, expected([this](std::size_t i) { return std::min(a[i], b[i]) - std::max(b[i], value_type(1)); }));
+
+    xsimd::evaluate(xsimd::fma(xsimd::expr(a), xsimd::expr(b), xsimd::log(xsimd::expr(a))), res.begin());
+    check(res, expected([this](std::size_t i) { return std::fma(a[i], b[i], std::log(a[i])); }));
+
+    xsimd::evaluate(xsimd::pow(xsimd::expr(a), xsimd::expr(c)), res.begin());
+    check(res, expected([this](std::size_t i) { return std::pow(a[i], c[i]); }));
+}
+
+TEST_F(xsimd_expression, alignment)
+{
+    // unaligned output, aligned inputs
+    vector_type res(size + 1);
+    xsimd::evaluate(xsimd::expr(a) * b + c, res.begin() + 1);
+    check(res, expected([this](std::size_t i) { return a[i] * b[i] + c[i]; }), 1);
+
+    // inputs with different alignments
+    std::size_t const count = size - 3;
+    auto e = xsimd::expr(a.data() + 1, count) + xsimd::expr(b.data() + 3, count);
+    EXPECT_EQ(e.size(), count);
+    xsimd::evaluate(e, res.begin());
+    check(res, expected([this](std::size_t i) { return a[i + 1] + b[i + 3]; }, count));
+
+    // inputs aligned like the output, the output being unaligned
+    xsimd::evaluate(xsimd::expr(a.data() + 1, count) * xsimd::expr(b.data() + 1, count), res.begin() + 1);
+    check(res, expected([this](std::size_t i) { return a[i + 1] * b[i + 1]; }, count), 1);
+
+    // views on the first values of longer arrays
+    xsimd::evaluate(xsimd::expr(a.data(), 3) + xsimd::expr(b.data(), 3), res.begin());
+    check(res, expected([this](std::size_t i) { return a[i] + b[i]; }, 3));
+}
+
+TEST_F(xsimd_expression, in_place)
+{
+    vector_type ref = expected([this](std::size_t i) { return a[i] * a[i] + b[i]; });
+    xsimd::evaluate(xsimd::expr(a) * a + b, a.begin());
+    check(a, ref);
+}
+
+TEST_F(xsimd_expression, integers)
+{
+    std::vector<int32_t> x(size), y(size), res(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        x[i] = int32_t(i) - 40;
+        y[i] = 3 * int32_t(i);
+    }
+    xsimd::evaluate(xsimd::expr(x) * 3 + xsimd::abs(xsimd::expr(y) - x), res.begin());
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        EXPECT_EQ(res[i], x[i] * 3 + std::abs(y[i] - x[i])) << "index " << i;
+    }
+}
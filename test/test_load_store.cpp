@@ -111,6 +111,40 @@ protected:
 
     }
 
+    void test_gather_scatter()
+    {
+        using index_type = xsimd::as_unsigned_integer_t<value_type>;
+        using index_batch = xsimd::batch<index_type, typename B::arch_type>;
+        std::array<value_type, 2 * size> data;
+        std::array<index_type, size> indices;
+        for (size_t i = 0; i < 2 * size; ++i)
+        {
+            data[i] = static_cast<value_type>(i % 100);
+        }
+        // reversed even offsets
+        for (size_t i = 0; i < size; ++i)
+        {
+            indices[i] = index_type(2 * (size - 1 - i));
+            expected[i] = data[indices[i]];
+        }
+        index_batch index = index_batch::load_unaligned(indices.data());
+        batch_type b = xsimd::gather(data.data(), index);
+        EXPECT_BATCH_EQ(b, expected) << print_function_name("gather");
+
+        std::array<value_type, 2 * size> res;
+        res.fill(value_type(0));
+        xsimd::scatter(b, res.data(), index);
+        for (size_t i = 0; i < size; ++i)
+        {
+            EXPECT_EQ(res[2 * i], data[2 * i]) << print_function_name("scatter") << " at " << 2 * i;
+            EXPECT_EQ(res[2 * i + 1], value_type(0)) << print_function_name("scatter") << " at " << 2 * i + 1;
+        }
+
+        // the last lane wins when all the offsets are equal
+        xsimd::scatter(b, res.data(), index_batch(index_type(1)));
+        EXPECT_EQ(res[1], expected[size - 1]) << print_function_name("scatter (same offset)");
+    }
+
 private:
 
     template <class V>
@@ -181,3 +215,8 @@ TYPED_TEST(load_store_test, store)
     this->test_store();
 }
 
+TYPED_TEST(load_store_test, gather_scatter)
+{
+    this->test_gather_scatter();
+}
+
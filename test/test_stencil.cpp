@@ -0,0 +1,143 @@
+/***************************************************************************
+* Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+* Martin Renou                                                             *
+* Copyright (c) QuantStack                                                 *
+* Copyright (c) Serge Guelton                                              *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "xsimd/stl/stencil.hpp"
+
+using gaussian_3x3 = xsimd::stencil_weights<3, 16, 1, 2, 1, 2, 4, 2, 1, 2, 1>;
+using sobel_x = xsimd::stencil_weights<3, 1, -1, 0, 1, -2, 0, 2, -1, 0, 1>;
+using laplacian = xsimd::stencil_weights<3, 1, 0, 1, 0, 1, -4, 1, 0, 1, 0>;
+using box_3x3 = xsimd::stencil_weights<3, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1>;
+using sharpen = xsimd::stencil_weights<3, 1, 0, -1, 0, -1, 5, -1, 0, -1, 0>;
+using gaussian_5x5 = xsimd::stencil_weights<5, 256,
+                                            1, 4, 6, 4, 1,
+                                            4, 16, 24, 16, 4,
+                                            6, 24, 36, 24, 6,
+                                            4, 16, 24, 16, 4,
+                                            1, 4, 6, 4, 1>;
+using high_boost = xsimd::stencil_weights<3, 128, -16, -16, -16, -16, 256, -16, -16, -16, -16>;
+
+static_assert(std::is_same<xsimd::detail::stencil_accumulator<uint8_t, gaussian_3x3>::type, uint16_t>::value, "unsigned 16-bit sums");
+static_assert(std::is_same<xsimd::detail::stencil_accumulator<uint8_t, gaussian_5x5>::type, uint16_t>::value, "unsigned 16-bit sums");
+static_assert(std::is_same<xsimd::detail::stencil_accumulator<uint8_t, sobel_x>::type, int16_t>::value, "signed 16-bit sums");
+static_assert(std::is_same<xsimd::detail::stencil_accumulator<uint8_t, box_3x3>::type, int32_t>::value, "divided in float");
+static_assert(std::is_same<xsimd::detail::stencil_accumulator<uint8_t, high_boost>::type, int32_t>::value, "overflows 16 bits");
+
+template <class Weights>
+double reference_sum(std::vector<double> const& in, std::size_t stride, std::size_t i, std::size_t j)
+{
+    double acc = 0.;
+    for (std::size_t r = 0; r < Weights::size; ++r)
+    {
+        for (std::size_t c = 0; c < Weights::size; ++c)
+        {
+            acc += Weights::get(r, c) * in[(i + r) * stride + j + c];
+        }
+    }
+    return acc;
+}
+
+// rounded half up when dividing by a power of two, to nearest otherwise
+template <class Weights>
+double reference_pixel(double sum)
+{
+    double const d = Weights::divisor;
+    double const res = (Weights::divisor & (Weights::divisor - 1)) == 0 ? std::floor((sum + std::floor(d / 2)) / d) : std::nearbyint(sum / d);
+    return std::min(std::max(res, 0.), 255.);
+}
+
+template <class Weights, class T>
+void check_stencil(std::size_t rows, std::size_t cols, std::size_t padding)
+{
+    std::size_t const stride = cols + padding;
+    std::vector<double> values(rows * stride);
+    std::vector<T> in(rows * stride);
+    for (std::size_t k = 0; k < in.size(); ++k)
+    {
+        in[k] = T((k * 7919 + k / stride * 13) % 256);
+        values[k] = double(in[k]);
+    }
+
+    std::size_t const n = Weights::size;
+    std::size_t const out_rows = rows >= n ? rows - n + 1 : 0;
+    std::size_t const out_cols = cols >= n ? cols - n + 1 : 0;
+    std::size_t const out_stride = out_cols + padding;
+    std::vector<T> out(out_rows * out_stride + padding + 1, T(7));
+
+    xsimd::stencil2d<Weights>(in.data(), rows, cols, stride, out.data(), out_stride);
+
+    for (std::size_t i = 0; i < out_rows; ++i)
+    {
+        for (std::size_t j = 0; j < out_cols; ++j)
+        {
+            double const sum = reference_sum<Weights>(values, stride, i, j);
+            T const res = out[i * out_stride + j];
+            if (std::is_floating_point<T>::value)
+            {
+                double const expected = sum / Weights::divisor;
+                EXPECT_NEAR(double(res), expected, 1e-4 * std::max(std::abs(expected), 1.)) << rows << "x" << cols << " at " << i << ", " << j;
+            }
+            else
+            {
+                EXPECT_EQ(double(res), reference_pixel<Weights>(sum)) << rows << "x" << cols << " at " << i << ", " << j;
+            }
+        }
+        for (std::size_t j = out_cols; j < out_stride; ++j)
+        {
+            EXPECT_EQ(out[i * out_stride + j], T(7)) << "padding written, " << rows << "x" << cols;
+        }
+    }
+    EXPECT_EQ(out.back(), T(7)) << "past the end written, " << rows << "x" << cols;
+}
+
+template <class Weights, class T>
+void check_stencil_sizes()
+{
+    std::size_t const sizes[][2] = { { 1, 1 }, { 3, 3 }, { 5, 70 }, { 17, 33 }, { 40, 129 }, { 8, 300 }, { 4, 2100 }, { 5, 5000 } };
+    for (auto const& size : sizes)
+    {
+        check_stencil<Weights, T>(size[0], size[1], 0);
+        check_stencil<Weights, T>(size[0], size[1], 3);
+    }
+}
+
+TEST(stencil, float)
+{
+    check_stencil_sizes<gaussian_3x3, float>();
+    check_stencil_sizes<sobel_x, float>();
+    check_stencil_sizes<box_3x3, float>();
+    check_stencil_sizes<gaussian_5x5, float>();
+    check_stencil_sizes<laplacian, double>();
+}
+
+TEST(stencil, uint8)
+{
+    check_stencil_sizes<gaussian_3x3, uint8_t>();
+    check_stencil_sizes<sobel_x, uint8_t>();
+    check_stencil_sizes<laplacian, uint8_t>();
+    check_stencil_sizes<sharpen, uint8_t>();
+    check_stencil_sizes<box_3x3, uint8_t>();
+    check_stencil_sizes<gaussian_5x5, uint8_t>();
+    check_stencil_sizes<high_boost, uint8_t>();
+}
+
+TEST(stencil, contiguous)
+{
+    std::vector<float> in(6 * 10, 1.f), out(4 * 8, 0.f);
+    xsimd::stencil2d<box_3x3>(in.data(), 6, 10, out.data());
+    for (float x : out)
+    {
+        EXPECT_FLOAT_EQ(x, 1.f);
+    }
+}
@@ -110,6 +110,156 @@ protected:
         }
     }
 
+    void test_large_arguments()
+    {
+        // every binade up to the largest finite value, each batch mixing
+        // small and large arguments, and arguments close to a multiple of pi/2
+        vector_type large_input(nb_input);
+        int const max_exp = std::numeric_limits<value_type>::max_exponent;
+        for (size_t i = 0; i < nb_input; ++i)
+        {
+            value_type const mantissa = value_type(0.5) + value_type(i % 1021) / value_type(2042);
+            int const exponent = i % 3 == 0 ? int(i % 20) : int((i * 7919) % size_t(max_exp));
+            large_input[i] = (i % 2 ? 1 : -1) * std::ldexp(mantissa, exponent);
+        }
+        large_input[0] = std::numeric_limits<value_type>::max();
+        large_input[1] = sizeof(value_type) == sizeof(double) ? value_type(std::ldexp(6381956970095103., 797)) : value_type(std::ldexp(16367173., 72));
+
+        vector_type expected2(nb_input), res2(nb_input);
+        std::transform(large_input.cbegin(), large_input.cend(), expected.begin(),
+                       [](const value_type& v) { return std::sin(v); });
+        std::transform(large_input.cbegin(), large_input.cend(), expected2.begin(),
+                       [](const value_type& v) { return std::cos(v); });
+        batch_type in, out1, out2;
+        for (size_t i = 0; i < nb_input; i += size)
+        {
+            detail::load_batch(in, large_input, i);
+            std::tie(out1, out2) = sincos(in);
+            detail::store_batch(out1, res, i);
+            detail::store_batch(out2, res2, i);
+        }
+        size_t diff = detail::get_nb_diff(res, expected);
+        EXPECT_EQ(diff, 0) << print_function_name("sincos(sin) of large arguments");
+        diff = detail::get_nb_diff(res2, expected2);
+        EXPECT_EQ(diff, 0) << print_function_name("sincos(cos) of large arguments");
+
+        for (size_t i = 0; i < nb_input; i += size)
+        {
+            detail::load_batch(in, large_input, i);
+            detail::store_batch(sin(in), res, i);
+            detail::store_batch(cos(in), res2, i);
+        }
+        diff = detail::get_nb_diff(res, expected);
+        EXPECT_EQ(diff, 0) << print_function_name("sin of large arguments");
+        diff = detail::get_nb_diff(res2, expected2);
+        EXPECT_EQ(diff, 0) << print_function_name("cos of large arguments");
+    }
+
+    void test_payne_hanek_reduction()
+    {
+        // both ways of computing the rounding errors of the products, the
+        // fused one only where fma rounds once, against fdlibm
+        check_payne_hanek_reduction(std::false_type(), "Payne-Hanek reduction with Dekker's splitting");
+        if (xsimd::kernel::detail::has_fused_fma<typename batch_type::arch_type>::value)
+        {
+            check_payne_hanek_reduction(std::true_type(), "Payne-Hanek reduction with fms");
+        }
+    }
+
+    void test_fast_functions()
+    {
+        vector_type fast_input(nb_input);
+        for (size_t i = 0; i < nb_input; ++i)
+        {
+            fast_input[i] = value_type(-1000.) + value_type(2000.) * value_type(i) / value_type(nb_input) + value_type(1e-3);
+        }
+        batch_type in;
+
+        // fast::sin
+        {
+            std::transform(fast_input.cbegin(), fast_input.cend(), expected.begin(),
+                           [](const value_type& v) { return std::sin(v); });
+            for (size_t i = 0; i < nb_input; i += size)
+            {
+                detail::load_batch(in, fast_input, i);
+                detail::store_batch(xsimd::fast::sin(in), res, i);
+            }
+            EXPECT_LE(detail::get_max_ulp_diff(res, expected), 4.) << print_function_name("fast::sin");
+        }
+
+        // fast::cos
+        {
+            std::transform(fast_input.cbegin(), fast_input.cend(), expected.begin(),
+                           [](const value_type& v) { return std::cos(v); });
+            for (size_t i = 0; i < nb_input; i += size)
+            {
+                detail::load_batch(in, fast_input, i);
+                detail::store_batch(xsimd::fast::cos(in), res, i);
+            }
+            EXPECT_LE(detail::get_max_ulp_diff(res, expected), 4.) << print_function_name("fast::cos");
+        }
+    }
+
+    void test_pi_functions()
+    {
+        // multiples of 1/64 and other values up to 3000, and every binade
+        // up to the largest finite value
+        vector_type pi_input(nb_input);
+        int const max_exp = std::numeric_limits<value_type>::max_exponent;
+        for (size_t i = 0; i < nb_input; ++i)
+        {
+            value_type const sign = i % 2 ? value_type(1) : value_type(-1);
+            if (i % 3 == 0)
+                pi_input[i] = sign * value_type(i % 192000) / value_type(64);
+            else if (i % 3 == 1)
+                pi_input[i] = sign * value_type(3000) * value_type(i) / value_type(nb_input);
+            else
+                pi_input[i] = sign * std::ldexp(value_type(0.5) + value_type(i % 1021) / value_type(2042), int((i * 7919) % size_t(max_exp)));
+        }
+
+        vector_type expected2(nb_input), res2(nb_input);
+        batch_type in, out1, out2;
+
+        // sinpi
+        std::transform(pi_input.cbegin(), pi_input.cend(), expected.begin(), [](value_type v) { return reference_pi(v, 0); });
+        std::transform(pi_input.cbegin(), pi_input.cend(), expected2.begin(), [](value_type v) { return reference_pi(v, 1); });
+        for (size_t i = 0; i < nb_input; i += size)
+        {
+            detail::load_batch(in, pi_input, i);
+            detail::store_batch(sinpi(in), res, i);
+            detail::store_batch(cospi(in), res2, i);
+        }
+        check_pi_function(res, expected, "sinpi");
+        check_pi_function(res2, expected2, "cospi");
+
+        // sincospi
+        for (size_t i = 0; i < nb_input; i += size)
+        {
+            detail::load_batch(in, pi_input, i);
+            std::tie(out1, out2) = sincospi(in);
+            detail::store_batch(out1, res, i);
+            detail::store_batch(out2, res2, i);
+        }
+        check_pi_function(res, expected, "sincospi(sin)");
+        check_pi_function(res2, expected2, "sincospi(cos)");
+
+        // tanpi
+        std::transform(pi_input.cbegin(), pi_input.cend(), expected.begin(), [](value_type v) { return reference_pi(v, 2); });
+        for (size_t i = 0; i < nb_input; i += size)
+        {
+            detail::load_batch(in, pi_input, i);
+            detail::store_batch(tanpi(in), res, i);
+        }
+        check_pi_function(res, expected, "tanpi", 3.);
+
+        // infinities and NaN
+        value_type const inf = std::numeric_limits<value_type>::infinity();
+        batch_type const special = batch_type(inf) + batch_type(value_type(0.5)) * batch_type(value_type(0.));
+        EXPECT_TRUE(all(isnan(sinpi(special)))) << print_function_name("sinpi(inf)");
+        EXPECT_TRUE(all(isnan(cospi(-special)))) << print_function_name("cospi(-inf)");
+        EXPECT_TRUE(all(isnan(tanpi(batch_type(std::numeric_limits<value_type>::quiet_NaN()))))) << print_function_name("tanpi(nan)");
+    }
+
     void test_reciprocal_functions()
     {
 
@@ -172,6 +322,80 @@ protected:
         }
 
     }
+
+private:
+
+    // sine (0), cosine (1) or tangent (2) of pi * x, from the exact
+    // reduction of |x| modulo 2 to a multiple of 0.5 and a remainder
+    static value_type reference_pi(value_type x, int function)
+    {
+        long double const pi = 3.141592653589793238462643383279502884L;
+        long double const r = std::fmod(std::fabs((long double)x), 2.L);
+        long double const n = std::nearbyint(2.L * r);
+        long double const f = r - n / 2.L;
+        int const quadrant = int(n) % 4;
+        long double const s = f == 0.L ? 0.L : std::sin(pi * f);
+        long double const c = std::cos(pi * f);
+        long double const sin_res = quadrant == 0 ? s : quadrant == 1 ? c : quadrant == 2 ? -s : -c;
+        long double const cos_res = quadrant == 0 ? c : quadrant == 1 ? -s : quadrant == 2 ? -c : s;
+        long double res;
+        if (function == 0)
+            res = sin_res == 0.L ? 0.L : sin_res;
+        else if (function == 1)
+            res = cos_res == 0.L ? 0.L : cos_res;
+        else
+        {
+            // the zeros and the infinities are negative for odd integer parts
+            long double const sign = quadrant < 2 ? 1.L : -1.L;
+            res = sin_res == 0.L ? sign * 0.L : cos_res == 0.L ? sign * std::numeric_limits<long double>::infinity() : sin_res / cos_res;
+        }
+        return value_type(function != 1 && std::signbit(x) ? -res : res);
+    }
+
+    // zeros and infinities must match exactly, sign included
+    void check_pi_function(vector_type lhs, vector_type rhs, std::string const& name, double max_ulp = 2.) const
+    {
+        size_t diff = 0;
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (rhs[i] == value_type(0) || std::isinf(rhs[i]))
+            {
+                if (!(lhs[i] == rhs[i] && std::signbit(lhs[i]) == std::signbit(rhs[i])))
+                    ++diff;
+                lhs[i] = rhs[i] = value_type(1);
+            }
+        }
+        EXPECT_EQ(diff, 0) << print_function_name(name + " of multiples of 0.5");
+        EXPECT_LE(detail::get_max_ulp_diff(lhs, rhs), max_ulp) << print_function_name(name);
+    }
+
+    template <class Fused>
+    void check_payne_hanek_reduction(Fused fused, std::string const& name)
+    {
+        int const min_exp = sizeof(value_type) == sizeof(double) ? 18 : 2;
+        int const max_exp = std::numeric_limits<value_type>::max_exponent;
+        vector_type reduce_input(nb_input), expected_quadrant(nb_input), res_quadrant(nb_input);
+        for (size_t i = 0; i < nb_input; ++i)
+        {
+            value_type const mantissa = value_type(0.5) + value_type((i * 7919) % 4093) / value_type(8186);
+            int const exponent = min_exp + int(i % size_t(max_exp - min_exp));
+            reduce_input[i] = std::ldexp(mantissa, exponent);
+            double y[2];
+            std::int32_t const n = xsimd::detail::__ieee754_rem_pio2(double(reduce_input[i]), y);
+            expected_quadrant[i] = value_type(n & 3);
+            expected[i] = value_type(y[0] + y[1]);
+        }
+        batch_type in, xr;
+        for (size_t i = 0; i < nb_input; i += size)
+        {
+            detail::load_batch(in, reduce_input, i);
+            batch_type const n = xsimd::kernel::detail::payne_hanek_reduce(in, xr, fused);
+            detail::store_batch(n, res_quadrant, i);
+            detail::store_batch(xr, res, i);
+        }
+        EXPECT_EQ(res_quadrant, expected_quadrant) << print_function_name(name + " (quadrant)");
+        EXPECT_LE(detail::get_max_ulp_diff(res, expected), 2.) << print_function_name(name);
+    }
 };
 
 TYPED_TEST_SUITE(trigonometric_test, batch_float_types, simd_test_names);
@@ -186,3 +410,22 @@ TYPED_TEST(trigonometric_test, reciprocal)
     this->test_reciprocal_functions();
 }
 
+TYPED_TEST(trigonometric_test, large_arguments)
+{
+    this->test_large_arguments();
+}
+
+TYPED_TEST(trigonometric_test, payne_hanek_reduction)
+{
+    this->test_payne_hanek_reduction();
+}
+
+TYPED_TEST(trigonometric_test, fast)
+{
+    this->test_fast_functions();
+}
+
+TYPED_TEST(trigonometric_test, pi)
+{
+    this->test_pi_functions();
+}
@@ -480,6 +480,23 @@ namespace detail
         return get_nb_diff(lhs.begin(), lhs.end(), rhs.begin());
     }
 
+    // Largest distance between lhs and rhs, in units in the last place of rhs.
+    template <class T, class A>
+    double get_max_ulp_diff(const std::vector<T, A>& lhs, const std::vector<T, A>& rhs)
+    {
+        double res = 0.;
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            T const ulp = std::nextafter(std::abs(rhs[i]), std::numeric_limits<T>::infinity()) - std::abs(rhs[i]);
+            double const diff = double(std::abs(lhs[i] - rhs[i]) / ulp);
+            if (!(diff <= res))
+            {
+                res = diff;
+            }
+        }
+        return res;
+    }
+
     template <class B, class S>
     void load_batch(B& b, const S& src, size_t i = 0)
     {